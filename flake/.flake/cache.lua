@@ -0,0 +1 @@
+return {builders={["luaIO.dependencies"]={lastIndex=15},["luaIO.program"]={lastIndex=13},["luaIO.run"]={lastIndex=65},["systemIO.directory"]={lastIndex=1},["systemIO.execute"]={lastIndex=1}},durations={["luaIO.dependencies/04f4a75ce5be5df2f333d8175ccf8fbdd4661365"]=0.30943202972412,["luaIO.dependencies/2d431693da6ff566383e0fca84b69d21f06ffa9c"]=0.17776012420654,["luaIO.dependencies/39ca88852157caf81b27e339217d10179daa64b7"]=0.27614498138428,["luaIO.dependencies/43c9e1ff0d27fb2172f958f6e7676932b6668a83"]=0.31174778938293,["luaIO.dependencies/54d2ecf4b096d1bbef06b33b766cfbb1f256d5e9"]=0.16061401367188,["luaIO.dependencies/787b0a2b70920e3add0d5f45ca22bbfbd99f01a9"]=0.071014165878296,["luaIO.dependencies/8e403e0433d188c043cdc2bf5bcbecfef6a2f64b"]=0.15197682380676,["luaIO.dependencies/bb207548935e66f40c7e4ee8b57b72e45890ac71"]=0.27930593490601,["luaIO.dependencies/c6117e72592f09401046ee1de92865ef0630b02b"]=0.30442810058594,["luaIO.dependencies/d3ed928c0e43cc75b82160a53423eeb817f04fb7"]=0.26094698905945,["luaIO.dependencies/dea9892fb880511f9adb677abfdfd37d78a40f6a"]=0.33312892913818,["luaIO.dependencies/e0c187987b0fe0c6f0cab0f7a5d0ce39b05b125e"]=0.095140933990479,["luaIO.dependencies/e16fab6f09cc7c967bd7d5f0bc8022343b779825"]=0.10391306877136,["luaIO.dependencies/e7e2be26757247c2429b09221c495f2734ae03ea"]=0.21188402175903,["luaIO.dependencies/fc86c56610eeb672734bcf525dab252bcfbd44c2"]=0.18401980400085,["luaIO.program/447f366267b6d4f4c2b6077f53539a62ea40ed4c"]=0.47214484214783,["luaIO.program/c0ad2a46f738462b21b87394dd1692bd291a0319"]=2.4549090862274,["luaIO.run/05c539be434dd7dcf2bd50fbc33c55c67715da83"]=0.22750210762024,["luaIO.run/2fa90d4b5356a170b5eb5648b56075d018faacc7"]=0.014464139938354,["luaIO.run/34bcb3ccd418693ee3dc8039199d7f9a2b2f5aea"]=0.013277769088745,["luaIO.run/54f37009db51bff0948473d994862633f89d21a9"]=0.011631011962891,["luaIO.run/582c566ceb52e27e86b1165fdfa720ebb5664c85"]=0.84689593315125,["luaIO.run/5a16ff281adb53d49f4ae16b1fb9975ff4589f4d"]=0.016715049743652,["luaIO.run/87beaa683330ea899bc387caf5930cfb5c68f895"]=0.015729188919067,["luaIO.run/a2d457a9cbeacaeca45d5cb212adfb0a449ab6c1"]=10.043178081512,["luaIO.run/a7b179044a5d2219f76bb02b5e7e7fd2be3a6caa"]=0.069311141967773,["luaIO.run/bbd5143fb6e1f07e1e4a7279b63e7f7f0bfb8623"]=0.034764289855957,["luaIO.run/bd7c1a2a1bdce9b517cdd644ae550b1f73b6ddd0"]=0.261883020401,["luaIO.run/cac8865172b6140afe41448faa7060f2215bdffe"]=0.30921602249146,["luaIO.run/dfbfb11a89d7ee19ffbe2d33d676db9c728f68c8"]=0.083981037139893,["luaIO.run/dfda0d5beae5312ec2d0de3d203b6d7e0fe6bd27"]=0.24330377578735,["systemIO.directory/6ac55a8ee2a7e6619a7fecdd5f12234fa0006f91"]=2.8848648071289e-05,["systemIO.execute/6c5bd66cc0b5b2da2cb527960dd3d1f66377af8d"]=0.027825832366943},results={["luaIO.dependencies/0ef289de53aa3a390b0d6195614b2440146109de"]={buildName="luaIO.dependencies/4",graphKey="luaIO.dependencies/39ca88852157caf81b27e339217d10179daa64b7",outputs={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["cas.lua"]="5dedaa6c6b6d9bdbbe3c59e21d0210668b22667f",["flake.lua"]="78784c45d267a5f074348b68ffc4f6471747adaf",["jobserver.lua"]="9dfb70d1f76759a900fc1f5dc1075fe313c89551",["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704",["trace.lua"]="46db5162fad787c0fe275d4cbd64d16266ca03fa"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["flake_q.lua"]={ctime=1792193207973019698,inode=1171752,mtime=1792193207973019698,sha1="9ccf4e99cbf1fa0d92d4871173a139e1e6893197",size=14200.0}},valid=true,value={"flake.lua","../luau/out/release/serialize.lua","operator.lua","../luau/out/release/xpio.lua","../luau/out/release/list.lua","../luau/out/release/object.lua","../luau/out/release/lfsu.lua","../luau/out/release/fsu.lua","../luau/out/release/thread.lua","../luau/out/release/heap.lua","../luau/out/release/queue.lua","jobserver.lua","cas.lua","trace.lua","../luau/out/release/qtest.lua"}},["luaIO.dependencies/2dda2767459d5a23370a36cf34b73f12202dd8da"]={buildName="luaIO.dependencies/6",graphKey="luaIO.dependencies/e7e2be26757247c2429b09221c495f2734ae03ea",outputs={["../luau/out/release/heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["process.lua"]="23f6ef6f818009bb76375b673a7e73cf849187ad"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["process_q.lua"]={ctime=1792191937955840437,inode=1171572,mtime=1792191937955840437,sha1="151b97d2d6849bf042b07bd77f2816e069dd7472",size=560.0}},valid=true,value={"process.lua","../luau/out/release/thread.lua","../luau/out/release/xpio.lua","../luau/out/release/heap.lua","../luau/out/release/object.lua","../luau/out/release/queue.lua","../luau/out/release/qtest.lua"}},["luaIO.dependencies/39b9c58b64b741a25cf40f9dcf623dd3b6a9007d"]={buildName="luaIO.dependencies/5",graphKey="luaIO.dependencies/54d2ecf4b096d1bbef06b33b766cfbb1f256d5e9",outputs={["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["operator_q.lua"]={ctime=1792189296974501830,inode=1172928,mtime=1454600802000000000,sha1="a5a22210e2c4daccd8ee06c8d0c972c802bbf026",size=546.0}},valid=true,value={"operator.lua"}},["luaIO.dependencies/628b7e08ec658234b4a5b4872d13c68d7664147a"]={buildName="luaIO.dependencies/1",graphKey="luaIO.dependencies/e16fab6f09cc7c967bd7d5f0bc8022343b779825",outputs={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["cas.lua"]="905162315e897801411fba11c0ea5708298b0123",["flake.lua"]="c311ff3d27f62fcf02fc0d44b2fc42fef3fdb02b",["jobserver.lua"]="b23e89cb676f9840759fc37b0a82d62a1289efad",["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704",["process.lua"]="23f6ef6f818009bb76375b673a7e73cf849187ad",["trace.lua"]="46db5162fad787c0fe275d4cbd64d16266ca03fa"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["flakeExe_q.lua"]={ctime=1792189296974501830,inode=1172933,mtime=1792181594000000000,sha1="34bf1f63d7988f2540f60f1004e0b608261e474d",size=2082.0}},valid=true,value={"../luau/out/release/lfsu.lua","../luau/out/release/fsu.lua","../luau/out/release/qtest.lua","process.lua","../luau/out/release/thread.lua","../luau/out/release/xpio.lua","../luau/out/release/heap.lua","../luau/out/release/object.lua","../luau/out/release/queue.lua","flake.lua","../luau/out/release/serialize.lua","operator.lua","../luau/out/release/list.lua","jobserver.lua","cas.lua","trace.lua"}},["luaIO.dependencies/62faeaebe1085408bbee5f154d6fb5f9000126b3"]={buildName="luaIO.dependencies/8",graphKey="luaIO.dependencies/d3ed928c0e43cc75b82160a53423eeb817f04fb7",outputs={["../luau/out/release/heap.lua"]="a00d42a11fbcf141902cc317b27fb2edec6d9b10",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["jobserver.lua"]="b23e89cb676f9840759fc37b0a82d62a1289efad"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["jobserver_q.lua"]={ctime=1792193662377968509,inode=1171720,mtime=1792193662377968509,sha1="c21356a9f1a9ede4de5dcc26d0a5d8a4cfe7baba",size=3066.0}},valid=true,value={"jobserver.lua","../luau/out/release/thread.lua","../luau/out/release/xpio.lua","../luau/out/release/heap.lua","../luau/out/release/object.lua","../luau/out/release/queue.lua","../luau/out/release/qtest.lua"}},["luaIO.dependencies/637b1ad942e6a099243bb20427bc722c65b5e6a4"]={buildName="luaIO.dependencies/10",graphKey="luaIO.dependencies/04f4a75ce5be5df2f333d8175ccf8fbdd4661365",outputs={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["cas.lua"]="5dedaa6c6b6d9bdbbe3c59e21d0210668b22667f",["remoteCache.lua"]="cd850adfb01e257c7dadf2b7bc4e28c790605516"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["remoteCache_q.lua"]={ctime=1792193619988343403,inode=1171729,mtime=1792193619988343403,sha1="a13c579c948b7d11db20ccd4fa386cd96361ad4c",size=5615.0}},valid=true,value={"remoteCache.lua","../luau/out/release/thread.lua","../luau/out/release/xpio.lua","../luau/out/release/heap.lua","../luau/out/release/object.lua","../luau/out/release/queue.lua","../luau/out/release/lfsu.lua","../luau/out/release/fsu.lua","cas.lua","../luau/out/release/serialize.lua","../luau/out/release/qtest.lua"}},["luaIO.dependencies/669618a990aa1479b52b530e7fd04862e6b1f6b4"]={buildName="luaIO.dependencies/14",graphKey="luaIO.dependencies/dea9892fb880511f9adb677abfdfd37d78a40f6a",outputs={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="a00d42a11fbcf141902cc317b27fb2edec6d9b10",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["cas.lua"]="905162315e897801411fba11c0ea5708298b0123",["compilerCache.lua"]="c14d822d99746db5cabe88a508677dd8f7ef88f9",["process.lua"]="23f6ef6f818009bb76375b673a7e73cf849187ad"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["compilerCache_q.lua"]={ctime=1792193508216313970,inode=1171755,mtime=1792193508216313970,sha1="5842dbf162a1016c33a7c43e16388232242b9c0d",size=2087.0}},valid=true,value={"compilerCache.lua","cas.lua","../luau/out/release/lfsu.lua","../luau/out/release/fsu.lua","../luau/out/release/serialize.lua","../luau/out/release/thread.lua","../luau/out/release/xpio.lua","../luau/out/release/heap.lua","../luau/out/release/object.lua","../luau/out/release/queue.lua","process.lua","../luau/out/release/qtest.lua","cIO.lua","systemIO.lua","../luau/out/release/xpexec.lua","../luau/out/release/list.lua","trace.lua","path.lua","depfile.lua"}},["luaIO.dependencies/79f847704179792b4972ef5fc8a61e6678ccd25d"]={buildName="luaIO.dependencies/9",graphKey="luaIO.dependencies/8e403e0433d188c043cdc2bf5bcbecfef6a2f64b",outputs={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["cas.lua"]="5dedaa6c6b6d9bdbbe3c59e21d0210668b22667f"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["cas_q.lua"]={ctime=1792193479933029415,inode=1171801,mtime=1792193479933029415,sha1="8385266df6b8bcb2f4a0e2a038eab3ee17650bd7",size=3624.0}},valid=true,value={"cas.lua","../luau/out/release/lfsu.lua","../luau/out/release/fsu.lua","../luau/out/release/serialize.lua","../luau/out/release/thread.lua","../luau/out/release/xpio.lua","../luau/out/release/heap.lua","../luau/out/release/object.lua","../luau/out/release/queue.lua","../luau/out/release/qtest.lua"}},["luaIO.dependencies/ac2dd422df7bb11c178ad434b6081299bbe1ac20"]={buildName="luaIO.dependencies/12",graphKey="luaIO.dependencies/fc86c56610eeb672734bcf525dab252bcfbd44c2",outputs={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["daemon.lua"]="47cfdd583563547c4d356cfd57e8b1bd6f008f77",["process.lua"]="23f6ef6f818009bb76375b673a7e73cf849187ad"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["daemon_q.lua"]={ctime=1792193104961558521,inode=1171742,mtime=1792193104961558521,sha1="980342b962d2cc263ee0e33022208647c68c9fa2",size=3444.0}},valid=true,value={"daemon.lua","../luau/out/release/xpio.lua","../luau/out/release/serialize.lua","../luau/out/release/thread.lua","../luau/out/release/heap.lua","../luau/out/release/object.lua","../luau/out/release/queue.lua","process.lua","flake.lua","operator.lua","../luau/out/release/list.lua","../luau/out/release/lfsu.lua","../luau/out/release/fsu.lua","jobserver.lua","cas.lua","trace.lua","../luau/out/release/qtest.lua"}},["luaIO.dependencies/af0fa0a6ac8cea6b96fe1483b1c6a4b30d8c4937"]={buildName="luaIO.dependencies/2",graphKey="luaIO.dependencies/bb207548935e66f40c7e4ee8b57b72e45890ac71",outputs={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/getopts.lua"]="41a0b573b7144c50cac86d2083f3ccfb3438ad25",["../luau/out/release/heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpexec.lua"]="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["c.lua"]="4708c6e4b6ae93923d1252869c9a7e430b0b6c69",["cIO.lua"]="4c699565eefb7a77b195821d8ce30e89858d30ba",["cas.lua"]="5dedaa6c6b6d9bdbbe3c59e21d0210668b22667f",["compilerCache.lua"]="c14d822d99746db5cabe88a508677dd8f7ef88f9",["daemon.lua"]="47cfdd583563547c4d356cfd57e8b1bd6f008f77",["depfile.lua"]="6495bf986ec19a1edf9e731f4870db069b6fdb28",["flake.lua"]="78784c45d267a5f074348b68ffc4f6471747adaf",["flakeOpts.lua"]="7b3f41f3384ce6b6ffe10a5991e7f64b49ef8e34",["jobserver.lua"]="9dfb70d1f76759a900fc1f5dc1075fe313c89551",["listBuilders.lua"]="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",["lua.lua"]="351e44997b41dd5dda00ab72e3741c3ca55abc78",["luaDeps.lua"]="743b1a60add2c9fb6dda0c3934205190ece6acda",["luaIO.lua"]="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704",["operatorBuilders.lua"]="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",["path.lua"]="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",["process.lua"]="23f6ef6f818009bb76375b673a7e73cf849187ad",["remoteCache.lua"]="cd850adfb01e257c7dadf2b7bc4e28c790605516",["system.lua"]="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",["systemIO.lua"]="18e1d46da8f9b587097386350daffe9c6ff6e266",["trace.lua"]="46db5162fad787c0fe275d4cbd64d16266ca03fa",["watch.lua"]="4bd7f55121dc476f7e9e494449435d17551fc589"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["main.lua"]={ctime=1792193352812502947,inode=1171974,mtime=1792193352812502947,sha1="ed0c6f2d66ece76985ccb786ddb02a4ab80d9f94",size=10781.0}},valid=true,value={"path.lua","flakeOpts.lua","../luau/out/release/getopts.lua","daemon.lua","../luau/out/release/xpio.lua","../luau/out/release/serialize.lua","../luau/out/release/thread.lua","../luau/out/release/heap.lua","../luau/out/release/object.lua","../luau/out/release/queue.lua","process.lua","flake.lua","operator.lua","../luau/out/release/list.lua","../luau/out/release/lfsu.lua","../luau/out/release/fsu.lua","jobserver.lua","cas.lua","trace.lua","lua.lua","c.lua","system.lua","listBuilders.lua","remoteCache.lua","compilerCache.lua","watch.lua","operatorBuilders.lua","systemIO.lua","../luau/out/release/xpexec.lua","cIO.lua","depfile.lua","luaIO.lua","luaDeps.lua"}},["luaIO.dependencies/b96b54e8fad30e1b4e178521af83006d98d97588"]={buildName="luaIO.dependencies/13",graphKey="luaIO.dependencies/c6117e72592f09401046ee1de92865ef0630b02b",outputs={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="a00d42a11fbcf141902cc317b27fb2edec6d9b10",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["watch.lua"]="520a2b61940d40ca11a66fe80d7a46ccf314c0e7"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["watch_q.lua"]={ctime=1792191937960881076,inode=1171745,mtime=1792191937960881076,sha1="3920d4034fe77993b09c2768364ba440cfd55230",size=1496.0}},valid=true,value={"watch.lua","../luau/out/release/xpio.lua","../luau/out/release/thread.lua","../luau/out/release/heap.lua","../luau/out/release/object.lua","../luau/out/release/queue.lua","../luau/out/release/lfsu.lua","../luau/out/release/fsu.lua","../luau/out/release/qtest.lua"}},["luaIO.dependencies/bbb5b296382df4b196b3cb1a9cc85e2bdbd47db3"]={buildName="luaIO.dependencies/3",graphKey="luaIO.dependencies/2d431693da6ff566383e0fca84b69d21f06ffa9c",outputs={["path.lua"]="8751ec30bef97d22f0e6d4d1e2dec68ec6598906"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["path_q.lua"]={ctime=1792189296974501830,inode=1172927,mtime=1454600802000000000,sha1="1d7c268d71a8d5e6a2b7ba8a4d04707419d34563",size=2011.0}},valid=true,value={"path.lua"}},["luaIO.dependencies/c085ce8a2cb1d413037e09a4d3f3794e6f6459fb"]={buildName="luaIO.dependencies/7",graphKey="luaIO.dependencies/43c9e1ff0d27fb2172f958f6e7676932b6668a83",outputs={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["../luau/out/release/xpexec.lua"]="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["cas.lua"]="905162315e897801411fba11c0ea5708298b0123",["flake.lua"]="c311ff3d27f62fcf02fc0d44b2fc42fef3fdb02b",["jobserver.lua"]="9dfb70d1f76759a900fc1f5dc1075fe313c89551",["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704",["systemIO.lua"]="18e1d46da8f9b587097386350daffe9c6ff6e266",["trace.lua"]="46db5162fad787c0fe275d4cbd64d16266ca03fa"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["systemIO_q.lua"]={ctime=1792192040796638174,inode=1173023,mtime=1792192040796638174,sha1="2156a919439ea327f60c447eaf1b39e9a62d68e9",size=1609.0}},valid=true,value={"systemIO.lua","../luau/out/release/xpexec.lua","../luau/out/release/thread.lua","../luau/out/release/xpio.lua","../luau/out/release/heap.lua","../luau/out/release/object.lua","../luau/out/release/queue.lua","../luau/out/release/lfsu.lua","../luau/out/release/fsu.lua","../luau/out/release/list.lua","../luau/out/release/serialize.lua","trace.lua","flake.lua","operator.lua","jobserver.lua","cas.lua"}},["luaIO.dependencies/c6fa1fa1c09a5573a0a24feaeb7db397c82a0040"]={buildName="luaIO.dependencies/15",graphKey="luaIO.dependencies/787b0a2b70920e3add0d5f45ca22bbfbd99f01a9",outputs={["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["depfile.lua"]="6495bf986ec19a1edf9e731f4870db069b6fdb28"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["depfile_q.lua"]={ctime=1792191937994889047,inode=1171747,mtime=1792191937994889047,sha1="0536168b8a56a0c81cab99de4fe26e45a622b8df",size=765.0}},valid=true,value={"depfile.lua","../luau/out/release/qtest.lua"}},["luaIO.dependencies/da12d365d9e5f87b7b90dcb73a810c336876089f"]={buildName="luaIO.dependencies/11",graphKey="luaIO.dependencies/e0c187987b0fe0c6f0cab0f7a5d0ce39b05b125e",outputs={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["trace.lua"]="46db5162fad787c0fe275d4cbd64d16266ca03fa"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["trace_q.lua"]={ctime=1792191937918388369,inode=1171739,mtime=1792191937918388369,sha1="b0459b19c87e192079063d4c690cacb51e0b8117",size=1358.0}},valid=true,value={"trace.lua","../luau/out/release/xpio.lua","../luau/out/release/lfsu.lua","../luau/out/release/fsu.lua","../luau/out/release/qtest.lua"}},["luaIO.program/00b0e506d410910aeacfedd591ffdd856e28092d"]={buildName="luaIO.program/13",graphKey="luaIO.program/c0ad2a46f738462b21b87394dd1692bd291a0319",outputs={["out/release/flake"]="989f49f76d45213b238e8bc233fd8f2ca7068b06"},sources={["../luau/out/release/fsu.lua"]={ctime=1792193739768282628,inode=1172883,mtime=1792193739768282628,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/getopts.lua"]={ctime=1792193739770667003,inode=1172891,mtime=1792193739770667003,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["../luau/out/release/heap.lua"]={ctime=1792193739769486822,inode=1172884,mtime=1792193739769486822,sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",size=2247.0},["../luau/out/release/lfsu.lua"]={ctime=1792193739767190190,inode=1172885,mtime=1792193739767190190,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792193739768927259,inode=1172893,mtime=1792193739768927259,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792193739768092231,inode=1172892,mtime=1792193739768092231,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792193739770442903,inode=1172888,mtime=1792193739770442903,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792193739769269154,inode=1172887,mtime=1792193739769269154,sha1="234987dd976d4d2e0cebea53433f2dd70f842ef0",size=7843.0},["../luau/out/release/thread.lua"]={ctime=1792193739768670542,inode=1172879,mtime=1792193739768670542,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpexec.lua"]={ctime=1792193739769951730,inode=1172882,mtime=1792193739769951730,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpfs.lib"]={ctime=1792193739768479752,inode=1172880,mtime=1792193739768479752,sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",size=12502.0},["../luau/out/release/xpio.lua"]={ctime=1792193739769645902,inode=1172889,mtime=1792193739769645902,sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c",size=8617.0},["../luau/out/release/xpio_c.lib"]={ctime=1792193739770980132,inode=1172881,mtime=1792193739770980132,sha1="7bcbb72a5f5df30833e5128f85601bfa6dc2f740",size=71600.0},["../sha1/out/release/libsha1.lib"]={ctime=1792191994992828894,inode=1180162,mtime=1792191994992828894,sha1="c866a804fc304f5284871a8bfcc2266b62a9d754",size=21290.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792189296969745043,inode=1172787,mtime=1792181609000000000,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792191938079086364,inode=1171564,mtime=1792191938079086364,sha1="4708c6e4b6ae93923d1252869c9a7e430b0b6c69",size=3076.0},["cIO.lua"]={ctime=1792193518675934399,inode=1171970,mtime=1792193518675934399,sha1="6aab33dae0a0eb3b3048cf5a9227745c84c524d6",size=19585.0},["cas.lua"]={ctime=1792193466807941957,inode=1171724,mtime=1792193466807941957,sha1="52f301f31133a70da688cb5fcb583fde6d0c627f",size=10081.0},["compilerCache.lua"]={ctime=1792191938055802317,inode=1171751,mtime=1792191938055802317,sha1="c14d822d99746db5cabe88a508677dd8f7ef88f9",size=3311.0},["daemon.lua"]={ctime=1792193089217342998,inode=1171741,mtime=1792193089217342998,sha1="10eaf1e73fd8535a95c7d89e483c6afc8948271a",size=7017.0},["depfile.lua"]={ctime=1792191937994718588,inode=1171746,mtime=1792191937994718588,sha1="6495bf986ec19a1edf9e731f4870db069b6fdb28",size=1782.0},["flake.lua"]={ctime=1792193208440322150,inode=1171532,mtime=1792193208440322150,sha1="f6d0e2ab6e676886f77b0d0adfa6629a6edc1161",size=41260.0},["flakeOpts.lua"]={ctime=1792191938063840443,inode=1171533,mtime=1792191938063840443,sha1="7b3f41f3384ce6b6ffe10a5991e7f64b49ef8e34",size=3306.0},["jobserver.lua"]={ctime=1792193662377535188,inode=1171717,mtime=1792193662377535188,sha1="81ba9b9adb7a4ae0ac5c344ce9609b115cd84698",size=5963.0},["listBuilders.lua"]={ctime=1792189297018152350,inode=1173003,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792189296974501830,inode=1172925,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={ctime=1792193737001307243,inode=1173026,mtime=1792193737001307243,sha1="743b1a60add2c9fb6dda0c3934205190ece6acda",size=804405.0},["luaIO.lua"]={ctime=1792191931884820980,inode=1171568,mtime=1792191931884820980,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792193352812502947,inode=1171974,mtime=1792193352812502947,sha1="ed0c6f2d66ece76985ccb786ddb02a4ab80d9f94",size=10781.0},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792189297021741360,inode=1173016,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792189297018152350,inode=1173001,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792191937955840437,inode=1171571,mtime=1792191937955840437,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0},["remoteCache.lua"]={ctime=1792193616368411999,inode=1171728,mtime=1792193616368411999,sha1="223200e6f8533155fe154082b38fe6dba7978e94",size=11792.0},["system.lua"]={ctime=1792189297021741360,inode=1173020,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792192031760256930,inode=1171573,mtime=1792192031760256930,sha1="18e1d46da8f9b587097386350daffe9c6ff6e266",size=6261.0},["trace.lua"]={ctime=1792191937918388369,inode=1171738,mtime=1792191937918388369,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0},["watch.lua"]={ctime=1792192480937195756,inode=1171744,mtime=1792192480937195756,sha1="4bd7f55121dc476f7e9e494449435d17551fc589",size=3807.0}},valid=true,value="out/release/flake"},["luaIO.program/0d23c3b6e287628ef03938d09754475763644992"]={buildName="luaIO.program/3",sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/getopts.lua"]={sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25"},["../luau/out/release/heap.lua"]={sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="e308397572e2d90a669adcab61992c9b063998ba"},["../luau/out/release/xpexec.lua"]={sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc"},["../luau/out/release/xpfs.lib"]={sha1="1152765a4d21895132f5ddf5fc2b6ccd218b936d"},["../luau/out/release/xpio.lua"]={sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04"},["../luau/out/release/xpio_c.lib"]={sha1="6e548dcb33cf8f6ad5761335a8dbb47d93c66b92"},["../sha1/out/release/libsha1.lib"]={ctime=1792181906048736297,inode=1172952,mtime=1792181906048736297,sha1="63b71a0e3095e2a26668666dff7b4a0a835e8152",size=21378.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792182355545870864,inode=1171521,mtime=1792182355541525963,sha1="e9df8b5dfda9e05668b9fcf710c6ee67e0307365",size=300304.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792181609575202119,inode=1172718,mtime=1792181609575202119,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792179886741954590,inode=1171503,mtime=1454600802000000000,sha1="c2a0222e97c7bd9ec3fee83ccffaf30d6802886e",size=1298.0},["cIO.lua"]={ctime=1792179886741954590,inode=1171504,mtime=1454600802000000000,sha1="4a82c697686edc9397c2a5577cd31aeab0a963db",size=3582.0},["flake.lua"]={ctime=1792182339816163458,inode=1171505,mtime=1792182339816163458,sha1="8b688cc50e56bcf47991e64092d194fad9b4666e",size=22534.0},["flakeOpts.lua"]={ctime=1792182069772241118,inode=1171507,mtime=1792182069772241118,sha1="197ceb951c211d5b425124771cc188dc88329b33",size=1986.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["listBuilders.lua"]={ctime=1792179886741954590,inode=1171509,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792179886741954590,inode=1171510,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={sha1="743b1a60add2c9fb6dda0c3934205190ece6acda"},["luaIO.lua"]={ctime=1792181894054384821,inode=1171511,mtime=1792181894054384821,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792182069772671881,inode=1171512,mtime=1792182069772671881,sha1="8744f39d837802d26efda8dda426b001f3ab6915",size=6576.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792179886741954590,inode=1171514,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792179886741954590,inode=1171516,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792179886741954590,inode=1171518,mtime=1454600802000000000,sha1="b30ad3fc1b9ae3060830be02e5ea79820138ba25",size=1672.0},["system.lua"]={ctime=1792179886741954590,inode=1171520,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792182339815685902,inode=1172148,mtime=1792182339815685902,sha1="c36fb663726e543bdbbf9724766b622879100f98",size=5396.0}},valid=true,value="out/release/flake"},["luaIO.program/14335a66345555237e03182d494f53636381ec48"]={buildName="luaIO.program/2",sources={["../luau/out/release/fsu.lua"]={ctime=1792182076753191350,inode=1172914,mtime=1792182076753191350,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/getopts.lua"]={ctime=1792182076753786747,inode=1172923,mtime=1792182076753786747,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["../luau/out/release/heap.lua"]={ctime=1792182076752012919,inode=1172912,mtime=1792182076752012919,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792182076752411769,inode=1172922,mtime=1792182076752411769,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792182076753564274,inode=1172924,mtime=1792182076753564274,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792182076752305938,inode=1172925,mtime=1792182076752305938,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792182076753983400,inode=1172921,mtime=1792182076753983400,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792182076752554405,inode=1172919,mtime=1792182076752554405,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792182076753901907,inode=1172916,mtime=1792182076753901907,sha1="e308397572e2d90a669adcab61992c9b063998ba",size=8086.0},["../luau/out/release/xpexec.lua"]={ctime=1792182076752196817,inode=1172920,mtime=1792182076752196817,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpfs.lib"]={ctime=1792182076753439627,inode=1172911,mtime=1792182076753439627,sha1="ffd7e786ee473fd71b658936aec85c6de537a38d",size=10558.0},["../luau/out/release/xpio.lua"]={ctime=1792182076753315696,inode=1172915,mtime=1792182076753315696,sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",size=6703.0},["../luau/out/release/xpio_c.lib"]={ctime=1792182076752832369,inode=1172913,mtime=1792182076752832369,sha1="92918c70ad54f206e01c4b899262d21cc020ecce",size=51544.0},["../sha1/out/release/libsha1.lib"]={ctime=1792181906048736297,inode=1172952,mtime=1792181906048736297,sha1="63b71a0e3095e2a26668666dff7b4a0a835e8152",size=21378.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792182075985356496,inode=1171521,mtime=1792182075981525963,sha1="0deaa0a4dca6f5dc70578cc831311926e7bf87b8",size=300152.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792181609575202119,inode=1172718,mtime=1792181609575202119,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792179886741954590,inode=1171503,mtime=1454600802000000000,sha1="c2a0222e97c7bd9ec3fee83ccffaf30d6802886e",size=1298.0},["cIO.lua"]={ctime=1792179886741954590,inode=1171504,mtime=1454600802000000000,sha1="4a82c697686edc9397c2a5577cd31aeab0a963db",size=3582.0},["flake.lua"]={ctime=1792182069773212097,inode=1171505,mtime=1792182069773212097,sha1="facbd578d157d3d83d8c78d2c1e393d5d1d25ca8",size=22378.0},["flakeOpts.lua"]={ctime=1792182069772241118,inode=1171507,mtime=1792182069772241118,sha1="197ceb951c211d5b425124771cc188dc88329b33",size=1986.0},["listBuilders.lua"]={ctime=1792179886741954590,inode=1171509,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792179886741954590,inode=1171510,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={sha1="743b1a60add2c9fb6dda0c3934205190ece6acda"},["luaIO.lua"]={ctime=1792181894054384821,inode=1171511,mtime=1792181894054384821,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792182069772671881,inode=1171512,mtime=1792182069772671881,sha1="8744f39d837802d26efda8dda426b001f3ab6915",size=6576.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792179886741954590,inode=1171514,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792179886741954590,inode=1171516,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792179886741954590,inode=1171518,mtime=1454600802000000000,sha1="b30ad3fc1b9ae3060830be02e5ea79820138ba25",size=1672.0},["system.lua"]={ctime=1792179886741954590,inode=1171520,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792182075187324202,inode=1172148,mtime=1792182075187324202,sha1="9876c68729adf27a1e32a9cd3cc8f6f696ed12e0",size=5286.0}},valid=true,value="out/release/flake"},["luaIO.program/2bcdd6638e2bc1cdfca0f5aa163f6c406d53b043"]={buildName="luaIO.program/6",sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/getopts.lua"]={sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25"},["../luau/out/release/heap.lua"]={sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpexec.lua"]={sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc"},["../luau/out/release/xpfs.lib"]={sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be"},["../luau/out/release/xpio.lua"]={sha1="6551921686861ea121658b2423bcc2ddf8b8f207"},["../luau/out/release/xpio_c.lib"]={sha1="168961c940a098eec50d69aec1751dadb5a95576"},["../sha1/out/release/libsha1.lib"]={ctime=1792184234215399797,inode=1172952,mtime=1792184234215399797,sha1="c866a804fc304f5284871a8bfcc2266b62a9d754",size=21290.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792184331451580714,inode=1171521,mtime=1792184331451546956,sha1="b8dbd3aec0b86ad22e88cd1395e05edd819d8814",size=305024.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792181609575202119,inode=1172718,mtime=1792181609575202119,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792179886741954590,inode=1171503,mtime=1454600802000000000,sha1="c2a0222e97c7bd9ec3fee83ccffaf30d6802886e",size=1298.0},["cIO.lua"]={ctime=1792179886741954590,inode=1171504,mtime=1454600802000000000,sha1="4a82c697686edc9397c2a5577cd31aeab0a963db",size=3582.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["flake.lua"]={ctime=1792184237347814661,inode=1172825,mtime=1792184237347814661,sha1="64fdd886952672467e3f12b5fdc035d39c5429fa",size=30908.0},["flakeOpts.lua"]={ctime=1792184202809525963,inode=1171507,mtime=1792184202809525963,sha1="b27820370963d092c58b2857254f6b52ff5d7f32",size=2545.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["listBuilders.lua"]={ctime=1792179886741954590,inode=1171509,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792179886741954590,inode=1171510,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={ctime=1792184331505765103,inode=1172225,mtime=1792184331505765103,sha1="743b1a60add2c9fb6dda0c3934205190ece6acda",size=804405.0},["luaIO.lua"]={ctime=1792181894054384821,inode=1171511,mtime=1792181894054384821,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792184202813568689,inode=1172134,mtime=1792184202813568689,sha1="c6099b49fa8dab837a1b265ebc57b7f09dc9daa1",size=7478.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792179886741954590,inode=1171514,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792179886741954590,inode=1171516,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792179886741954590,inode=1171518,mtime=1454600802000000000,sha1="b30ad3fc1b9ae3060830be02e5ea79820138ba25",size=1672.0},["remoteCache.lua"]={ctime=1792183805097674884,inode=1171512,mtime=1792183805097674884,sha1="24d76dc2e0190443d23f509ad723e6d626e3ea2a",size=8347.0},["system.lua"]={ctime=1792179886741954590,inode=1171520,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792184180554465389,inode=1172148,mtime=1792184180554465389,sha1="4a0125a0f8600eac940621dde46f4e984b154563",size=5743.0},["trace.lua"]={ctime=1792184137937463082,inode=1172069,mtime=1792184137937463082,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="out/release/flake"},["luaIO.program/2ee83cbef396918a45342598e80eb12625f9b859"]={buildName="luaIO.program/1",graphKey="luaIO.program/447f366267b6d4f4c2b6077f53539a62ea40ed4c",outputs={[".flake/luaIO.program/1/interpreter"]="bbdd5a3df68b0b750c860f6609d4583261c506de"},sources={["../luau/out/release/xpfs.lib"]={sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be"},["../luau/out/release/xpio_c.lib"]={sha1="7bcbb72a5f5df30833e5128f85601bfa6dc2f740"},["../sha1/out/release/libsha1.lib"]={ctime=1792191994992828894,inode=1180162,mtime=1792191994992828894,sha1="c866a804fc304f5284871a8bfcc2266b62a9d754",size=21290.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792193736919784664,inode=1179667,mtime=1792193736915947372,sha1="0687baf1ff76a73f31dda592ff337a3607333bef",size=314696.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792189296969745043,inode=1172787,mtime=1792181609000000000,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0}},valid=true,value=".flake/luaIO.program/1/interpreter"},["luaIO.program/48ee39e0802ebf63510c6e1f51a74cdd579863f8"]={buildName="luaIO.program/10",outputs={["out/release/flake"]="7975daf58c49f35b30971598e577abe45573d28d"},sources={["../luau/out/release/fsu.lua"]={ctime=1792189296973453132,inode=1172883,mtime=1792184673000000000,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/getopts.lua"]={ctime=1792189296973453132,inode=1172891,mtime=1792184673000000000,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["../luau/out/release/heap.lua"]={ctime=1792189296973453132,inode=1172884,mtime=1792184673000000000,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792189296973453132,inode=1172885,mtime=1792184673000000000,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792189296973453132,inode=1172893,mtime=1792184673000000000,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792189296973453132,inode=1172892,mtime=1792184673000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792189296973453132,inode=1172888,mtime=1792184673000000000,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792189296973453132,inode=1172887,mtime=1792184673000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792189296973453132,inode=1172879,mtime=1792184673000000000,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpexec.lua"]={ctime=1792189296973453132,inode=1172882,mtime=1792184673000000000,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpfs.lib"]={ctime=1792189296973453132,inode=1172880,mtime=1792184673000000000,sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",size=12502.0},["../luau/out/release/xpio.lua"]={ctime=1792189296973453132,inode=1172889,mtime=1792184673000000000,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},["../luau/out/release/xpio_c.lib"]={ctime=1792189296973453132,inode=1172881,mtime=1792184673000000000,sha1="0e42f853240e8e583d4b66bcbc4103269e5f7d51",size=63264.0},["../sha1/out/release/libsha1.lib"]={ctime=1792189297024353316,inode=1180162,mtime=1792184234000000000,sha1="c866a804fc304f5284871a8bfcc2266b62a9d754",size=21290.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792189297018463715,inode=1180103,mtime=1792184671000000000,sha1="282e065ce5aa3a546131ecae1502dd875b5457e2",size=305416.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792189296969745043,inode=1172787,mtime=1792181609000000000,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792189296974501830,inode=1172931,mtime=1792185196000000000,sha1="999ecf26da199f70c3f569baf835908f379d842a",size=3020.0},["cIO.lua"]={ctime=1792189297021741360,inode=1173009,mtime=1792185285000000000,sha1="6e92e2d84702b2624ab61400256fbb57bdb78056",size=9717.0},["cas.lua"]={ctime=1792189296974501830,inode=1172920,mtime=1792182711000000000,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["daemon.lua"]={ctime=1792189297021741360,inode=1173008,mtime=1792184612000000000,sha1="c6b3166fca0d53effaa2e42b4411427b06e3e61d",size=6132.0},["flake.lua"]={ctime=1792189296974501830,inode=1172924,mtime=1792185010000000000,sha1="fa66f8abebc80207806c32de1efc469d92cbfd84",size=36874.0},["flakeOpts.lua"]={ctime=1792189296974501830,inode=1172923,mtime=1792184669000000000,sha1="e0d9e2b220280e67495e5772e81b5030539a7d15",size=3008.0},["jobserver.lua"]={ctime=1792189296974501830,inode=1172932,mtime=1792182332000000000,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["listBuilders.lua"]={ctime=1792189297018152350,inode=1173003,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792189296974501830,inode=1172925,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={sha1="743b1a60add2c9fb6dda0c3934205190ece6acda"},["luaIO.lua"]={ctime=1792189297021741360,inode=1173018,mtime=1792181894000000000,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792189297021741360,inode=1173013,mtime=1792184669000000000,sha1="d5ff35b178b7d32164141e30a2770eaae2a1ef99",size=9593.0},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792189297021741360,inode=1173016,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792189297018152350,inode=1173001,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792189297018463715,inode=1173005,mtime=1792184612000000000,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0},["remoteCache.lua"]={ctime=1792189297021741360,inode=1173017,mtime=1792183805000000000,sha1="24d76dc2e0190443d23f509ad723e6d626e3ea2a",size=8347.0},["system.lua"]={ctime=1792189297021741360,inode=1173020,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792189297021741360,inode=1173025,mtime=1792184180000000000,sha1="4a0125a0f8600eac940621dde46f4e984b154563",size=5743.0},["trace.lua"]={ctime=1792189297021741360,inode=1173022,mtime=1792184137000000000,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0},["watch.lua"]={ctime=1792189297021741360,inode=1173024,mtime=1792184658000000000,sha1="520a2b61940d40ca11a66fe80d7a46ccf314c0e7",size=3573.0}},valid=true,value="out/release/flake"},["luaIO.program/50b2cb21bb5fe751fd70974f78fac1060de2bf27"]={buildName="luaIO.program/5",sources={["../luau/out/release/fsu.lua"]={ctime=1792184080570749217,inode=1172914,mtime=1792184080570749217,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/getopts.lua"]={ctime=1792184080571498402,inode=1172923,mtime=1792184080571498402,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["../luau/out/release/heap.lua"]={ctime=1792184080568453229,inode=1172912,mtime=1792184080568453229,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184080567576066,inode=1172922,mtime=1792184080567576066,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792184080568773663,inode=1172924,mtime=1792184080568773663,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792184080567214460,inode=1172925,mtime=1792184080567214460,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792184080570561276,inode=1172921,mtime=1792184080570561276,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184080572139347,inode=1172919,mtime=1792184080572139347,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184080569844405,inode=1172916,mtime=1792184080569844405,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpexec.lua"]={ctime=1792184080570296480,inode=1172920,mtime=1792184080570296480,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpfs.lib"]={ctime=1792184080569590074,inode=1172911,mtime=1792184080569590074,sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",size=12502.0},["../luau/out/release/xpio.lua"]={ctime=1792184080570065059,inode=1172915,mtime=1792184080570065059,sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",size=6703.0},["../luau/out/release/xpio_c.lib"]={ctime=1792184080569059035,inode=1172913,mtime=1792184080569059035,sha1="6e548dcb33cf8f6ad5761335a8dbb47d93c66b92",size=52600.0},["../sha1/out/release/libsha1.lib"]={ctime=1792182756815413956,inode=1172952,mtime=1792182756815413956,sha1="c866a804fc304f5284871a8bfcc2266b62a9d754",size=21290.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792182756481050035,inode=1171521,mtime=1792182756481012690,sha1="560c6cd8bb53e24baf8e75638f86fa5930ab48d6",size=300464.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792181609575202119,inode=1172718,mtime=1792181609575202119,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792179886741954590,inode=1171503,mtime=1454600802000000000,sha1="c2a0222e97c7bd9ec3fee83ccffaf30d6802886e",size=1298.0},["cIO.lua"]={ctime=1792179886741954590,inode=1171504,mtime=1454600802000000000,sha1="4a82c697686edc9397c2a5577cd31aeab0a963db",size=3582.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["flake.lua"]={ctime=1792184095596966900,inode=1172808,mtime=1792184095596966900,sha1="eb406e7cd82a3c82b84f812974f806f949b22846",size=30089.0},["flakeOpts.lua"]={ctime=1792182719554834770,inode=1171507,mtime=1792182719554834770,sha1="546bf54bbe3755c30403f19bc346c83f27542be7",size=2414.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["listBuilders.lua"]={ctime=1792179886741954590,inode=1171509,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792179886741954590,inode=1171510,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={sha1="743b1a60add2c9fb6dda0c3934205190ece6acda"},["luaIO.lua"]={ctime=1792181894054384821,inode=1171511,mtime=1792181894054384821,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792182732218857308,inode=1172134,mtime=1792182732218857308,sha1="ba4d21a4249dc4d2e776747b6d5d75b0bea78f22",size=7291.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792179886741954590,inode=1171514,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792179886741954590,inode=1171516,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792179886741954590,inode=1171518,mtime=1454600802000000000,sha1="b30ad3fc1b9ae3060830be02e5ea79820138ba25",size=1672.0},["remoteCache.lua"]={ctime=1792183805097674884,inode=1171512,mtime=1792183805097674884,sha1="24d76dc2e0190443d23f509ad723e6d626e3ea2a",size=8347.0},["system.lua"]={ctime=1792179886741954590,inode=1171520,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792184038420899402,inode=1172148,mtime=1792184038420899402,sha1="14eabcfd03a23130ac91e03ddbdce569645dadcc",size=5487.0}},valid=true,value="out/release/flake"},["luaIO.program/68f0412cac13116ea84dbf0059b0ca004f9252c9"]={buildName="luaIO.program/12",sources={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/getopts.lua"]="41a0b573b7144c50cac86d2083f3ccfb3438ad25",["../luau/out/release/heap.lua"]="a00d42a11fbcf141902cc317b27fb2edec6d9b10",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="cc23fc22c91b8e54da1aeccf5d77b3f4f00259a8",["../luau/out/release/xpexec.lua"]="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",["../luau/out/release/xpfs.lib"]="c91007d29f15e2a9dbc3b319c5b8b12e4c213864",["../luau/out/release/xpio.lua"]="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",["../luau/out/release/xpio_c.lib"]="5331d579a945811ce171145cc3a6abe8008cea2f",["../sha1/out/release/libsha1.lib"]="341ee9cfaca2e0b24d2220e5446a007a0597726e",["/root/repo/flake/out/boot/xplua"]="43f1860fe7411482396ead1c31826adc57b610d4",["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]="9070a1e713f5026ba0867eec83fe7bec53538aac",["c.lua"]="c2a0222e97c7bd9ec3fee83ccffaf30d6802886e",["cIO.lua"]="4a82c697686edc9397c2a5577cd31aeab0a963db",["flake.lua"]="5c5bf9f5c4167ab0182e15b1f46ee0ec96c5c877",["flakeOpts.lua"]="7477a6044e33fe17cd6914a136aa279cd7c4b3e2",["listBuilders.lua"]="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",["lua.lua"]="351e44997b41dd5dda00ab72e3741c3ca55abc78",["luaDeps.lua"]="743b1a60add2c9fb6dda0c3934205190ece6acda",["luaIO.lua"]="ade1b48b5928c61a9e1b421e24d7e1c4963223ee",["main.lua"]="a5802c8e4f2fb6eec9c88b12ac04edcdd4bd3575",["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704",["operatorBuilders.lua"]="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",["path.lua"]="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",["process.lua"]="b30ad3fc1b9ae3060830be02e5ea79820138ba25",["system.lua"]="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",["systemIO.lua"]="3f58a4c7edf85525a431614edee081a5d21b990a"},valid=true,value="out/release/flake"},["luaIO.program/6a2e0c5f0114d8f9f6fae73bcf7e1940f647ed69"]={buildName="luaIO.program/11",outputs={["out/release/flake"]="c75fd82949d88ac5b3323a7c41a33efdf2177bed"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/getopts.lua"]={sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpexec.lua"]={sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc"},["../luau/out/release/xpfs.lib"]={sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},["../luau/out/release/xpio_c.lib"]={sha1="5c6f60488301dca811f1e07511c8e0217cab9c60"},["../sha1/out/release/libsha1.lib"]={ctime=1792189297024353316,inode=1180162,mtime=1792184234000000000,sha1="c866a804fc304f5284871a8bfcc2266b62a9d754",size=21290.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792190928544867262,inode=1180103,mtime=1792190928544846200,sha1="d9571976f1a00ef0653c1400e7198072ba5da26c",size=314640.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792189296969745043,inode=1172787,mtime=1792181609000000000,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792190376187499619,inode=1172931,mtime=1792190376187499619,sha1="4708c6e4b6ae93923d1252869c9a7e430b0b6c69",size=3076.0},["cIO.lua"]={ctime=1792190412985920389,inode=1171537,mtime=1792190412985920389,sha1="4c699565eefb7a77b195821d8ce30e89858d30ba",size=17882.0},["cas.lua"]={ctime=1792189296974501830,inode=1172920,mtime=1792182711000000000,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["compilerCache.lua"]={ctime=1792190043693486996,inode=1173014,mtime=1792190043693486996,sha1="c14d822d99746db5cabe88a508677dd8f7ef88f9",size=3311.0},["daemon.lua"]={ctime=1792189297021741360,inode=1173008,mtime=1792184612000000000,sha1="c6b3166fca0d53effaa2e42b4411427b06e3e61d",size=6132.0},["depfile.lua"]={ctime=1792189297021741360,inode=1173011,mtime=1792184865000000000,sha1="6495bf986ec19a1edf9e731f4870db069b6fdb28",size=1782.0},["flake.lua"]={ctime=1792190229282124653,inode=1172924,mtime=1792190229282124653,sha1="a704227dd6283afaa2de40556fdf3a7671e453b4",size=37124.0},["flakeOpts.lua"]={ctime=1792190229282306514,inode=1172923,mtime=1792190229282306514,sha1="7b3f41f3384ce6b6ffe10a5991e7f64b49ef8e34",size=3306.0},["jobserver.lua"]={ctime=1792189296974501830,inode=1172932,mtime=1792182332000000000,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["listBuilders.lua"]={ctime=1792189297018152350,inode=1173003,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792189296974501830,inode=1172925,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={ctime=1792190997420231159,inode=1173026,mtime=1792190997420231159,sha1="743b1a60add2c9fb6dda0c3934205190ece6acda",size=804405.0},["luaIO.lua"]={ctime=1792189297021741360,inode=1173018,mtime=1792181894000000000,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792190229282489035,inode=1173013,mtime=1792190229282489035,sha1="eda02d424879e872af2310c642931475e44d65a4",size=9922.0},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792189297021741360,inode=1173016,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792189297018152350,inode=1173001,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792189297018463715,inode=1173005,mtime=1792184612000000000,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0},["remoteCache.lua"]={ctime=1792189297021741360,inode=1173017,mtime=1792183805000000000,sha1="24d76dc2e0190443d23f509ad723e6d626e3ea2a",size=8347.0},["system.lua"]={ctime=1792189297021741360,inode=1173020,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792190193575736746,inode=1173025,mtime=1792190193575736746,sha1="243be364a6655afbbc02806db6a034b9ac4266f7",size=5846.0},["trace.lua"]={ctime=1792189297021741360,inode=1173022,mtime=1792184137000000000,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0},["watch.lua"]={ctime=1792189297021741360,inode=1173024,mtime=1792184658000000000,sha1="520a2b61940d40ca11a66fe80d7a46ccf314c0e7",size=3573.0}},valid=true,value="out/release/flake"},["luaIO.program/7b76554a941623e3bbeb1517f70201e35c693101"]={buildName="luaIO.program/7",sources={["../luau/out/release/fsu.lua"]={ctime=1792184332603349430,inode=1172914,mtime=1792184332603349430,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/getopts.lua"]={ctime=1792184332604746589,inode=1172923,mtime=1792184332604746589,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["../luau/out/release/heap.lua"]={ctime=1792184332604607246,inode=1172912,mtime=1792184332604607246,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184332603518710,inode=1172922,mtime=1792184332603518710,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792184332603656828,inode=1172924,mtime=1792184332603656828,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792184332604218227,inode=1172925,mtime=1792184332604218227,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792184332604062956,inode=1172921,mtime=1792184332604062956,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184332603854146,inode=1172919,mtime=1792184332603854146,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184332605489010,inode=1172916,mtime=1792184332605489010,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpexec.lua"]={ctime=1792184332602918831,inode=1172920,mtime=1792184332602918831,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpfs.lib"]={ctime=1792184332603148248,inode=1172911,mtime=1792184332603148248,sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",size=12502.0},["../luau/out/release/xpio.lua"]={ctime=1792184332604384586,inode=1172915,mtime=1792184332604384586,sha1="6551921686861ea121658b2423bcc2ddf8b8f207",size=7603.0},["../luau/out/release/xpio_c.lib"]={ctime=1792184332604939470,inode=1172913,mtime=1792184332604939470,sha1="168961c940a098eec50d69aec1751dadb5a95576",size=60248.0},["../sha1/out/release/libsha1.lib"]={ctime=1792184234215399797,inode=1172952,mtime=1792184234215399797,sha1="c866a804fc304f5284871a8bfcc2266b62a9d754",size=21290.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792184331451580714,inode=1171521,mtime=1792184331451546956,sha1="b8dbd3aec0b86ad22e88cd1395e05edd819d8814",size=305024.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792181609575202119,inode=1172718,mtime=1792181609575202119,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792179886741954590,inode=1171503,mtime=1454600802000000000,sha1="c2a0222e97c7bd9ec3fee83ccffaf30d6802886e",size=1298.0},["cIO.lua"]={ctime=1792179886741954590,inode=1171504,mtime=1454600802000000000,sha1="4a82c697686edc9397c2a5577cd31aeab0a963db",size=3582.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["daemon.lua"]={ctime=1792184423561842900,inode=1172139,mtime=1792184423561842900,sha1="df3d2a7cadc1b99ebe186840d62eccb6723f3df1",size=6026.0},["flake.lua"]={ctime=1792184398426216566,inode=1172825,mtime=1792184398426216566,sha1="e2da56cbee2cf5c777afb0fd63c3203ac2b6e03d",size=31948.0},["flakeOpts.lua"]={sha1="dea223a77906f3dd2bdc8bc0a43108759adcc12a"},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["listBuilders.lua"]={ctime=1792179886741954590,inode=1171509,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792179886741954590,inode=1171510,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={sha1="743b1a60add2c9fb6dda0c3934205190ece6acda"},["luaIO.lua"]={ctime=1792181894054384821,inode=1171511,mtime=1792181894054384821,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792184438583385549,inode=1172134,mtime=1792184438583385549,sha1="868b5a6eeb96bfc8fb9a614502513721152bfba1",size=8434.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792179886741954590,inode=1171514,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792179886741954590,inode=1171516,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792179886741954590,inode=1171518,mtime=1454600802000000000,sha1="b30ad3fc1b9ae3060830be02e5ea79820138ba25",size=1672.0},["remoteCache.lua"]={ctime=1792183805097674884,inode=1171512,mtime=1792183805097674884,sha1="24d76dc2e0190443d23f509ad723e6d626e3ea2a",size=8347.0},["system.lua"]={ctime=1792179886741954590,inode=1171520,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792184180554465389,inode=1172148,mtime=1792184180554465389,sha1="4a0125a0f8600eac940621dde46f4e984b154563",size=5743.0},["trace.lua"]={ctime=1792184137937463082,inode=1172069,mtime=1792184137937463082,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="out/release/flake"},["luaIO.program/8655928e5d9e895dbb6b6d82b1f0e76cb82e4c36"]={buildName="luaIO.program/4",sources={["../luau/out/release/fsu.lua"]={ctime=1792182549165521160,inode=1172914,mtime=1792182549165521160,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/getopts.lua"]={ctime=1792182549164033046,inode=1172923,mtime=1792182549164033046,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["../luau/out/release/heap.lua"]={ctime=1792182549166201330,inode=1172912,mtime=1792182549166201330,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792182549164487668,inode=1172922,mtime=1792182549164487668,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792182549165866599,inode=1172924,mtime=1792182549165866599,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792182549163802808,inode=1172925,mtime=1792182549163802808,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792182549165407685,inode=1172921,mtime=1792182549165407685,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792182549166086788,inode=1172919,mtime=1792182549166086788,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792182549165973052,inode=1172916,mtime=1792182549165973052,sha1="e308397572e2d90a669adcab61992c9b063998ba",size=8086.0},["../luau/out/release/xpexec.lua"]={ctime=1792182549165637858,inode=1172920,mtime=1792182549165637858,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpfs.lib"]={ctime=1792182549164612479,inode=1172911,mtime=1792182549164612479,sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",size=12502.0},["../luau/out/release/xpio.lua"]={ctime=1792182549165762120,inode=1172915,mtime=1792182549165762120,sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",size=6703.0},["../luau/out/release/xpio_c.lib"]={ctime=1792182549165154775,inode=1172913,mtime=1792182549165154775,sha1="6e548dcb33cf8f6ad5761335a8dbb47d93c66b92",size=52600.0},["../sha1/out/release/libsha1.lib"]={ctime=1792181906048736297,inode=1172952,mtime=1792181906048736297,sha1="63b71a0e3095e2a26668666dff7b4a0a835e8152",size=21378.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792182546492399933,inode=1171521,mtime=1792182546492369961,sha1="0aeeda5b85644db620ed6299e33944226f092f0a",size=300464.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792181609575202119,inode=1172718,mtime=1792181609575202119,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792179886741954590,inode=1171503,mtime=1454600802000000000,sha1="c2a0222e97c7bd9ec3fee83ccffaf30d6802886e",size=1298.0},["cIO.lua"]={ctime=1792179886741954590,inode=1171504,mtime=1454600802000000000,sha1="4a82c697686edc9397c2a5577cd31aeab0a963db",size=3582.0},["cas.lua"]={ctime=1792182465616586376,inode=1172042,mtime=1792182465609525963,sha1="ced81d99acb57b21d0c0113340f975e67fc5492b",size=5276.0},["flake.lua"]={sha1="2f51a9429c964887206d4dc8d14244c61e2646a0"},["flakeOpts.lua"]={ctime=1792182526760462899,inode=1171507,mtime=1792182526760462899,sha1="46d0a2e481f77f3b81435650f767f1b4f5842278",size=2137.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["listBuilders.lua"]={ctime=1792179886741954590,inode=1171509,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792179886741954590,inode=1171510,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={sha1="743b1a60add2c9fb6dda0c3934205190ece6acda"},["luaIO.lua"]={ctime=1792181894054384821,inode=1171511,mtime=1792181894054384821,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792182531731003224,inode=1172134,mtime=1792182531731003224,sha1="0ed9bd98bdb7a66ef18dd011c9934c734cf9582c",size=6782.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792179886741954590,inode=1171514,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792179886741954590,inode=1171516,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792179886741954590,inode=1171518,mtime=1454600802000000000,sha1="b30ad3fc1b9ae3060830be02e5ea79820138ba25",size=1672.0},["system.lua"]={ctime=1792179886741954590,inode=1171520,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792182339815685902,inode=1172148,mtime=1792182339815685902,sha1="c36fb663726e543bdbbf9724766b622879100f98",size=5396.0}},valid=true,value="out/release/flake"},["luaIO.program/be5ad6984da2eb8a988cbb3e6588d34dc3ef91af"]={buildName="luaIO.program/8",sources={["../luau/out/release/fsu.lua"]={ctime=1792184332603349430,inode=1172914,mtime=1792184332603349430,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/getopts.lua"]={ctime=1792184332604746589,inode=1172923,mtime=1792184332604746589,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["../luau/out/release/heap.lua"]={ctime=1792184332604607246,inode=1172912,mtime=1792184332604607246,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184332603518710,inode=1172922,mtime=1792184332603518710,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792184332603656828,inode=1172924,mtime=1792184332603656828,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792184332604218227,inode=1172925,mtime=1792184332604218227,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792184332604062956,inode=1172921,mtime=1792184332604062956,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184332603854146,inode=1172919,mtime=1792184332603854146,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184332605489010,inode=1172916,mtime=1792184332605489010,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpexec.lua"]={ctime=1792184332602918831,inode=1172920,mtime=1792184332602918831,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpfs.lib"]={ctime=1792184332603148248,inode=1172911,mtime=1792184332603148248,sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",size=12502.0},["../luau/out/release/xpio.lua"]={ctime=1792184332604384586,inode=1172915,mtime=1792184332604384586,sha1="6551921686861ea121658b2423bcc2ddf8b8f207",size=7603.0},["../luau/out/release/xpio_c.lib"]={ctime=1792184332604939470,inode=1172913,mtime=1792184332604939470,sha1="168961c940a098eec50d69aec1751dadb5a95576",size=60248.0},["../sha1/out/release/libsha1.lib"]={ctime=1792184234215399797,inode=1172952,mtime=1792184234215399797,sha1="c866a804fc304f5284871a8bfcc2266b62a9d754",size=21290.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792184331451580714,inode=1171521,mtime=1792184331451546956,sha1="b8dbd3aec0b86ad22e88cd1395e05edd819d8814",size=305024.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792181609575202119,inode=1172718,mtime=1792181609575202119,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792179886741954590,inode=1171503,mtime=1454600802000000000,sha1="c2a0222e97c7bd9ec3fee83ccffaf30d6802886e",size=1298.0},["cIO.lua"]={ctime=1792179886741954590,inode=1171504,mtime=1454600802000000000,sha1="4a82c697686edc9397c2a5577cd31aeab0a963db",size=3582.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["daemon.lua"]={ctime=1792184513465582717,inode=1172139,mtime=1792184513465582717,sha1="25715c37f361556f49770da43b94d39a65c8250e",size=6376.0},["flake.lua"]={ctime=1792184398426216566,inode=1172825,mtime=1792184398426216566,sha1="e2da56cbee2cf5c777afb0fd63c3203ac2b6e03d",size=31948.0},["flakeOpts.lua"]={ctime=1792184442873051162,inode=1171507,mtime=1792184442873051162,sha1="dea223a77906f3dd2bdc8bc0a43108759adcc12a",size=2873.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["listBuilders.lua"]={ctime=1792179886741954590,inode=1171509,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792179886741954590,inode=1171510,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={sha1="743b1a60add2c9fb6dda0c3934205190ece6acda"},["luaIO.lua"]={ctime=1792181894054384821,inode=1171511,mtime=1792181894054384821,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792184516478663360,inode=1172134,mtime=1792184516478663360,sha1="9c30e3379e511052315d128cccea1cccbcc94845",size=8805.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792179886741954590,inode=1171514,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792179886741954590,inode=1171516,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792179886741954590,inode=1171518,mtime=1454600802000000000,sha1="b30ad3fc1b9ae3060830be02e5ea79820138ba25",size=1672.0},["remoteCache.lua"]={ctime=1792183805097674884,inode=1171512,mtime=1792183805097674884,sha1="24d76dc2e0190443d23f509ad723e6d626e3ea2a",size=8347.0},["system.lua"]={ctime=1792179886741954590,inode=1171520,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792184180554465389,inode=1172148,mtime=1792184180554465389,sha1="4a0125a0f8600eac940621dde46f4e984b154563",size=5743.0},["trace.lua"]={ctime=1792184137937463082,inode=1172069,mtime=1792184137937463082,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="out/release/flake"},["luaIO.program/c2beb24b1c899dba2a994dcd1261a9157e1919fd"]={buildName="luaIO.program/9",outputs={["out/release/flake"]="061f202c271b2c06409d822cb9f7333848c20f36"},sources={["../luau/out/release/fsu.lua"]={ctime=1792184673376915836,inode=1172914,mtime=1792184673376915836,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/getopts.lua"]={ctime=1792184673374050548,inode=1172923,mtime=1792184673374050548,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["../luau/out/release/heap.lua"]={ctime=1792184673375851630,inode=1172912,mtime=1792184673375851630,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184673375534208,inode=1172922,mtime=1792184673375534208,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792184673370160935,inode=1172924,mtime=1792184673370160935,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792184673376187655,inode=1172925,mtime=1792184673376187655,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792184673370845828,inode=1172921,mtime=1792184673370845828,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184673376549334,inode=1172919,mtime=1792184673376549334,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184673374628688,inode=1172916,mtime=1792184673374628688,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpexec.lua"]={ctime=1792184673377783810,inode=1172920,mtime=1792184673377783810,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpfs.lib"]={ctime=1792184673372937786,inode=1172911,mtime=1792184673372937786,sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",size=12502.0},["../luau/out/release/xpio.lua"]={ctime=1792184673378198418,inode=1172915,mtime=1792184673378198418,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},["../luau/out/release/xpio_c.lib"]={ctime=1792184673372094229,inode=1172913,mtime=1792184673372094229,sha1="0e42f853240e8e583d4b66bcbc4103269e5f7d51",size=63264.0},["../sha1/out/release/libsha1.lib"]={ctime=1792184234215399797,inode=1172952,mtime=1792184234215399797,sha1="c866a804fc304f5284871a8bfcc2266b62a9d754",size=21290.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792184671604411838,inode=1171521,mtime=1792184671604344100,sha1="282e065ce5aa3a546131ecae1502dd875b5457e2",size=305416.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792181609575202119,inode=1172718,mtime=1792181609575202119,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0},["c.lua"]={ctime=1792185196292512663,inode=1171503,mtime=1792185196292512663,sha1="999ecf26da199f70c3f569baf835908f379d842a",size=3020.0},["cIO.lua"]={ctime=1792185181573816661,inode=1171504,mtime=1792185181573816661,sha1="70f5d1e402bf62ee79fb3259a9c45367028d9374",size=7914.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["daemon.lua"]={ctime=1792184612224840948,inode=1172139,mtime=1792184612224840948,sha1="c6b3166fca0d53effaa2e42b4411427b06e3e61d",size=6132.0},["flake.lua"]={ctime=1792185010736191279,inode=1172825,mtime=1792185010736191279,sha1="fa66f8abebc80207806c32de1efc469d92cbfd84",size=36874.0},["flakeOpts.lua"]={ctime=1792184669811365773,inode=1171507,mtime=1792184669811365773,sha1="e0d9e2b220280e67495e5772e81b5030539a7d15",size=3008.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["listBuilders.lua"]={ctime=1792179886741954590,inode=1171509,mtime=1454600802000000000,sha1="35e630bee2b7d63339d7ce9bf509b3e3c4b35943",size=72.0},["lua.lua"]={ctime=1792179886741954590,inode=1171510,mtime=1454600802000000000,sha1="351e44997b41dd5dda00ab72e3741c3ca55abc78",size=2847.0},["luaDeps.lua"]={sha1="743b1a60add2c9fb6dda0c3934205190ece6acda"},["luaIO.lua"]={ctime=1792181894054384821,inode=1171511,mtime=1792181894054384821,sha1="92ad6a15cacaaf4ad498ecd5933b434d22b0a56a",size=4971.0},["main.lua"]={ctime=1792184669810735971,inode=1172134,mtime=1792184669810735971,sha1="d5ff35b178b7d32164141e30a2770eaae2a1ef99",size=9593.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operatorBuilders.lua"]={ctime=1792179886741954590,inode=1171514,mtime=1454600802000000000,sha1="6730dbe19dc33feb908f806ad95c7ea2fc34cf3a",size=76.0},["path.lua"]={ctime=1792179886741954590,inode=1171516,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792184612224236986,inode=1171518,mtime=1792184612224236986,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0},["remoteCache.lua"]={ctime=1792183805097674884,inode=1171512,mtime=1792183805097674884,sha1="24d76dc2e0190443d23f509ad723e6d626e3ea2a",size=8347.0},["system.lua"]={ctime=1792179886741954590,inode=1171520,mtime=1454600802000000000,sha1="a5f9aeba0202a6440b1d39c3249de54c4961dbd2",size=600.0},["systemIO.lua"]={ctime=1792184180554465389,inode=1172148,mtime=1792184180554465389,sha1="4a0125a0f8600eac940621dde46f4e984b154563",size=5743.0},["trace.lua"]={ctime=1792184137937463082,inode=1172069,mtime=1792184137937463082,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0},["watch.lua"]={ctime=1792184658467176190,inode=1172140,mtime=1792184658467176190,sha1="520a2b61940d40ca11a66fe80d7a46ccf314c0e7",size=3573.0}},valid=true,value="out/release/flake"},["luaIO.run/078b717b9c9e7f051b69b800284f6a9357491afc"]={buildName="luaIO.run/24",sources={["../luau/out/release/fsu.lua"]={ctime=1792184673376915836,inode=1172914,mtime=1792184673376915836,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/lfsu.lua"]={ctime=1792184673375534208,inode=1172922,mtime=1792184673375534208,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/qtest.lua"]={ctime=1792184673375107179,inode=1172917,mtime=1792184673375107179,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/xpio.lua"]={ctime=1792184673378198418,inode=1172915,mtime=1792184673378198418,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["trace.lua"]={ctime=1792184137937463082,inode=1172069,mtime=1792184137937463082,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0},["trace_q.lua"]={ctime=1792184212678440413,inode=1172334,mtime=1792184212678440413,sha1="b0459b19c87e192079063d4c690cacb51e0b8117",size=1358.0}},valid=true,value="trace.lua"},["luaIO.run/08842bcd7f4c5731de196bb6338a3d5673cb05a9"]={buildName="luaIO.run/37",outputs={["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operator_q.lua"]={ctime=1792189296974501830,inode=1172928,mtime=1454600802000000000,sha1="a5a22210e2c4daccd8ee06c8d0c972c802bbf026",size=546.0}},valid=true,value="operator.lua"},["luaIO.run/09fd906d2ba2b174089c6f891c5f88d3285d7740"]={buildName="luaIO.run/61",graphKey="luaIO.run/05c539be434dd7dcf2bd50fbc33c55c67715da83",outputs={["watch.lua"]="4bd7f55121dc476f7e9e494449435d17551fc589"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["watch.lua"]={ctime=1792192480937195756,inode=1171744,mtime=1792192480937195756,sha1="4bd7f55121dc476f7e9e494449435d17551fc589",size=3807.0},["watch_q.lua"]={ctime=1792191937960881076,inode=1171745,mtime=1792191937960881076,sha1="3920d4034fe77993b09c2768364ba440cfd55230",size=1496.0}},valid=true,value="watch.lua"},["luaIO.run/11d911565fd376c593c07315a8455bc22c0a0a5d"]={buildName="luaIO.run/59",graphKey="luaIO.run/582c566ceb52e27e86b1165fdfa720ebb5664c85",outputs={["remoteCache.lua"]="cd850adfb01e257c7dadf2b7bc4e28c790605516"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="234987dd976d4d2e0cebea53433f2dd70f842ef0"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["cas.lua"]={ctime=1792193466807941957,inode=1171724,mtime=1792193466807941957,sha1="52f301f31133a70da688cb5fcb583fde6d0c627f",size=10081.0},["remoteCache.lua"]={ctime=1792193616368411999,inode=1171728,mtime=1792193616368411999,sha1="223200e6f8533155fe154082b38fe6dba7978e94",size=11792.0},["remoteCache_q.lua"]={ctime=1792193619988343403,inode=1171729,mtime=1792193619988343403,sha1="a13c579c948b7d11db20ccd4fa386cd96361ad4c",size=5615.0}},valid=true,value="remoteCache.lua"},["luaIO.run/147d9f151ff9f10b851e0481f71ad2886f390721"]={buildName="luaIO.run/50",graphKey="luaIO.run/54f37009db51bff0948473d994862633f89d21a9",outputs={["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704"},sources={[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operator_q.lua"]={ctime=1792189296974501830,inode=1172928,mtime=1454600802000000000,sha1="a5a22210e2c4daccd8ee06c8d0c972c802bbf026",size=546.0}},valid=true,value="operator.lua"},["luaIO.run/225f2849299722527d37fd89352a5b3658530c12"]={buildName="luaIO.run/44",outputs={["daemon.lua"]="c6b3166fca0d53effaa2e42b4411427b06e3e61d"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["daemon.lua"]={ctime=1792189297021741360,inode=1173008,mtime=1792184612000000000,sha1="c6b3166fca0d53effaa2e42b4411427b06e3e61d",size=6132.0},["daemon_q.lua"]={ctime=1792189297021741360,inode=1173021,mtime=1792184525000000000,sha1="dbe6c8913700e69e22d332c3f953d18c64002429",size=1395.0},["process.lua"]={ctime=1792189297018463715,inode=1173005,mtime=1792184612000000000,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0}},valid=true,value="daemon.lua"},["luaIO.run/29c7d2ff7cc25a6c86d6cc6859e80bd2567f119d"]={buildName="luaIO.run/3",sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["operator_q.lua"]={ctime=1792179886741954590,inode=1171515,mtime=1454600802000000000,sha1="a5a22210e2c4daccd8ee06c8d0c972c802bbf026",size=546.0}},valid=true,value="operator.lua"},["luaIO.run/2d18e123b575316fe8425b7910ed68639524a68b"]={buildName="luaIO.run/28",sources={["../luau/out/release/fsu.lua"]={ctime=1792184332603349430,inode=1172914,mtime=1792184332603349430,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792184332604607246,inode=1172912,mtime=1792184332604607246,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184332603518710,inode=1172922,mtime=1792184332603518710,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/object.lua"]={ctime=1792184332604218227,inode=1172925,mtime=1792184332604218227,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792184332602383097,inode=1172917,mtime=1792184332602383097,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792184332604062956,inode=1172921,mtime=1792184332604062956,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184332603854146,inode=1172919,mtime=1792184332603854146,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184332605489010,inode=1172916,mtime=1792184332605489010,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792184332604384586,inode=1172915,mtime=1792184332604384586,sha1="6551921686861ea121658b2423bcc2ddf8b8f207",size=7603.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792184333125150682,inode=1172252,mtime=1792184333121525963,sha1="e9a8277e48fecb77380d6ac13b9b4fa656320393",size=305232.0},["daemon.lua"]={ctime=1792184513465582717,inode=1172139,mtime=1792184513465582717,sha1="25715c37f361556f49770da43b94d39a65c8250e",size=6376.0},["daemon_q.lua"]={ctime=1792184525604659108,inode=1172790,mtime=1792184525604659108,sha1="dbe6c8913700e69e22d332c3f953d18c64002429",size=1395.0}},valid=true,value="daemon.lua"},["luaIO.run/36176d5e834bdad658bcc0f124691cf7827be26e"]={buildName="luaIO.run/1",sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["path.lua"]={ctime=1792179886741954590,inode=1171516,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["path_q.lua"]={ctime=1792179886741954590,inode=1171517,mtime=1454600802000000000,sha1="1d7c268d71a8d5e6a2b7ba8a4d04707419d34563",size=2011.0}},valid=true,value="path.lua"},["luaIO.run/391526e09be364d0c4c721b4b7cc6deeb9f44292"]={buildName="luaIO.run/39",outputs={["flake.lua"]="a704227dd6283afaa2de40556fdf3a7671e453b4"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["cas.lua"]={ctime=1792189296974501830,inode=1172920,mtime=1792182711000000000,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["flake.lua"]={ctime=1792190229282124653,inode=1172924,mtime=1792190229282124653,sha1="a704227dd6283afaa2de40556fdf3a7671e453b4",size=37124.0},["flake_q.lua"]={ctime=1792189297018463715,inode=1173006,mtime=1792185017000000000,sha1="403d7379dca71b073a619629a0f2c940b25ad939",size=10525.0},["jobserver.lua"]={ctime=1792189296974501830,inode=1172932,mtime=1792182332000000000,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["trace.lua"]={ctime=1792189297021741360,inode=1173022,mtime=1792184137000000000,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="flake.lua"},["luaIO.run/3bb7a1f8037e5310733f0b7541d2b2a13ebf429b"]={buildName="luaIO.run/57",graphKey="luaIO.run/bbd5143fb6e1f07e1e4a7279b63e7f7f0bfb8623",outputs={["cas.lua"]="5dedaa6c6b6d9bdbbe3c59e21d0210668b22667f"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="234987dd976d4d2e0cebea53433f2dd70f842ef0"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["cas.lua"]={ctime=1792193466807941957,inode=1171724,mtime=1792193466807941957,sha1="52f301f31133a70da688cb5fcb583fde6d0c627f",size=10081.0},["cas_q.lua"]={ctime=1792193479933029415,inode=1171801,mtime=1792193479933029415,sha1="8385266df6b8bcb2f4a0e2a038eab3ee17650bd7",size=3624.0}},valid=true,value="cas.lua"},["luaIO.run/3d99a72e6ec27b2790adaaee4725f9d5357fe1c7"]={buildName="luaIO.run/55",graphKey="luaIO.run/dfda0d5beae5312ec2d0de3d203b6d7e0fe6bd27",outputs={["flake.lua"]="78784c45d267a5f074348b68ffc4f6471747adaf"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="234987dd976d4d2e0cebea53433f2dd70f842ef0"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["cas.lua"]={ctime=1792193466807941957,inode=1171724,mtime=1792193466807941957,sha1="52f301f31133a70da688cb5fcb583fde6d0c627f",size=10081.0},["flake.lua"]={ctime=1792193208440322150,inode=1171532,mtime=1792193208440322150,sha1="f6d0e2ab6e676886f77b0d0adfa6629a6edc1161",size=41260.0},["flake_q.lua"]={ctime=1792193207973019698,inode=1171752,mtime=1792193207973019698,sha1="9ccf4e99cbf1fa0d92d4871173a139e1e6893197",size=14200.0},["jobserver.lua"]={ctime=1792193662377535188,inode=1171717,mtime=1792193662377535188,sha1="81ba9b9adb7a4ae0ac5c344ce9609b115cd84698",size=5963.0},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["trace.lua"]={ctime=1792191937918388369,inode=1171738,mtime=1792191937918388369,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="flake.lua"},["luaIO.run/3df547fa916cb7ac2bbb98b510d862eefed4b637"]={buildName="luaIO.run/31",outputs={["jobserver.lua"]="b23e89cb676f9840759fc37b0a82d62a1289efad"},sources={["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["jobserver.lua"]={ctime=1792189296974501830,inode=1172932,mtime=1792182332000000000,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["jobserver_q.lua"]={ctime=1792189297018463715,inode=1173007,mtime=1792182354000000000,sha1="ad8822315a1ba746f914a6b0ab0f452420cdee66",size=2227.0}},valid=true,value="jobserver.lua"},["luaIO.run/54521ef7366e406161de8aec843bed6be4f8dafc"]={buildName="luaIO.run/33",outputs={["path.lua"]="8751ec30bef97d22f0e6d4d1e2dec68ec6598906"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["path.lua"]={ctime=1792189297018152350,inode=1173001,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["path_q.lua"]={ctime=1792189296974501830,inode=1172927,mtime=1454600802000000000,sha1="1d7c268d71a8d5e6a2b7ba8a4d04707419d34563",size=2011.0}},valid=true,value="path.lua"},["luaIO.run/568b78d4abaf566b19fd76c31b7a781a549fa2d8"]={buildName="luaIO.run/54",graphKey="luaIO.run/a7b179044a5d2219f76bb02b5e7e7fd2be3a6caa",outputs={["daemon.lua"]="47cfdd583563547c4d356cfd57e8b1bd6f008f77"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="9280bafe9628900f3141d96c22d29a42b545648a"},["daemon.lua"]={ctime=1792192408279868394,inode=1171741,mtime=1792192408279868394,sha1="47cfdd583563547c4d356cfd57e8b1bd6f008f77",size=7200.0},["daemon_q.lua"]={ctime=1792192509085919906,inode=1171742,mtime=1792192509085919906,sha1="e6c24f09828c93bbd2511bb228c985c8261426ea",size=2320.0},["process.lua"]={ctime=1792191937955840437,inode=1171571,mtime=1792191937955840437,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0}},valid=true,value="daemon.lua"},["luaIO.run/5a1366c56122894c8106cf5b091d8277dd4add86"]={buildName="luaIO.run/47",outputs={["compilerCache.lua"]="c14d822d99746db5cabe88a508677dd8f7ef88f9"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["cas.lua"]={ctime=1792189296974501830,inode=1172920,mtime=1792182711000000000,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["compilerCache.lua"]={ctime=1792190043693486996,inode=1173014,mtime=1792190043693486996,sha1="c14d822d99746db5cabe88a508677dd8f7ef88f9",size=3311.0},["compilerCache_q.lua"]={ctime=1792190054107728455,inode=1171483,mtime=1792190054103728455,sha1="93b9d6042b9779c0f20d39137062c069e1db515a",size=1241.0},["process.lua"]={ctime=1792189297018463715,inode=1173005,mtime=1792184612000000000,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0}},valid=true,value="compilerCache.lua"},["luaIO.run/6bb97f6ce2774b1f2ca055638d83fe4f6686b418"]={buildName="luaIO.run/65",graphKey="luaIO.run/a2d457a9cbeacaeca45d5cb212adfb0a449ab6c1",sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="234987dd976d4d2e0cebea53433f2dd70f842ef0"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpexec.lua"]={sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["cIO.lua"]={ctime=1792193518675934399,inode=1171970,mtime=1792193518675934399,sha1="6aab33dae0a0eb3b3048cf5a9227745c84c524d6",size=19585.0},["cas.lua"]={ctime=1792193466807941957,inode=1171724,mtime=1792193466807941957,sha1="52f301f31133a70da688cb5fcb583fde6d0c627f",size=10081.0},["compilerCache.lua"]={ctime=1792191938055802317,inode=1171751,mtime=1792191938055802317,sha1="c14d822d99746db5cabe88a508677dd8f7ef88f9",size=3311.0},["compilerCache_q.lua"]={ctime=1792193508216313970,inode=1171755,mtime=1792193508216313970,sha1="5842dbf162a1016c33a7c43e16388232242b9c0d",size=2087.0},["depfile.lua"]={ctime=1792191937994718588,inode=1171746,mtime=1792191937994718588,sha1="6495bf986ec19a1edf9e731f4870db069b6fdb28",size=1782.0},["path.lua"]={ctime=1792189297018152350,inode=1173001,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["process.lua"]={ctime=1792191937955840437,inode=1171571,mtime=1792191937955840437,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0},["systemIO.lua"]={ctime=1792192031760256930,inode=1171573,mtime=1792192031760256930,sha1="18e1d46da8f9b587097386350daffe9c6ff6e266",size=6261.0},["trace.lua"]={ctime=1792191937918388369,inode=1171738,mtime=1792191937918388369,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="compilerCache.lua"},["luaIO.run/7001c71cdf3e772035684f4de42044d3a887b11b"]={buildName="luaIO.run/2",sources={["../luau/out/release/fsu.lua"]={ctime=1792182076753191350,inode=1172914,mtime=1792182076753191350,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792182076752012919,inode=1172912,mtime=1792182076752012919,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792182076752411769,inode=1172922,mtime=1792182076752411769,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792182076753564274,inode=1172924,mtime=1792182076753564274,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792182076752305938,inode=1172925,mtime=1792182076752305938,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792182076753669597,inode=1172917,mtime=1792182076753669597,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792182076753983400,inode=1172921,mtime=1792182076753983400,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792182076752554405,inode=1172919,mtime=1792182076752554405,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792182076753901907,inode=1172916,mtime=1792182076753901907,sha1="e308397572e2d90a669adcab61992c9b063998ba",size=8086.0},["../luau/out/release/xpio.lua"]={ctime=1792182076753315696,inode=1172915,mtime=1792182076753315696,sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",size=6703.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792182076950827275,inode=1172129,mtime=1792182076950802220,sha1="36b953968aa28a13145807f7ccfb5aafbdd8524c",size=300360.0},["flake.lua"]={ctime=1792182069773212097,inode=1171505,mtime=1792182069773212097,sha1="facbd578d157d3d83d8c78d2c1e393d5d1d25ca8",size=22378.0},["flake_q.lua"]={ctime=1792181904803077774,inode=1171508,mtime=1792181904803077774,sha1="83424c64c105442f20fbf84d3c932604b7ca3425",size=6389.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0}},valid=true,value="flake.lua"},["luaIO.run/70e0fada7af1805b1ba361ee1eeda689894b2fbd"]={buildName="luaIO.run/46",outputs={["depfile.lua"]="6495bf986ec19a1edf9e731f4870db069b6fdb28"},sources={["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["depfile.lua"]={ctime=1792189297021741360,inode=1173011,mtime=1792184865000000000,sha1="6495bf986ec19a1edf9e731f4870db069b6fdb28",size=1782.0},["depfile_q.lua"]={ctime=1792189297021741360,inode=1173012,mtime=1792184865000000000,sha1="0536168b8a56a0c81cab99de4fe26e45a622b8df",size=765.0}},valid=true,value="depfile.lua"},["luaIO.run/70f41523928fcca3314b527251aa2ca47985b32a"]={buildName="luaIO.run/56",graphKey="luaIO.run/cac8865172b6140afe41448faa7060f2215bdffe",outputs={["jobserver.lua"]="9dfb70d1f76759a900fc1f5dc1075fe313c89551"},sources={["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["jobserver.lua"]={ctime=1792193662377535188,inode=1171717,mtime=1792193662377535188,sha1="81ba9b9adb7a4ae0ac5c344ce9609b115cd84698",size=5963.0},["jobserver_q.lua"]={ctime=1792193662377968509,inode=1171720,mtime=1792193662377968509,sha1="c21356a9f1a9ede4de5dcc26d0a5d8a4cfe7baba",size=3066.0}},valid=true,value="jobserver.lua"},["luaIO.run/775c01681cb9150aa35f30305a7bfcc0d0e9c0a6"]={buildName="luaIO.run/35",outputs={["cas.lua"]="905162315e897801411fba11c0ea5708298b0123"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["cas.lua"]={ctime=1792189296974501830,inode=1172920,mtime=1792182711000000000,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["cas_q.lua"]={ctime=1792189297021741360,inode=1173019,mtime=1792182555000000000,sha1="2f4a84dc8b307f99327014e900662ee03be46ff7",size=1804.0}},valid=true,value="cas.lua"},["luaIO.run/7af23d68a44fa2ca3539f67de47d88e82ea50d53"]={buildName="luaIO.run/14",sources={["../luau/out/release/fsu.lua"]={ctime=1792184080570749217,inode=1172914,mtime=1792184080570749217,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792184080568453229,inode=1172912,mtime=1792184080568453229,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184080567576066,inode=1172922,mtime=1792184080567576066,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792184080568773663,inode=1172924,mtime=1792184080568773663,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792184080567214460,inode=1172925,mtime=1792184080567214460,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792184080570561276,inode=1172921,mtime=1792184080570561276,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184080572139347,inode=1172919,mtime=1792184080572139347,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184080569844405,inode=1172916,mtime=1792184080569844405,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpexec.lua"]={ctime=1792184080570296480,inode=1172920,mtime=1792184080570296480,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpio.lua"]={ctime=1792184080570065059,inode=1172915,mtime=1792184080570065059,sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",size=6703.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792182757451697990,inode=1172252,mtime=1792182757451572117,sha1="16691c24094e2189e5a5a4d31dca19b3b45dd2aa",size=300672.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["flake.lua"]={ctime=1792184194315598468,inode=1172205,mtime=1792184194315598468,sha1="a10cdb80f3cddd465b2d0ca042a763fa396a36bd",size=30890.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["systemIO.lua"]={ctime=1792184180554465389,inode=1172148,mtime=1792184180554465389,sha1="4a0125a0f8600eac940621dde46f4e984b154563",size=5743.0},["systemIO_q.lua"]={ctime=1792179886741954590,inode=1171522,mtime=1454600802000000000,sha1="e9f512bd38c3d5b4a75e72141199ac1473ffea22",size=1022.0}},valid=true,value="systemIO.lua"},["luaIO.run/7e93010e61efd69c54a9c240b592687edb77664e"]={buildName="luaIO.run/45",outputs={["watch.lua"]="520a2b61940d40ca11a66fe80d7a46ccf314c0e7"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["watch.lua"]={ctime=1792189297021741360,inode=1173024,mtime=1792184658000000000,sha1="520a2b61940d40ca11a66fe80d7a46ccf314c0e7",size=3573.0},["watch_q.lua"]={ctime=1792189297021741360,inode=1173015,mtime=1792184750000000000,sha1="3920d4034fe77993b09c2768364ba440cfd55230",size=1496.0}},valid=true,value="watch.lua"},["luaIO.run/857cd3eddd3a496c698ee1c2b737dea625a84bdc"]={buildName="luaIO.run/42",outputs={["systemIO.lua"]="243be364a6655afbbc02806db6a034b9ac4266f7"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpexec.lua"]={sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["cas.lua"]={ctime=1792189296974501830,inode=1172920,mtime=1792182711000000000,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["flake.lua"]={ctime=1792190229282124653,inode=1172924,mtime=1792190229282124653,sha1="a704227dd6283afaa2de40556fdf3a7671e453b4",size=37124.0},["jobserver.lua"]={ctime=1792189296974501830,inode=1172932,mtime=1792182332000000000,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["systemIO.lua"]={ctime=1792190193575736746,inode=1173025,mtime=1792190193575736746,sha1="243be364a6655afbbc02806db6a034b9ac4266f7",size=5846.0},["systemIO_q.lua"]={ctime=1792189297021741360,inode=1173023,mtime=1454600802000000000,sha1="e9f512bd38c3d5b4a75e72141199ac1473ffea22",size=1022.0},["trace.lua"]={ctime=1792189297021741360,inode=1173022,mtime=1792184137000000000,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="systemIO.lua"},["luaIO.run/89e9a842f83e9509fa6d29cd0089e0fcecd3f733"]={buildName="luaIO.run/27",graphKey="luaIO.run/bd7c1a2a1bdce9b517cdd644ae550b1f73b6ddd0",outputs={["out/release/flake"]="989f49f76d45213b238e8bc233fd8f2ca7068b06"},sources={["../luau/out/release/fsu.lua"]={ctime=1792193739768282628,inode=1172883,mtime=1792193739768282628,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792193739769486822,inode=1172884,mtime=1792193739769486822,sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",size=2247.0},["../luau/out/release/lfsu.lua"]={ctime=1792193739767190190,inode=1172885,mtime=1792193739767190190,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792193739768927259,inode=1172893,mtime=1792193739768927259,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792193739768092231,inode=1172892,mtime=1792193739768092231,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792193739767533645,inode=1172890,mtime=1792193739767533645,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792193739770442903,inode=1172888,mtime=1792193739770442903,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792193739769269154,inode=1172887,mtime=1792193739769269154,sha1="234987dd976d4d2e0cebea53433f2dd70f842ef0",size=7843.0},["../luau/out/release/thread.lua"]={ctime=1792193739768670542,inode=1172879,mtime=1792193739768670542,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792193739769645902,inode=1172889,mtime=1792193739769645902,sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c",size=8617.0},["cas.lua"]={ctime=1792193466807941957,inode=1171724,mtime=1792193466807941957,sha1="52f301f31133a70da688cb5fcb583fde6d0c627f",size=10081.0},["flake.lua"]={ctime=1792193208440322150,inode=1171532,mtime=1792193208440322150,sha1="f6d0e2ab6e676886f77b0d0adfa6629a6edc1161",size=41260.0},["flakeExe_q.lua"]={ctime=1792189296974501830,inode=1172933,mtime=1792181594000000000,sha1="34bf1f63d7988f2540f60f1004e0b608261e474d",size=2082.0},["jobserver.lua"]={ctime=1792193662377535188,inode=1171717,mtime=1792193662377535188,sha1="81ba9b9adb7a4ae0ac5c344ce9609b115cd84698",size=5963.0},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["out/release/flake"]={sha1="cf1b81c6bb3eb1bd6c433c53629dadd50ac77047"},["process.lua"]={ctime=1792191937955840437,inode=1171571,mtime=1792191937955840437,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0},["trace.lua"]={ctime=1792191937918388369,inode=1171738,mtime=1792191937918388369,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="out/release/flake"},["luaIO.run/8d1a4a43d2b30239a9845cdd9f61dd9fd5496fd3"]={buildName="luaIO.run/12",sources={["../luau/out/release/fsu.lua"]={ctime=1792182549165521160,inode=1172914,mtime=1792182549165521160,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/lfsu.lua"]={ctime=1792182549164487668,inode=1172922,mtime=1792182549164487668,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/qtest.lua"]={ctime=1792182549164343212,inode=1172917,mtime=1792182549164343212,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/serialize.lua"]={ctime=1792182549166086788,inode=1172919,mtime=1792182549166086788,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792182549419979168,inode=1172129,mtime=1792182549419953692,sha1="4676927ac210ef58d3a8cc9fa0fb6ca7be761a8f",size=300672.0},["cas.lua"]={ctime=1792182465616586376,inode=1172042,mtime=1792182465609525963,sha1="ced81d99acb57b21d0c0113340f975e67fc5492b",size=5276.0},["cas_q.lua"]={ctime=1792182555440937663,inode=1172319,mtime=1792182555440937663,sha1="2f4a84dc8b307f99327014e900662ee03be46ff7",size=1804.0}},valid=true,value="cas.lua"},["luaIO.run/93e54acdc17290a8613180d561bff48c7f8b609f"]={buildName="luaIO.run/53",graphKey="luaIO.run/87beaa683330ea899bc387caf5930cfb5c68f895",outputs={["process.lua"]="23f6ef6f818009bb76375b673a7e73cf849187ad"},sources={["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["process.lua"]={ctime=1792191937955840437,inode=1171571,mtime=1792191937955840437,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0},["process_q.lua"]={ctime=1792191937955840437,inode=1171572,mtime=1792191937955840437,sha1="151b97d2d6849bf042b07bd77f2816e069dd7472",size=560.0}},valid=true,value="process.lua"},["luaIO.run/945b1cdc5137e796c20ae168a3ee8991dc0e75df"]={buildName="luaIO.run/4",sources={["../luau/out/release/heap.lua"]={ctime=1792184673375851630,inode=1172912,mtime=1792184673375851630,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/object.lua"]={ctime=1792184673376187655,inode=1172925,mtime=1792184673376187655,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792184673375107179,inode=1172917,mtime=1792184673375107179,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792184673370845828,inode=1172921,mtime=1792184673370845828,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/thread.lua"]={ctime=1792184673374628688,inode=1172916,mtime=1792184673374628688,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792184673378198418,inode=1172915,mtime=1792184673378198418,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["process.lua"]={ctime=1792184612224236986,inode=1171518,mtime=1792184612224236986,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0},["process_q.lua"]={ctime=1792184612224513413,inode=1171519,mtime=1792184612224513413,sha1="151b97d2d6849bf042b07bd77f2816e069dd7472",size=560.0}},valid=true,value="process.lua"},["luaIO.run/951975b2728f12d39ad6f6bcf08a45bf77ca3900"]={buildName="luaIO.run/26",outputs={["systemIO.lua"]="4a0125a0f8600eac940621dde46f4e984b154563"},sources={["../luau/out/release/fsu.lua"]={ctime=1792184673376915836,inode=1172914,mtime=1792184673376915836,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792184673375851630,inode=1172912,mtime=1792184673375851630,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184673375534208,inode=1172922,mtime=1792184673375534208,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792184673370160935,inode=1172924,mtime=1792184673370160935,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792184673376187655,inode=1172925,mtime=1792184673376187655,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792184673370845828,inode=1172921,mtime=1792184673370845828,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184673376549334,inode=1172919,mtime=1792184673376549334,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184673374628688,inode=1172916,mtime=1792184673374628688,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpexec.lua"]={ctime=1792184673377783810,inode=1172920,mtime=1792184673377783810,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpio.lua"]={ctime=1792184673378198418,inode=1172915,mtime=1792184673378198418,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["flake.lua"]={ctime=1792185010736191279,inode=1172825,mtime=1792185010736191279,sha1="fa66f8abebc80207806c32de1efc469d92cbfd84",size=36874.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["systemIO.lua"]={ctime=1792184180554465389,inode=1172148,mtime=1792184180554465389,sha1="4a0125a0f8600eac940621dde46f4e984b154563",size=5743.0},["systemIO_q.lua"]={ctime=1792179886741954590,inode=1171522,mtime=1454600802000000000,sha1="e9f512bd38c3d5b4a75e72141199ac1473ffea22",size=1022.0},["trace.lua"]={ctime=1792184137937463082,inode=1172069,mtime=1792184137937463082,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="systemIO.lua"},["luaIO.run/9d81aae47ff2fe6ba91300e46b0ae395c93ce915"]={buildName="luaIO.run/6",sources={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="a00d42a11fbcf141902cc317b27fb2edec6d9b10",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="cc23fc22c91b8e54da1aeccf5d77b3f4f00259a8",["../luau/out/release/xpio.lua"]="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",["flake.lua"]="5c5bf9f5c4167ab0182e15b1f46ee0ec96c5c877",["flakeExe_q.lua"]="34bf1f63d7988f2540f60f1004e0b608261e474d",["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704",["out/release/flake"]="933f75cb9c6d76b7056c279fc9b234b53818b273",["process.lua"]="b30ad3fc1b9ae3060830be02e5ea79820138ba25"},valid=true,value="out/release/flake"},["luaIO.run/9d98a8cbfb5893e7265bbfab8685c3573434d267"]={buildName="luaIO.run/30",sources={["../luau/out/release/fsu.lua"]={ctime=1792184673376915836,inode=1172914,mtime=1792184673376915836,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792184673375851630,inode=1172912,mtime=1792184673375851630,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184673375534208,inode=1172922,mtime=1792184673375534208,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/object.lua"]={ctime=1792184673376187655,inode=1172925,mtime=1792184673376187655,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792184673375107179,inode=1172917,mtime=1792184673375107179,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792184673370845828,inode=1172921,mtime=1792184673370845828,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/thread.lua"]={ctime=1792184673374628688,inode=1172916,mtime=1792184673374628688,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792184673378198418,inode=1172915,mtime=1792184673378198418,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["watch.lua"]={ctime=1792184658467176190,inode=1172140,mtime=1792184658467176190,sha1="520a2b61940d40ca11a66fe80d7a46ccf314c0e7",size=3573.0},["watch_q.lua"]={ctime=1792184750009525963,inode=1172144,mtime=1792184750009525963,sha1="3920d4034fe77993b09c2768364ba440cfd55230",size=1496.0}},valid=true,value="watch.lua"},["luaIO.run/a17669c25ec08133db8f529d557d885317f24559"]={buildName="luaIO.run/15",sources={["../luau/out/release/fsu.lua"]={ctime=1792184080570749217,inode=1172914,mtime=1792184080570749217,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792184080568453229,inode=1172912,mtime=1792184080568453229,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184080567576066,inode=1172922,mtime=1792184080567576066,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792184080568773663,inode=1172924,mtime=1792184080568773663,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792184080567214460,inode=1172925,mtime=1792184080567214460,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792184080571029488,inode=1172917,mtime=1792184080571029488,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792184080570561276,inode=1172921,mtime=1792184080570561276,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184080572139347,inode=1172919,mtime=1792184080572139347,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184080569844405,inode=1172916,mtime=1792184080569844405,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792184080570065059,inode=1172915,mtime=1792184080570065059,sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",size=6703.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["flake.lua"]={ctime=1792184194315598468,inode=1172205,mtime=1792184194315598468,sha1="a10cdb80f3cddd465b2d0ca042a763fa396a36bd",size=30890.0},["flakeExe_q.lua"]={ctime=1792181594449495463,inode=1172246,mtime=1792181594449495463,sha1="34bf1f63d7988f2540f60f1004e0b608261e474d",size=2082.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["out/release/flake"]={sha1="d49200ed0780f3ed3fe52d19016de36938f20f49"},["process.lua"]={ctime=1792179886741954590,inode=1171518,mtime=1454600802000000000,sha1="b30ad3fc1b9ae3060830be02e5ea79820138ba25",size=1672.0}},valid=true,value="out/release/flake"},["luaIO.run/a1ce01c9f57ec3a2eef0c4942682ea3ab1d94e17"]={buildName="luaIO.run/5",sources={["../luau/out/release/fsu.lua"]={ctime=1792182076753191350,inode=1172914,mtime=1792182076753191350,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792182076752012919,inode=1172912,mtime=1792182076752012919,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792182076752411769,inode=1172922,mtime=1792182076752411769,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792182076753564274,inode=1172924,mtime=1792182076753564274,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792182076752305938,inode=1172925,mtime=1792182076752305938,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/queue.lua"]={ctime=1792182076753983400,inode=1172921,mtime=1792182076753983400,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792182076752554405,inode=1172919,mtime=1792182076752554405,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792182076753901907,inode=1172916,mtime=1792182076753901907,sha1="e308397572e2d90a669adcab61992c9b063998ba",size=8086.0},["../luau/out/release/xpexec.lua"]={ctime=1792182076752196817,inode=1172920,mtime=1792182076752196817,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["../luau/out/release/xpio.lua"]={ctime=1792182076753315696,inode=1172915,mtime=1792182076753315696,sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",size=6703.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792182076950827275,inode=1172129,mtime=1792182076950802220,sha1="36b953968aa28a13145807f7ccfb5aafbdd8524c",size=300360.0},["flake.lua"]={ctime=1792182069773212097,inode=1171505,mtime=1792182069773212097,sha1="facbd578d157d3d83d8c78d2c1e393d5d1d25ca8",size=22378.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["systemIO.lua"]={ctime=1792182075187324202,inode=1172148,mtime=1792182075187324202,sha1="9876c68729adf27a1e32a9cd3cc8f6f696ed12e0",size=5286.0},["systemIO_q.lua"]={ctime=1792179886741954590,inode=1171522,mtime=1454600802000000000,sha1="e9f512bd38c3d5b4a75e72141199ac1473ffea22",size=1022.0}},valid=true,value="systemIO.lua"},["luaIO.run/a2e3017506d968b6c3e8ecf23995d5f6a0e15254"]={buildName="luaIO.run/60",graphKey="luaIO.run/a2d457a9cbeacaeca45d5cb212adfb0a449ab6c1",outputs={["compilerCache.lua"]="c14d822d99746db5cabe88a508677dd8f7ef88f9"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="234987dd976d4d2e0cebea53433f2dd70f842ef0"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792192729801588138,inode=1180237,mtime=1792192729801554832,sha1="9280bafe9628900f3141d96c22d29a42b545648a",size=314840.0},["cas.lua"]={ctime=1792193466807941957,inode=1171724,mtime=1792193466807941957,sha1="52f301f31133a70da688cb5fcb583fde6d0c627f",size=10081.0},["compilerCache.lua"]={ctime=1792191938055802317,inode=1171751,mtime=1792191938055802317,sha1="c14d822d99746db5cabe88a508677dd8f7ef88f9",size=3311.0},["compilerCache_q.lua"]={ctime=1792191938055939827,inode=1171755,mtime=1792191938055939827,sha1="93b9d6042b9779c0f20d39137062c069e1db515a",size=1241.0},["process.lua"]={ctime=1792191937955840437,inode=1171571,mtime=1792191937955840437,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0}},valid=true,value="compilerCache.lua"},["luaIO.run/a7b65d6f48c1e02e588b4b0976876e7416e58459"]={buildName="luaIO.run/29",sources={["../luau/out/release/fsu.lua"]={ctime=1792184673376915836,inode=1172914,mtime=1792184673376915836,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792184673375851630,inode=1172912,mtime=1792184673375851630,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184673375534208,inode=1172922,mtime=1792184673375534208,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/object.lua"]={ctime=1792184673376187655,inode=1172925,mtime=1792184673376187655,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792184673375107179,inode=1172917,mtime=1792184673375107179,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792184673370845828,inode=1172921,mtime=1792184673370845828,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184673376549334,inode=1172919,mtime=1792184673376549334,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184673374628688,inode=1172916,mtime=1792184673374628688,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792184673378198418,inode=1172915,mtime=1792184673378198418,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["daemon.lua"]={ctime=1792184612224840948,inode=1172139,mtime=1792184612224840948,sha1="c6b3166fca0d53effaa2e42b4411427b06e3e61d",size=6132.0},["daemon_q.lua"]={ctime=1792184525604659108,inode=1172790,mtime=1792184525604659108,sha1="dbe6c8913700e69e22d332c3f953d18c64002429",size=1395.0},["process.lua"]={ctime=1792184612224236986,inode=1171518,mtime=1792184612224236986,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0}},valid=true,value="daemon.lua"},["luaIO.run/a9339aee1b246a018a8a39a12ed8d86713513d26"]={buildName="luaIO.run/52",sources={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="a00d42a11fbcf141902cc317b27fb2edec6d9b10",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="cc23fc22c91b8e54da1aeccf5d77b3f4f00259a8",["../luau/out/release/xpexec.lua"]="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",["../luau/out/release/xpio.lua"]="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",[".flake/luaIO.program/1/interpreter"]="590b448ce6f7d3cc4935f2f91e92a56cfcc33f50",["flake.lua"]="5c5bf9f5c4167ab0182e15b1f46ee0ec96c5c877",["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704",["systemIO.lua"]="3f58a4c7edf85525a431614edee081a5d21b990a",["systemIO_q.lua"]="e9f512bd38c3d5b4a75e72141199ac1473ffea22"},valid=true,value="systemIO.lua"},["luaIO.run/acccb00401a156bb8ec9592c2ddc40ede2beb214"]={buildName="luaIO.run/62",graphKey="luaIO.run/dfbfb11a89d7ee19ffbe2d33d676db9c728f68c8",outputs={["systemIO.lua"]="18e1d46da8f9b587097386350daffe9c6ff6e266"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="234987dd976d4d2e0cebea53433f2dd70f842ef0"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpexec.lua"]={sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["cas.lua"]={ctime=1792193466807941957,inode=1171724,mtime=1792193466807941957,sha1="52f301f31133a70da688cb5fcb583fde6d0c627f",size=10081.0},["flake.lua"]={ctime=1792193208440322150,inode=1171532,mtime=1792193208440322150,sha1="f6d0e2ab6e676886f77b0d0adfa6629a6edc1161",size=41260.0},["jobserver.lua"]={ctime=1792193662377535188,inode=1171717,mtime=1792193662377535188,sha1="81ba9b9adb7a4ae0ac5c344ce9609b115cd84698",size=5963.0},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["systemIO.lua"]={ctime=1792192031760256930,inode=1171573,mtime=1792192031760256930,sha1="18e1d46da8f9b587097386350daffe9c6ff6e266",size=6261.0},["systemIO_q.lua"]={ctime=1792192040796638174,inode=1173023,mtime=1792192040796638174,sha1="2156a919439ea327f60c447eaf1b39e9a62d68e9",size=1609.0},["trace.lua"]={ctime=1792191937918388369,inode=1171738,mtime=1792191937918388369,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="systemIO.lua"},["luaIO.run/ae3ccb9c74d0e422101a626d4483d67a914610f9"]={buildName="luaIO.run/48",graphKey="luaIO.run/34bcb3ccd418693ee3dc8039199d7f9a2b2f5aea",outputs={["path.lua"]="8751ec30bef97d22f0e6d4d1e2dec68ec6598906"},sources={[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["path.lua"]={ctime=1792189297018152350,inode=1173001,mtime=1454600802000000000,sha1="8751ec30bef97d22f0e6d4d1e2dec68ec6598906",size=1682.0},["path_q.lua"]={ctime=1792189296974501830,inode=1172927,mtime=1454600802000000000,sha1="1d7c268d71a8d5e6a2b7ba8a4d04707419d34563",size=2011.0}},valid=true,value="path.lua"},["luaIO.run/aff6aabc8f2044c4ffa638c857b6290ef4665da3"]={buildName="luaIO.run/64",graphKey="luaIO.run/a7b179044a5d2219f76bb02b5e7e7fd2be3a6caa",sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="234987dd976d4d2e0cebea53433f2dd70f842ef0"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["cas.lua"]={ctime=1792193466807941957,inode=1171724,mtime=1792193466807941957,sha1="52f301f31133a70da688cb5fcb583fde6d0c627f",size=10081.0},["daemon.lua"]={ctime=1792193089217342998,inode=1171741,mtime=1792193089217342998,sha1="10eaf1e73fd8535a95c7d89e483c6afc8948271a",size=7017.0},["daemon_q.lua"]={ctime=1792193104961558521,inode=1171742,mtime=1792193104961558521,sha1="980342b962d2cc263ee0e33022208647c68c9fa2",size=3444.0},["flake.lua"]={ctime=1792193208440322150,inode=1171532,mtime=1792193208440322150,sha1="f6d0e2ab6e676886f77b0d0adfa6629a6edc1161",size=41260.0},["jobserver.lua"]={ctime=1792193662377535188,inode=1171717,mtime=1792193662377535188,sha1="81ba9b9adb7a4ae0ac5c344ce9609b115cd84698",size=5963.0},["operator.lua"]={ctime=1792189297018152350,inode=1173002,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["process.lua"]={ctime=1792191937955840437,inode=1171571,mtime=1792191937955840437,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0},["trace.lua"]={ctime=1792191937918388369,inode=1171738,mtime=1792191937918388369,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="daemon.lua"},["luaIO.run/b384c1ee39e7ad7791aae91ec978e7d505fe4067"]={buildName="luaIO.run/49",sources={["../luau/out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["../luau/out/release/heap.lua"]="a00d42a11fbcf141902cc317b27fb2edec6d9b10",["../luau/out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["../luau/out/release/list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["../luau/out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["../luau/out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["../luau/out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["../luau/out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["../luau/out/release/thread.lua"]="cc23fc22c91b8e54da1aeccf5d77b3f4f00259a8",["../luau/out/release/xpio.lua"]="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",[".flake/luaIO.program/1/interpreter"]="590b448ce6f7d3cc4935f2f91e92a56cfcc33f50",["flake.lua"]="5c5bf9f5c4167ab0182e15b1f46ee0ec96c5c877",["flake_q.lua"]="915084b6235744e2447a79e0c098de94bd566cc6",["operator.lua"]="a8147059b85bccba9906bd0b766480c030a43704"},valid=true,value="flake.lua"},["luaIO.run/be95364b4560138de0567af7d69dee7bde8aabf4"]={buildName="luaIO.run/10",sources={["../luau/out/release/fsu.lua"]={ctime=1792182362546028725,inode=1172914,mtime=1792182362546028725,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792182362544626462,inode=1172912,mtime=1792182362544626462,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792182362545449655,inode=1172922,mtime=1792182362545449655,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792182362544887034,inode=1172924,mtime=1792182362544887034,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792182362545188427,inode=1172925,mtime=1792182362545188427,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792182362543738907,inode=1172917,mtime=1792182362543738907,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792182362545878918,inode=1172921,mtime=1792182362545878918,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792182362545017796,inode=1172919,mtime=1792182362545017796,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792182362543313457,inode=1172916,mtime=1792182362543313457,sha1="e308397572e2d90a669adcab61992c9b063998ba",size=8086.0},["../luau/out/release/xpio.lua"]={ctime=1792182362543928831,inode=1172915,mtime=1792182362543928831,sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",size=6703.0},["flake.lua"]={ctime=1792182339816163458,inode=1171505,mtime=1792182339816163458,sha1="8b688cc50e56bcf47991e64092d194fad9b4666e",size=22534.0},["flakeExe_q.lua"]={ctime=1792181594449495463,inode=1172246,mtime=1792181594449495463,sha1="34bf1f63d7988f2540f60f1004e0b608261e474d",size=2082.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["out/release/flake"]={sha1="e2383d31cb518941091b6380a87b3288aeb7392b"},["process.lua"]={ctime=1792179886741954590,inode=1171518,mtime=1454600802000000000,sha1="b30ad3fc1b9ae3060830be02e5ea79820138ba25",size=1672.0}},valid=true,value="out/release/flake"},["luaIO.run/c1500ce23db3b9277a18f22ffba9a9e218a3e26a"]={buildName="luaIO.run/9",sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="e308397572e2d90a669adcab61992c9b063998ba"},["../luau/out/release/xpexec.lua"]={sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc"},["../luau/out/release/xpio.lua"]={sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04"},[".flake/luaIO.program/1/interpreter"]={sha1="4ca7b08c57c4ffaa3d7a040ffa4dc145ee462073"},["flake.lua"]={ctime=1792182339816163458,inode=1171505,mtime=1792182339816163458,sha1="8b688cc50e56bcf47991e64092d194fad9b4666e",size=22534.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["systemIO.lua"]={ctime=1792182339815685902,inode=1172148,mtime=1792182339815685902,sha1="c36fb663726e543bdbbf9724766b622879100f98",size=5396.0},["systemIO_q.lua"]={ctime=1792179886741954590,inode=1171522,mtime=1454600802000000000,sha1="e9f512bd38c3d5b4a75e72141199ac1473ffea22",size=1022.0}},valid=true,value="systemIO.lua"},["luaIO.run/c16974cfa0efa406740eda2a6c94b1df16568893"]={buildName="luaIO.run/11",sources={["../luau/out/release/fsu.lua"]={ctime=1792184080570749217,inode=1172914,mtime=1792184080570749217,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792184080568453229,inode=1172912,mtime=1792184080568453229,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184080567576066,inode=1172922,mtime=1792184080567576066,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792184080568773663,inode=1172924,mtime=1792184080568773663,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792184080567214460,inode=1172925,mtime=1792184080567214460,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792184080571029488,inode=1172917,mtime=1792184080571029488,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792184080570561276,inode=1172921,mtime=1792184080570561276,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184080572139347,inode=1172919,mtime=1792184080572139347,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184080569844405,inode=1172916,mtime=1792184080569844405,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792184080570065059,inode=1172915,mtime=1792184080570065059,sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04",size=6703.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792182757451697990,inode=1172252,mtime=1792182757451572117,sha1="16691c24094e2189e5a5a4d31dca19b3b45dd2aa",size=300672.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["flake.lua"]={ctime=1792184194315598468,inode=1172205,mtime=1792184194315598468,sha1="a10cdb80f3cddd465b2d0ca042a763fa396a36bd",size=30890.0},["flake_q.lua"]={ctime=1792184095599490830,inode=1172804,mtime=1792184095599490830,sha1="f536a2a477ee4b3dac88b41a3445fbcf827f7acd",size=8198.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0}},valid=true,value="flake.lua"},["luaIO.run/c9b747ad0349bdb1273028bfd439887c25e917b7"]={buildName="luaIO.run/7",sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/list.lua"]={sha1="ee759597989305d90572e637f34c2ae1ce0d5737"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="e308397572e2d90a669adcab61992c9b063998ba"},["../luau/out/release/xpio.lua"]={sha1="8a34c8a508612cdff4ebc812c1c3ee16cbe0bb04"},[".flake/luaIO.program/1/interpreter"]={sha1="4ca7b08c57c4ffaa3d7a040ffa4dc145ee462073"},["flake.lua"]={ctime=1792182339816163458,inode=1171505,mtime=1792182339816163458,sha1="8b688cc50e56bcf47991e64092d194fad9b4666e",size=22534.0},["flake_q.lua"]={ctime=1792181904803077774,inode=1171508,mtime=1792181904803077774,sha1="83424c64c105442f20fbf84d3c932604b7ca3425",size=6389.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0}},valid=true,value="flake.lua"},["luaIO.run/c9c525f742fc2df7a86bf159e14f4af8cbd37593"]={buildName="luaIO.run/43",outputs={["process.lua"]="23f6ef6f818009bb76375b673a7e73cf849187ad"},sources={["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["process.lua"]={ctime=1792189297018463715,inode=1173005,mtime=1792184612000000000,sha1="23f6ef6f818009bb76375b673a7e73cf849187ad",size=2277.0},["process_q.lua"]={ctime=1792189297021741360,inode=1173010,mtime=1792184612000000000,sha1="151b97d2d6849bf042b07bd77f2816e069dd7472",size=560.0}},valid=true,value="process.lua"},["luaIO.run/d0b2529d2f39335e8ff407a337157ba73719d3ff"]={buildName="luaIO.run/25",outputs={["flake.lua"]="fa66f8abebc80207806c32de1efc469d92cbfd84"},sources={["../luau/out/release/fsu.lua"]={ctime=1792184673376915836,inode=1172914,mtime=1792184673376915836,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792184673375851630,inode=1172912,mtime=1792184673375851630,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184673375534208,inode=1172922,mtime=1792184673375534208,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/list.lua"]={ctime=1792184673370160935,inode=1172924,mtime=1792184673370160935,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["../luau/out/release/object.lua"]={ctime=1792184673376187655,inode=1172925,mtime=1792184673376187655,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792184673375107179,inode=1172917,mtime=1792184673375107179,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792184673370845828,inode=1172921,mtime=1792184673370845828,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184673376549334,inode=1172919,mtime=1792184673376549334,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184673374628688,inode=1172916,mtime=1792184673374628688,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792184673378198418,inode=1172915,mtime=1792184673378198418,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["flake.lua"]={ctime=1792185010736191279,inode=1172825,mtime=1792185010736191279,sha1="fa66f8abebc80207806c32de1efc469d92cbfd84",size=36874.0},["flake_q.lua"]={ctime=1792185017092386993,inode=1173050,mtime=1792185017092386993,sha1="403d7379dca71b073a619629a0f2c940b25ad939",size=10525.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["operator.lua"]={ctime=1792179886741954590,inode=1171513,mtime=1454600802000000000,sha1="a8147059b85bccba9906bd0b766480c030a43704",size=729.0},["trace.lua"]={ctime=1792184137937463082,inode=1172069,mtime=1792184137937463082,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0}},valid=true,value="flake.lua"},["luaIO.run/d54c80fd79139d948974ee2733ac0bdfd6ae6925"]={buildName="luaIO.run/58",graphKey="luaIO.run/5a16ff281adb53d49f4ae16b1fb9975ff4589f4d",outputs={["trace.lua"]="46db5162fad787c0fe275d4cbd64d16266ca03fa"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["trace.lua"]={ctime=1792191937918388369,inode=1171738,mtime=1792191937918388369,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0},["trace_q.lua"]={ctime=1792191937918388369,inode=1171739,mtime=1792191937918388369,sha1="b0459b19c87e192079063d4c690cacb51e0b8117",size=1358.0}},valid=true,value="trace.lua"},["luaIO.run/d70366c6466a472aea52e5e3859513379f7eaa46"]={buildName="luaIO.run/38",outputs={["trace.lua"]="46db5162fad787c0fe275d4cbd64d16266ca03fa"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["trace.lua"]={ctime=1792189297021741360,inode=1173022,mtime=1792184137000000000,sha1="46db5162fad787c0fe275d4cbd64d16266ca03fa",size=4046.0},["trace_q.lua"]={ctime=1792189296974501830,inode=1172922,mtime=1792184212000000000,sha1="b0459b19c87e192079063d4c690cacb51e0b8117",size=1358.0}},valid=true,value="trace.lua"},["luaIO.run/e4b7d4aea91216e2dd08abb6eca012c7f5411dca"]={buildName="luaIO.run/8",sources={["../luau/out/release/heap.lua"]={ctime=1792184673375851630,inode=1172912,mtime=1792184673375851630,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/object.lua"]={ctime=1792184673376187655,inode=1172925,mtime=1792184673376187655,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792184673375107179,inode=1172917,mtime=1792184673375107179,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792184673370845828,inode=1172921,mtime=1792184673370845828,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/thread.lua"]={ctime=1792184673374628688,inode=1172916,mtime=1792184673374628688,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792184673378198418,inode=1172915,mtime=1792184673378198418,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["jobserver.lua"]={ctime=1792182332937525963,inode=1172131,mtime=1792182332933525963,sha1="b23e89cb676f9840759fc37b0a82d62a1289efad",size=5379.0},["jobserver_q.lua"]={ctime=1792182354313525963,inode=1172068,mtime=1792182354313525963,sha1="ad8822315a1ba746f914a6b0ab0f452420cdee66",size=2227.0}},valid=true,value="jobserver.lua"},["luaIO.run/ee0c4c0979dd5c6cdf7b69bdadd6e7d229a20b4e"]={buildName="luaIO.run/16",sources={["../luau/out/release/fsu.lua"]={ctime=1792184673376915836,inode=1172914,mtime=1792184673376915836,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792184673375851630,inode=1172912,mtime=1792184673375851630,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184673375534208,inode=1172922,mtime=1792184673375534208,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/object.lua"]={ctime=1792184673376187655,inode=1172925,mtime=1792184673376187655,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792184673375107179,inode=1172917,mtime=1792184673375107179,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792184673370845828,inode=1172921,mtime=1792184673370845828,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184673376549334,inode=1172919,mtime=1792184673376549334,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184673374628688,inode=1172916,mtime=1792184673374628688,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792184673378198418,inode=1172915,mtime=1792184673378198418,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["cas_q.lua"]={ctime=1792182555440937663,inode=1172319,mtime=1792182555440937663,sha1="2f4a84dc8b307f99327014e900662ee03be46ff7",size=1804.0}},valid=true,value="cas.lua"},["luaIO.run/ee6dbbf590250ce7aeb3efcbdf51b467b9616612"]={buildName="luaIO.run/32",outputs={["remoteCache.lua"]="24d76dc2e0190443d23f509ad723e6d626e3ea2a"},sources={["../luau/out/release/fsu.lua"]={sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},["../luau/out/release/heap.lua"]={sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},["../luau/out/release/lfsu.lua"]={sha1="875434cb7808e599e3df8a85f17d7ebce527c495"},["../luau/out/release/object.lua"]={sha1="d69b0c8869f070db83f431164d417851153db04f"},["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},["../luau/out/release/queue.lua"]={sha1="892c54ad53db8fb2b36404fb769db58c205380ca"},["../luau/out/release/serialize.lua"]={sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74"},["../luau/out/release/thread.lua"]={sha1="131fbadfcdf8fb061c1d261153ccde807d87a405"},["../luau/out/release/xpio.lua"]={sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},[".flake/luaIO.program/1/interpreter"]={ctime=1792190888324251585,inode=1180244,mtime=1792190888324145636,sha1="bbdd5a3df68b0b750c860f6609d4583261c506de",size=314840.0},["cas.lua"]={ctime=1792189296974501830,inode=1172920,mtime=1792182711000000000,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["remoteCache.lua"]={ctime=1792189297021741360,inode=1173017,mtime=1792183805000000000,sha1="24d76dc2e0190443d23f509ad723e6d626e3ea2a",size=8347.0},["remoteCache_q.lua"]={ctime=1792189296974501830,inode=1172930,mtime=1792183805000000000,sha1="ae7e10cc0f2ab9501cf8f47e1266d9b6dee3f6c0",size=2552.0}},valid=true,value="remoteCache.lua"},["luaIO.run/ef226a3d5a045dc1cc62ff4223647b52c738238a"]={buildName="luaIO.run/23",sources={["../luau/out/release/fsu.lua"]={ctime=1792184673376915836,inode=1172914,mtime=1792184673376915836,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["../luau/out/release/heap.lua"]={ctime=1792184673375851630,inode=1172912,mtime=1792184673375851630,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["../luau/out/release/lfsu.lua"]={ctime=1792184673375534208,inode=1172922,mtime=1792184673375534208,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["../luau/out/release/object.lua"]={ctime=1792184673376187655,inode=1172925,mtime=1792184673376187655,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["../luau/out/release/qtest.lua"]={ctime=1792184673375107179,inode=1172917,mtime=1792184673375107179,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["../luau/out/release/queue.lua"]={ctime=1792184673370845828,inode=1172921,mtime=1792184673370845828,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["../luau/out/release/serialize.lua"]={ctime=1792184673376549334,inode=1172919,mtime=1792184673376549334,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["../luau/out/release/thread.lua"]={ctime=1792184673374628688,inode=1172916,mtime=1792184673374628688,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["../luau/out/release/xpio.lua"]={ctime=1792184673378198418,inode=1172915,mtime=1792184673378198418,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},[".flake/luaIO.program/1/interpreter"]={ctime=1792184674037965840,inode=1172182,mtime=1792184674033525963,sha1="e45185d40df7aa05663f8ac1363b7be8567fddb5",size=305624.0},["cas.lua"]={ctime=1792182711160956179,inode=1172042,mtime=1792182711160956179,sha1="905162315e897801411fba11c0ea5708298b0123",size=7958.0},["remoteCache.lua"]={ctime=1792183805097674884,inode=1171512,mtime=1792183805097674884,sha1="24d76dc2e0190443d23f509ad723e6d626e3ea2a",size=8347.0},["remoteCache_q.lua"]={ctime=1792183805098145380,inode=1172172,mtime=1792183805098145380,sha1="ae7e10cc0f2ab9501cf8f47e1266d9b6dee3f6c0",size=2552.0}},valid=true,value="remoteCache.lua"},["luaIO.run/f8986a5243c04274a3f9bfdb09ef343994533e5b"]={buildName="luaIO.run/63",graphKey="luaIO.run/2fa90d4b5356a170b5eb5648b56075d018faacc7",outputs={["depfile.lua"]="6495bf986ec19a1edf9e731f4870db069b6fdb28"},sources={["../luau/out/release/qtest.lua"]={sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},[".flake/luaIO.program/1/interpreter"]={sha1="854863dbe373a40de044ebbdef75c8e0444ff9c9"},["depfile.lua"]={ctime=1792191937994718588,inode=1171746,mtime=1792191937994718588,sha1="6495bf986ec19a1edf9e731f4870db069b6fdb28",size=1782.0},["depfile_q.lua"]={ctime=1792191937994889047,inode=1171747,mtime=1792191937994889047,sha1="0536168b8a56a0c81cab99de4fe26e45a622b8df",size=765.0}},valid=true,value="depfile.lua"},["systemIO.directory/52a6d631c751bb60dfd732c4583737b600f983c4"]={buildName="systemIO.directory/1",graphKey="systemIO.directory/6ac55a8ee2a7e6619a7fecdd5f12234fa0006f91",outputs={["out/release/flake"]="989f49f76d45213b238e8bc233fd8f2ca7068b06"},sources={["out/release/flake"]={sha1="cf1b81c6bb3eb1bd6c433c53629dadd50ac77047"}},valid=true,value={contents={flake="out/release/flake"},path="out/release"}},["systemIO.execute/0f05801c853360379b339e0e7bd34450551218ff"]={buildName="systemIO.execute/1",graphKey="systemIO.execute/6c5bd66cc0b5b2da2cb527960dd3d1f66377af8d",outputs={["out/release/flake"]="989f49f76d45213b238e8bc233fd8f2ca7068b06"},sources={["out/release/flake"]={sha1="cf1b81c6bb3eb1bd6c433c53629dadd50ac77047"}},valid=true,value="out/release/flake"}}}
\ No newline at end of file
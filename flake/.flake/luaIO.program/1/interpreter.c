@@ -0,0 +1,353 @@
+// Generated by cfromlua
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define ARRAYLENGTH(a)   (sizeof(a) / sizeof(a[0]))
+
+static const unsigned char data0[] = 
+  "local argv,getModInfo,getModFunc,preloads=...\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=\"\"\n"
+  "package.cpath=\"\"\n"
+  "\n"
+  "local function start()\n"
+  "\n"
+  "for n=2,math.huge do\n"
+  "local name=getModInfo(n)\n"
+  "if not name then break end\n"
+  "package.preload[name]=getModFunc(n)\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m in preloads:gmatch(\"[^;]+\")do\n"
+  "require(m)\n"
+  "end\n"
+  "\n"
+  "local main=getModFunc(1)\n"
+  "arg=argv\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "return main(unpack(argv))\n"
+  "end\n"
+  "\n"
+  "local succ,v=xpcall(start,debug.traceback)\n"
+  "if not succ then\n"
+  "print(\"Unhandled error: \"..v)\n"
+  "return 1\n"
+  "end\n"
+  "return tonumber(v)or 0\n"
+  "\n"
+  "";
+
+static const unsigned char data1[] = 
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "\n"
+  "package.path=os.getenv(\"LUA_PATH\")or\";\?.lua;\"\n"
+  "package.cpath=os.getenv(\"LUA_CPATH\")or\";\?.so;\"\n"
+  "local progname=arg[0]\n"
+  "local interact=false\n"
+  "local execed=false\n"
+  "local loadstdin=false\n"
+  "local showver=false\n"
+  "\n"
+  "local unpack=table.unpack or unpack\n"
+  "local load=loadstring or load\n"
+  "\n"
+  "local version=_VERSION..\"/fromlua interpreter.lua\"\n"
+  "\n"
+  "local usagestr=[=[\n"
+  "_VER\n"
+  "usage: _PROG [options] [script [args]]\n"
+  "Options are:\n"
+  "   -e str    execute string 'str'\n"
+  "   -l lib    require package 'lib'\n"
+  "   -i        enter interactive mode after processing other arguments\n"
+  "   -v        show version information\n"
+  "   --        stop processing options\n"
+  "   -         execute stdin and stop handling options\n"
+  "]=]\n"
+  "\n"
+  "local function usage()\n"
+  "io.write((usagestr:gsub(\"_[A-Z]+\",{_PROG=progname,_VER=version})))\n"
+  "return 1\n"
+  "end\n"
+  "\n"
+  "local function trace(err)\n"
+  "local str=debug.traceback(err,2)\n"
+  "\n"
+  "return str:gsub(\"\\n[^\\n]*\\n[^\\n]*\\n[^\\n]*\\n[^\\n]*\\n[^\\n]*\\n[^\\n]*$\",\"\")\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local an=#arg\n"
+  "local n=1\n"
+  "\n"
+  "local function getParam(a)\n"
+  "if#a>2 then\n"
+  "return a:sub(3)\n"
+  "end\n"
+  "n=n+1\n"
+  "return arg[n]\n"
+  "end\n"
+  "\n"
+  "while n<=an do\n"
+  "local a=arg[n]\n"
+  "if a==\"-l\"then\n"
+  "n=n+1\n"
+  "require(arg[n])\n"
+  "elseif a==\"-i\"then\n"
+  "interact=true\n"
+  "elseif a:match(\"^%-l\")then\n"
+  "require(getParam(a))\n"
+  "elseif a:match(\"^%-e\")then\n"
+  "local fn,err=load(getParam(a),\"=(command line)\")\n"
+  "if not fn then\n"
+  "print(progname..\": \"..err)\n"
+  "return 1\n"
+  "end\n"
+  "fn()\n"
+  "execed=true\n"
+  "elseif a==\"-v\"then\n"
+  "showver=true\n"
+  "execed=true\n"
+  "elseif a==\"--\"then\n"
+  "n=n+1\n"
+  "break\n"
+  "elseif a==\"-\"then\n"
+  "loadstdin=true\n"
+  "break\n"
+  "elseif a:match(\"^%-\")then\n"
+  "return usage()\n"
+  "else\n"
+  "break\n"
+  "end\n"
+  "n=n+1\n"
+  "end\n"
+  "\n"
+  "\n"
+  "for m=0,an+n do\n"
+  "arg[m-n]=arg[m]\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local result=0\n"
+  "\n"
+  "if loadstdin or arg[0]then\n"
+  "local fn,err\n"
+  "if loadstdin then\n"
+  "fn,err=load(io.read,\"=stdin\")\n"
+  "else\n"
+  "fn,err=loadfile(arg[0])\n"
+  "end\n"
+  "if not fn then\n"
+  "print(progname..\": \"..err)\n"
+  "return 1\n"
+  "end\n"
+  "local succ,err=xpcall(function()return fn(unpack(arg))end,trace)\n"
+  "if not succ then\n"
+  "print(err)\n"
+  "return 1\n"
+  "end\n"
+  "result=err\n"
+  "execed=true\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "interact=interact or not execed\n"
+  "if showver or interact then\n"
+  "print(version)\n"
+  "end\n"
+  "\n"
+  "if not interact then\n"
+  "return result\n"
+  "end\n"
+  "\n"
+  "\n"
+  "\n"
+  "local function showResult(succ,...)\n"
+  "if select('#',...)>=1 then\n"
+  "print(...)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "local continued=\"\"\n"
+  "while true do\n"
+  "io.write(\"> \")\n"
+  "local a=io.read(\"*l\")\n"
+  "if not a or a:match(\" *quit *\")then\n"
+  "break\n"
+  "end\n"
+  "a=continued..a:gsub(\"^=\",\"return \")\n"
+  "continued=\"\"\n"
+  "local fn,err=load(a,\"=stdin\")\n"
+  "if fn then\n"
+  "\n"
+  "\n"
+  "\n"
+  "showResult(xpcall(fn,trace))\n"
+  "elseif err and err:match(\"<eof>()\")==#err then\n"
+  "io.write(\">\")\n"
+  "continued=a..\"\\n\"\n"
+  "else\n"
+  "print(err)\n"
+  "end\n"
+  "end\n"
+  "\n"
+  "\n"
+  "return result\n"
+  "";
+
+extern int luaopen_sha1(lua_State *);
+
+extern int luaopen_xpfs(lua_State *);
+
+extern int luaopen_xpio_c(lua_State *);
+
+
+
+int luaopen_requirefile(lua_State *L);
+
+
+typedef struct {
+   const char *  pszName;      // module name
+   const char *  pszSource;    // loadbuffer arg (location/source)
+   const char *  pc;           // contents of file
+   size_t        cb;           // size of pc[]
+   lua_CFunction fn;           // C function
+} BuiltIns;
+
+
+// mods[0] = preamble
+// mods[1] = main Lua source
+// mods[2...] = source modules, native modules, or requirefiles
+static const BuiltIns mods[] = { 
+   { 0, "(preamble)", (const char *) data0, 503, 0 },
+   { 0, "@.flake/luaIO.program/1/interpreter.lua", (const char *) data1, 2429, 0 },
+   { "sha1", 0, (const char *) 0, 0, luaopen_sha1 },
+   { "xpfs", 0, (const char *) 0, 0, luaopen_xpfs },
+   { "xpio_c", 0, (const char *) 0, 0, luaopen_xpio_c }
+};
+
+
+
+static int requirefile(lua_State *L)
+{
+   (void) L;
+   return 0;
+}
+
+
+
+int luaopen_requirefile(lua_State *L)
+{
+   lua_pushcfunction(L, &requirefile);
+   return 1;
+}
+
+
+// ndx -> name, text
+static int getModInfo(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   lua_pushstring(L, mods[ndx].pszName);
+   return 1;
+}
+
+
+// ndx --> function
+static int getModFunc(lua_State *L)
+{
+   size_t ndx = lua_tointeger(L, 1);
+   if (ndx >= ARRAYLENGTH(mods)) {
+      return 0;
+   }
+
+   if (mods[ndx].fn) {
+      lua_pushcfunction(L, mods[ndx].fn);
+   } else if (!mods[ndx].pszSource) {
+      return 0;
+   } else if (luaL_loadbuffer(L, mods[ndx].pc, mods[ndx].cb, mods[ndx].pszSource)) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+
+static int pmain(lua_State *L)
+{
+   int argc = lua_tointeger(L, 1);
+   char **argv = (char **) lua_touserdata(L, 2);
+   int n;
+
+   lua_gc(L, LUA_GCSTOP, 0);
+   luaL_openlibs(L);
+   lua_gc(L, LUA_GCRESTART, 0);
+
+   if (luaL_loadbuffer(L, mods[0].pc, mods[0].cb, mods[0].pszSource)) {
+      return lua_error(L);
+   }
+
+   lua_createtable(L, argc-1, 1);        // argv
+   for (n = 0; n < argc; ++n) {
+      lua_pushstring(L, argv[n]);
+      lua_rawseti(L, -2, n);
+   }
+
+   lua_pushcfunction(L, &getModInfo);    // getModInfo
+   lua_pushcfunction(L, &getModFunc);    // getModFunc
+   lua_pushliteral(L, "");      // preloads
+
+   lua_call(L, 4, 1);
+
+   return 1;
+}
+
+
+int main (int argc, char **argv)
+{
+   int exitCode = EXIT_FAILURE;
+   int nErr;
+   lua_State *L;
+
+   L = luaL_newstate();
+   if (L == NULL) {
+      fprintf(stderr, "lua_open failed: not enough memory\n");
+      return EXIT_FAILURE;
+   }
+
+   lua_pushcfunction(L, &pmain);
+   lua_pushinteger(L, argc);
+   lua_pushlightuserdata(L, argv);
+   nErr = lua_pcall(L, 2, 1, 0);
+
+   if (nErr == LUA_ERRRUN) {
+      fprintf(stderr, "pmain error:\n%s\n", lua_tostring(L, -1));
+   } else if (nErr) {
+      fprintf(stderr, "pmain failed: err = %d\n", nErr);
+   } else if (lua_isnumber(L, 1)) {
+      exitCode = lua_tointeger(L, 1);
+   }
+
+   lua_close(L);
+   return exitCode;
+}
+
@@ -0,0 +1,5 @@
+local flake = require 'flake'
+local function foo()
+end
+local fooBuilder = flake.lift(foo, 'foo')
+return fooBuilder()
@@ -0,0 +1 @@
+bbb
\ No newline at end of file
@@ -0,0 +1 @@
+countRun() return {1}
\ No newline at end of file
@@ -0,0 +1 @@
+FOO
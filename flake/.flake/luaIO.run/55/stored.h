@@ -0,0 +1 @@
+QUX
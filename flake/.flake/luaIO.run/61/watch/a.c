@@ -0,0 +1 @@
+aaa
\ No newline at end of file
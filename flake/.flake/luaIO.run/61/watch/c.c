@@ -0,0 +1 @@
+cc
\ No newline at end of file
@@ -0,0 +1,6 @@
+    local flake = require 'flake'
+    local read = flake.lift(function(cfg, p)
+      return nil, io.open(p):read('a')
+    end, 'read', {getInputFiles = function(cfg, p) return {p} end})
+    return read("/root/repo/flake/.flake/luaIO.run/64/daemon/src.txt")
+  
\ No newline at end of file
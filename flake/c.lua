@@ -6,8 +6,39 @@ local list    = require 'list'
 local system  = require 'system'
 local listBuilders = require 'listBuilders'
 
+-- Unity builds: given 'unity = {batchSize = N}', sources are compiled in
+-- batches of N, each as one translation unit that includes them.  Batches
+-- follow the order the sources are listed in, so adding a source at the
+-- end of the list only rebuilds the last batch.
+local unityObjects = flake.liftPure(function(sourceFiles, ps)
+  local size = ps.unity.batchSize or 16
+  local objs = {}
+  for i = 1, #sourceFiles, size do
+    local objPs = list.clone(ps)
+    objPs.unity = nil
+    objPs.sourceFile = c.unitySource {
+      sourceFiles = table.move(sourceFiles, i, math.min(i + size - 1, #sourceFiles), 1, {}),
+      index = (i - 1) // size + 1,
+    }
+    table.insert(objs, c.object(objPs))
+  end
+  return objs
+end, 'c.unityObjects')
+
+-- The parameters for compiling the sources of a library or program.
+local function objectParams(ps)
+  local ps = list.clone(ps)
+  ps.sourceFiles = nil
+  ps.objectFiles = nil
+  ps.name = nil
+  ps.libs = nil
+  ps.thin = nil
+  return ps
+end
+
 -- Extend the library builder to accept source files instead of
--- only object files.
+-- only object files.  They are compiled with the library's parameters,
+-- including 'pch', a precompiled header from c.precompiledHeader.
 local library = c.library
 c.library = function(ps)
   local ps = list.clone(ps)
@@ -15,14 +46,24 @@ c.library = function(ps)
     ps.ar = c.config.ar
   end
   if type(ps.sourceFiles) == 'table' then
+    -- Objects are made when the list is lowered, after 'ps' is changed.
+    local pch = ps.pch
     local function mkObj(src)
       local ps = list.clone(ps)
       ps.sourceFiles = nil
       ps.objectFiles = nil
       ps.sourceFile = src
+      ps.name = nil
+      ps.thin = nil
+      ps.pch = pch
       return c.object(ps)
     end
-    local objs = listBuilders.map(ps.sourceFiles, mkObj)
+    local objs
+    if ps.unity then
+      objs = unityObjects(ps.sourceFiles, objectParams(ps))
+    else
+      objs = listBuilders.map(ps.sourceFiles, mkObj)
+    end
     if type(ps.objectFiles) == 'table' then
       listBuilders.append(ps.objectFiles, objs)
     else
@@ -30,9 +71,25 @@ c.library = function(ps)
     end
   end
   ps.sourceFiles = nil
+  ps.pch = nil
+  ps.unity = nil
   return library(ps)
 end
 
+-- Extend the program builder to compile its sources as a unity build.
+local program = c.program
+c.program = function(ps)
+  if not (ps.unity and type(ps.sourceFiles) == 'table') then
+    return program(ps)
+  end
+  local ps = list.clone(ps)
+  ps.objectFiles = unityObjects(ps.sourceFiles, objectParams(ps))
+  ps.sourceFiles = nil
+  ps.pch = nil
+  ps.unity = nil
+  return program(ps)
+end
+
 c.run = function(ps)
   local args = {c.program(ps)}
   for _,v in ipairs(ps.args or {}) do
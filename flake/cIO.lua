@@ -3,6 +3,13 @@ local process  = require 'process'
 local path     = require 'path'
 local lfsu     = require 'lfsu'
 local list     = require 'list'
+local depfile  = require 'depfile'
+local cas      = require 'cas'
+local compilerCache = require 'compilerCache'
+local xpfs     = require 'xpfs'
+local xpio     = require 'xpio'
+local serialize = require 'serialize'
+local thread   = require 'thread'
 
 local flavors = {
   release = {'-Wall', '-Werror', '-O2'},
@@ -20,6 +27,9 @@ local config = {
    cc  = os.getenv('CC')  or 'clang',
    cxx = os.getenv('CXX') or 'clang++',
    ar  = os.getenv('AR')  or 'ar',
+   -- Commands longer than this, in bytes, pass their inputs in a response
+   -- file.  Linux limits a single argument to 128KiB.
+   responseFileMin = 64 * 1024,
 }
 
 local function isCxx(p)
@@ -31,19 +41,72 @@ local function chooseCompiler(xs)
   return config[cxxFile and 'cxx' or 'cc']
 end
 
+-- Quote 'a' for a response file, as read by GCC and binutils.
+local function quoteResponseArg(a)
+  return (a:gsub('[%s\'"\\]', '\\%0'))
+end
+
+-- Return 'args', with 'args[first]' onward moved to a response file in
+-- 'cfg.buildDir' if the command is too long.  The file is named after
+-- 'name' and is rewritten only when its contents change.
+local function responseFileArgs(cfg, args, first, name)
+  local len = 0
+  for _,a in ipairs(args) do
+    len = len + #a + 1
+  end
+  if len < config.responseFileMin then
+    return args
+  end
+
+  local t, lines = {}, {}
+  for i,a in ipairs(args) do
+    if i < first then
+      table.insert(t, a)
+    else
+      table.insert(lines, quoteResponseArg(a) .. '\n')
+    end
+  end
+  local rsp = cfg.buildDir .. '/' .. path.takeFileName(name) .. '.rsp'
+  local text = table.concat(lines)
+  if lfsu.read(rsp) ~= text then
+    lfsu.mkdir_p(cfg.buildDir)
+    lfsu.write(rsp, text)
+  end
+  table.insert(t, '@' .. rsp)
+  return t
+end
+
+-- Append the flags that make the compiler use the precompiled header
+-- 'pch', from precompiledHeader.
+local function insertPchArgs(args, pch)
+  if pch:match('%.gch$') then
+    table.insert(args, '-include')
+    table.insert(args, pch:sub(1, -5))
+  else
+    table.insert(args, '-include-pch')
+    table.insert(args, pch)
+  end
+end
+
 local function program(cfg, ps)
   if osName == nil then
     init()
   end
 
   local sourceFiles = ps.sourceFiles or {ps.sourceFile or ps[1]}
+  local objectFiles = ps.objectFiles or {}
   local name = ps.name or cfg.outPath or (sourceFiles[1] and cfg.buildDir .. '/' .. path.takeBaseName(sourceFiles[1]))
+                                      or (objectFiles[1] and path.dropExtension(objectFiles[1]))
 
   local cc = ps.cc or chooseCompiler(sourceFiles)
 
   -- TODO: check isatty() before adding -fcolor-diagnostics
   local args = {cc, '-o', name}
 
+  -- The header applies to the sources compiled here, not to objects.
+  if ps.pch then
+    insertPchArgs(args, ps.pch)
+  end
   if type(ps.includeDirs) == 'table' then
     for i,v in ipairs(ps.includeDirs) do
       table.insert(args, '-I'..v)
@@ -55,6 +118,9 @@ local function program(cfg, ps)
       table.insert(args, v)
     end
   end
+  for _,v in ipairs(objectFiles) do
+    table.insert(args, v)
+  end
 
   if type(ps.libs) == 'table' then
     for i,v in ipairs(ps.libs) do
@@ -79,9 +145,325 @@ local function program(cfg, ps)
 
   local outdir = path.takeDirectory(name)
   lfsu.mkdir_p(outdir)
+  args = responseFileArgs(cfg, args, 4, name)
   return systemIO.execute(cfg, {args=args, env=env, thenReturn=name})
 end
 
+local function isCxxHeader(p)
+  local ext = path.takeExtension(p)
+  return ext == '.hpp' or ext == '.hh' or ext == '.hxx' or ext == '.H'
+end
+
+local function isClang(cc)
+  local nm = path.takeFileName(cc)
+  return nm:match('clang') ~= nil or osName == 'Darwin' and (nm == 'cc' or nm == 'c++')
+end
+
+-- Return 'p', or 'dir/p' if 'p' is relative.
+local function resolve(dir, p)
+  return p:sub(1,1) == '/' and p or dir .. '/' .. p
+end
+
+-- Report the files a compile read, other than 'sourceFile', so that
+-- editing one rebuilds the output.  Relative paths are relative to 'dir'.
+local function reportInputs(cfg, dir, files, sourceFile)
+  if not cfg.inputFiles then
+    return
+  end
+  local function abs(p)
+    return lfsu.cleanpath(p:sub(1,1) == '/' and p or dir .. '/' .. p)
+  end
+  local src = abs(sourceFile)
+  for _,p in ipairs(files) do
+    if abs(p) ~= src then
+      table.insert(cfg.inputFiles, abs(p))
+    end
+  end
+end
+
+-- Run the compile command 'args', which writes a depfile to 'depPath', and
+-- report the headers it read.
+local function compile(cfg, args, env, name, depPath, sourceFile)
+  local dir = xpfs.getcwd()
+  local err, out = systemIO.execute(cfg, {args=args, env=env, thenReturn=name})
+  if err == nil then
+    local depPath = depPath:sub(1,1) == '/' and depPath or dir .. '/' .. depPath
+    reportInputs(cfg, dir, depfile.read(depPath) or {}, sourceFile)
+  end
+  return err, out
+end
+
+-- Compile through the compiler cache at 'cfg.compilerCache', which holds
+-- objects by compiler, flags, and preprocessed source (see
+-- compilerCache.lua).  On a hit, the object is copied from the cache.
+local function cachedCompile(cfg, args, env, name, depPath, sourceFile)
+  local dir = xpfs.getcwd()
+  -- Preprocess in a job slot, which is given back even if this task
+  -- raises an error or is killed, as in systemIO.execute.
+  local jobs = cfg.jobs
+  local exitId
+  if jobs then
+    local t0 = xpio.gettime()
+    jobs:acquire()
+    cfg.slotWait = (cfg.slotWait or 0) + xpio.gettime() - t0
+    exitId = thread.atExit(jobs.release, jobs)
+  end
+  local ok, code, text = pcall(process.readProcess, compilerCache.preprocessArgs(args), env)
+  if jobs then
+    thread.cancelAtExit(exitId)
+    jobs:release()
+  end
+  if not ok then
+    error(code, 0)
+  end
+  local k = code == nil and compilerCache.key(args, cfg.buildDir, name, text)
+  if not k then
+    -- Let the compiler report the error.
+    return compile(cfg, args, env, name, depPath, sourceFile)
+  end
+
+  local hit, obj = cas.get(cfg.compilerCache, k, dir, cfg.buildDir)
+  if hit and obj == name then
+    if not cfg.quiet then
+      local stdout = cfg.io and cfg.io[1] or io.stdout
+      stdout:write('$ ' .. table.concat(args, ' ') .. ' (cached)\n')
+    end
+    reportInputs(cfg, dir, compilerCache.includedFiles(text), sourceFile)
+    return nil, name
+  end
+
+  local err, obj = compile(cfg, args, env, name, depPath, sourceFile)
+  if err == nil then
+    cas.put(cfg.compilerCache, k, dir, name, cfg.buildDir)
+  end
+  return err, obj
+end
+
+-- Compiles batched into one invocation, at most this many at a time.
+local batchMax = 8
+
+-- Batches that are still taking members, by shared command.
+local openBatches = {}
+
+-- Flags followed by a path.
+local pathFlags = {
+  ['-include'] = true, ['-include-pch'] = true, ['-imacros'] = true,
+  ['-isystem'] = true, ['-iquote'] = true, ['-idirafter'] = true,
+}
+
+-- Return the part of the compile command 'args' that objects in a batch
+-- share, which has no output or source paths.  The batch runs in another
+-- directory, so paths are made absolute.
+local function sharedArgs(args)
+  local dir = xpfs.getcwd()
+  local function abs(p)
+    return p:sub(1,1) == '/' and p or dir .. '/' .. p
+  end
+  local t = {args[1], '-c', '-MD'}
+  local i = 2
+  while i < #args do
+    local a = args[i]
+    if a == '-o' or a == '-MF' then
+      i = i + 1
+    elseif pathFlags[a] then
+      i = i + 1
+      table.insert(t, a)
+      table.insert(t, abs(args[i]))
+    elseif a:match('^%-I.') then
+      table.insert(t, '-I' .. abs(a:sub(3)))
+    elseif a ~= '-c' and a ~= '-MD' then
+      table.insert(t, a)
+    end
+    i = i + 1
+  end
+  return t
+end
+
+-- Compile the sources of each object in 'batch' with one command, which
+-- writes the objects to a scratch directory in 'cfg.buildDir'.  They are
+-- then moved into place.  Marks each object 'ok' that was built.
+local function runBatch(cfg, batch, shared, env)
+  local scratch = xpfs.getcwd() .. '/' .. cfg.buildDir .. '/batch'
+  lfsu.rm_rf(scratch)
+  lfsu.mkdir_p(scratch)
+
+  local args = {table.unpack(shared)}
+  for _,m in ipairs(batch) do
+    table.insert(args, m.sourceFile)
+  end
+
+  -- Output is held back, since an error is reported again by the builder
+  -- whose source caused it.
+  local out = {{}, {}}
+  local sinks = {}
+  for i = 1, 2 do
+    sinks[i] = {write = function(_, s) table.insert(out[i], s) end}
+  end
+  local batchCfg = {quiet = cfg.quiet, io = sinks, trace = cfg.trace}
+  if systemIO.execute(batchCfg, {args=args, env=env, dir=scratch}) ~= nil then
+    lfsu.rm_rf(scratch)
+    return
+  end
+  for i = 1, 2 do
+    local f = cfg.io and cfg.io[i] or (i == 1 and io.stdout or io.stderr)
+    f:write(table.concat(out[i]))
+  end
+
+  for _,m in ipairs(batch) do
+    local obj = scratch .. '/' .. m.base .. '.o'
+    local dep = scratch .. '/' .. m.base .. '.d'
+    if xpfs.rename(obj, m.name) and xpfs.rename(dep, m.depPath) then
+      reportInputs(m.cfg, scratch, depfile.read(m.depPath) or {}, m.sourceFile)
+      m.ok = true
+    end
+  end
+  lfsu.rm_rf(scratch)
+end
+
+-- Debug info records the working directory, which a batch changes.
+local function hasDebugInfo(args)
+  for _,a in ipairs(args) do
+    if a:match('^%-g') then
+      return true
+    end
+  end
+  return false
+end
+
+-- Compile along with other objects whose commands differ only in their
+-- source and output paths.  An object starts a batch, which others join
+-- while it waits for a job slot, so batches form only when every slot is
+-- busy.  If the batch fails, each object is compiled on its own, so that
+-- errors are reported by the builder they belong to.
+local function batchedCompile(cfg, args, env, name, depPath, sourceFile)
+  local shared = sharedArgs(args)
+  local key = table.concat(shared, '\0') .. '\0' .. (env.PATH or '')
+  local dir = xpfs.getcwd()
+  local m = {
+    cfg        = cfg,
+    name       = resolve(dir, name),
+    depPath    = resolve(dir, depPath),
+    sourceFile = resolve(dir, sourceFile),
+    base       = path.takeBaseName(sourceFile),
+  }
+
+  local batch = openBatches[key]
+  if batch and #batch < batchMax and not batch.bases[m.base] then
+    table.insert(batch, m)
+    batch.bases[m.base] = true
+    m.done = thread.semaphore(0)
+    m.done:acquire()
+  else
+    batch = {m, bases = {[m.base] = true}}
+    openBatches[key] = batch
+
+    -- However the leader leaves -- done, on error, or killed -- the batch
+    -- is closed, its members go on, and the job slot is given back.
+    local jobs, held, closed = cfg.jobs, false, false
+    local function close()
+      if openBatches[key] == batch then
+        openBatches[key] = nil
+      end
+      if not closed then
+        closed = true
+        for i = 2, #batch do
+          batch[i].done:release()
+        end
+      end
+    end
+    local function leave()
+      close()
+      if held then
+        held = false
+        jobs:release()
+      end
+    end
+    local exitId = thread.atExit(leave)
+    if jobs then
+      local t0 = xpio.gettime()
+      jobs:acquire()
+      held = true
+      cfg.slotWait = (cfg.slotWait or 0) + xpio.gettime() - t0
+    end
+
+    -- Members join only while the leader waits for its slot.
+    if openBatches[key] == batch then
+      openBatches[key] = nil
+    end
+    local ok, err, obj = pcall(function()
+      if #batch > 1 then
+        runBatch(cfg, batch, shared, env)
+      end
+      close()
+      if m.ok then
+        return nil, name
+      end
+      -- Compile on its own in the slot already held.
+      local ownCfg = {quiet = cfg.quiet, io = cfg.io, trace = cfg.trace,
+                      inputFiles = cfg.inputFiles}
+      return compile(ownCfg, args, env, name, depPath, sourceFile)
+    end)
+    thread.cancelAtExit(exitId)
+    leave()
+    if not ok then
+      error(err, 0)
+    end
+    return err, obj
+  end
+
+  if m.ok then
+    return nil, name
+  end
+  return compile(cfg, args, env, name, depPath, sourceFile)
+end
+
+-- Precompile a header, to be passed to objects and programs as their 'pch'
+-- parameter.  Returns the path of a '.gch' file (GCC) or a '.pch' file
+-- (Clang).  Only sources compiled with the same compiler, language, and
+-- flags can use it.
+local function precompiledHeader(cfg, ps)
+  if osName == nil then
+    init()
+  end
+
+  local header = ps.header or ps[1]
+  local language = ps.language or (isCxxHeader(header) and 'c++' or 'c')
+  local cc = ps.cc or config[language == 'c++' and 'cxx' or 'cc']
+  local clang = isClang(cc)
+  local stub = cfg.buildDir .. '/' .. path.takeFileName(header)
+  local name = ps.name or cfg.outPath or stub .. (clang and '.pch' or '.gch')
+  local depPath = name .. '.d'
+  local args = {cc, '-x', language .. '-header', '-o', name, '-MD', '-MF', depPath}
+
+  if type(ps.includeDirs) == 'table' then
+    for i,v in ipairs(ps.includeDirs) do
+      table.insert(args, '-I'..v)
+    end
+  end
+  for _,v in ipairs(flavors[ps.flavor] or {}) do
+    table.insert(args, v)
+  end
+  for _,v in ipairs(ps.flags or {}) do
+    table.insert(args, v)
+  end
+  table.insert(args, header)
+
+  local env = {}
+  if osName == 'Linux' and cc:match('gcc$') then
+    -- On Linux and CC=gcc, path to tool that finds 'cc1'
+    env.PATH = '/usr/bin'
+  end
+
+  lfsu.mkdir_p(path.takeDirectory(name))
+  if not clang and name:match('%.gch$') then
+    -- GCC finds 'foo.h.gch' beside the 'foo.h' named by -include, and
+    -- falls back to reading that file if the '.gch' cannot be used.
+    local abs = header:sub(1,1) == '/' and header or xpfs.getcwd() .. '/' .. header
+    lfsu.write(name:sub(1, -5), '#include "' .. abs .. '"\n')
+  end
+  return compile(cfg, args, env, name, depPath, header)
+end
+
 local function object(cfg, ps)
   if osName == nil then
     init()
@@ -90,8 +472,13 @@ local function object(cfg, ps)
   local sourceFile = ps.sourceFile
   local name = ps.name or cfg.outPath or (sourceFile and cfg.buildDir .. '/' .. path.takeBaseName(sourceFile) .. '.o')
   local cc = ps.cc or chooseCompiler{sourceFile}
-  local args = {cc, '-o', name, '-c'}
+  -- The compiler lists the headers it read in a depfile beside the object.
+  local depPath = name .. '.d'
+  local args = {cc, '-o', name, '-c', '-MD', '-MF', depPath}
 
+  if ps.pch then
+    insertPchArgs(args, ps.pch)
+  end
   if type(ps.includeDirs) == 'table' and #ps.includeDirs > 0 then
     for i,v in ipairs(ps.includeDirs) do
       table.insert(args, '-I'..v)
@@ -114,26 +501,121 @@ local function object(cfg, ps)
   end
 
   lfsu.mkdir_p(outdir)
-  return systemIO.execute(cfg, {args=args, env=env, thenReturn=name})
+  if cfg.compilerCache then
+    return cachedCompile(cfg, args, env, name, depPath, sourceFile)
+  elseif cfg.batchCompiles and not hasDebugInfo(args) then
+    return batchedCompile(cfg, args, env, name, depPath, sourceFile)
+  end
+  return compile(cfg, args, env, name, depPath, sourceFile)
+end
+
+-- Write a source file that includes each of 'ps.sourceFiles', so they
+-- are compiled as one translation unit.  Returns its path, which ends in
+-- 'unity_<ps.index>.c', or '.cpp' if any of the sources is C++.
+local function unitySource(cfg, ps)
+  local sourceFiles = ps.sourceFiles or {}
+  local ext = '.c'
+  for _,p in ipairs(sourceFiles) do
+    if isCxx(p) then
+      ext = '.cpp'
+    end
+  end
+  local name = ps.name or cfg.outPath or cfg.buildDir .. '/unity_' .. (ps.index or 1) .. ext
+
+  local dir = xpfs.getcwd()
+  local lines = {}
+  for _,p in ipairs(sourceFiles) do
+    local abs = p:sub(1,1) == '/' and p or dir .. '/' .. p
+    table.insert(lines, '#include "' .. abs .. '"\n')
+  end
+  lfsu.mkdir_p(path.takeDirectory(name))
+  lfsu.write(name, table.concat(lines))
+  return nil, name
 end
 
+-- Return a stamp that changes when the file at 'p' is rewritten, or nil
+-- if it does not exist.
+local function fileStamp(p)
+  local st = xpfs.stat(p, 'sin')
+  return st and st.size .. ':' .. st.mtime_ns .. ':' .. st.inode
+end
+
+local function readMembers(p)
+  local data = lfsu.read(p)
+  local chunk = data and load('return ' .. data, p, 't', {})
+  local ok, t = pcall(chunk or error)
+  return ok and type(t) == 'table' and t or nil
+end
+
+-- Return the objects in 'objectFiles' that changed since the archive
+-- 'name' was last written, as recorded in 'old', or nil if the archive
+-- must be rewritten.  Members are replaced by file name, so a library
+-- whose objects share a name is always rewritten.
+local function changedMembers(old, ar, flags, name, objectFiles, stamps)
+  if old.ar ~= ar or old.flags ~= flags or old.archive ~= fileStamp(name)
+     or #old.objects ~= #objectFiles then
+    return nil
+  end
+  local changed, names = {}, {}
+  for i,v in ipairs(objectFiles) do
+    local nm = path.takeFileName(v)
+    if old.objects[i] ~= v or names[nm] then
+      return nil
+    end
+    names[nm] = true
+    if old.stamps[i] ~= stamps[i] then
+      table.insert(changed, v)
+    end
+  end
+  return changed
+end
+
+-- Archive 'ps.objectFiles' with 'ps.ar'.  When 'ps.thin' is true, the
+-- archive is a thin one, which refers to the objects instead of holding
+-- copies.  The members are recorded in 'cfg.buildDir', so that when the
+-- same objects are archived again, only those that changed are replaced.
 local function library(cfg, ps)
   local objectFiles = ps.objectFiles or {}
   local name = ps.name or cfg.outPath or (objectFiles[1] and (path.dropExtension(objectFiles[1])) .. '.lib')
   if name == nil then
     error 'No input files'
   end
-  local args = {ps.ar, 'rcs', name}
+  -- A thin archive records its members' timestamps (U), so that its
+  -- contents change when they do, and consumers are rebuilt.
+  local flags = ps.thin and 'TU' or ''
 
-  if type(objectFiles) == 'table' and #objectFiles > 0 then
-    for i,v in ipairs(objectFiles) do
-      table.insert(args, v)
-    end
+  local stamps = {}
+  for i,v in ipairs(objectFiles) do
+    stamps[i] = fileStamp(v)
+  end
+  local membersPath = cfg.buildDir .. '/' .. path.takeFileName(name) .. '.members'
+  local old = readMembers(membersPath)
+  local changed = old and changedMembers(old, ps.ar, flags, name, objectFiles, stamps)
+  xpfs.remove(membersPath)
+
+  local args
+  if not changed then
+    -- 'ar r' keeps members that are no longer listed.
+    xpfs.remove(name)
+    args = {ps.ar, 'rcs' .. flags, name, table.unpack(objectFiles)}
+  elseif #changed > 0 then
+    args = {ps.ar, 'rs' .. flags, name, table.unpack(changed)}
   end
 
   local outdir = path.takeDirectory(name)
   lfsu.mkdir_p(outdir)
-  return systemIO.execute(cfg, {args=args, thenReturn=name})
+  if args then
+    args = responseFileArgs(cfg, args, 4, name)
+    local err = systemIO.execute(cfg, {args=args})
+    if err ~= nil then
+      return err
+    end
+  end
+
+  local members = {ar = ps.ar, flags = flags, objects = objectFiles, stamps = stamps, archive = fileStamp(name)}
+  lfsu.mkdir_p(cfg.buildDir)
+  lfsu.write(membersPath, serialize.serialize(members, nil, 's'))
+  return nil, name
 end
 
 return {
@@ -141,5 +623,11 @@ return {
   program = program,
   library = library,
   object = object,
+  precompiledHeader = precompiledHeader,
+  unitySource = unitySource,
+  unitySource__info = {
+    -- The file depends on the names of the sources, not their contents.
+    getInputFiles = function(cfg, ps) return {} end,
+  },
 }
 
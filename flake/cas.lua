@@ -0,0 +1,311 @@
+-- Content-addressed store for builder outputs
+--
+-- File contents are stored as objects named by their sha1.  A manifest,
+-- named by a key derived from the builder key and the sha1 of each of its
+-- declared inputs, records the files a builder produced and the value it
+-- returned.  Inputs the builder discovered while running (such as the
+-- headers a compiler read) are not known before it runs, so they are not
+-- part of the key.  The manifest records them instead, and an entry is
+-- restored only if they match the tree.
+--
+-- Restoring a manifest copies each object into place, as a reflink where
+-- the file system supports it.  Objects are never hard-linked into a tree:
+-- a builder that later modifies its output in place (e.g. `ar rs`) would
+-- otherwise corrupt the store.
+--
+-- A store may be backed by a remote one (see remoteCache.lua).  Entries
+-- missing locally are fetched from it, and new entries are uploaded to it
+-- in the background.
+--
+-- Layout:
+--
+--   <root>/objects/ab/abcdef...     file contents
+--   <root>/manifests/ab/abcdef...   {value=, buildDir=, files={path -> {sha1=, exec=}},
+--                                    inputs={path -> sha1}}
+
+local sha1      = require 'sha1'
+local xpfs      = require 'xpfs'
+local lfsu      = require 'lfsu'
+local serialize = require 'serialize'
+local thread    = require 'thread'
+
+-- $XDG_CACHE_HOME/flake/cas, or nil if there is no home directory.
+local function defaultRoot()
+  local base = os.getenv 'XDG_CACHE_HOME'
+  if not base or base == '' then
+    local home = os.getenv 'HOME'
+    if not home then
+      return nil
+    end
+    base = home .. '/.cache'
+  end
+  return base .. '/flake/cas'
+end
+
+local function entryName(kind, name)
+  return kind .. '/' .. name:sub(1, 2) .. '/' .. name
+end
+
+local function entryPath(root, kind, name)
+  return root .. '/' .. entryName(kind, name)
+end
+
+local function takeDirectory(p)
+  return p:match('(.*)/') or '.'
+end
+
+-- A sibling of `p` to write before renaming over `p`.  Other processes may
+-- be writing the same entry.
+local function tmpName(p)
+  return p .. '.' .. sha1.digest(tostring({}) .. os.clock() .. os.time()):sub(1, 12)
+end
+
+-- Write an entry, given its name relative to `root`.
+local function writeEntry(root, name, data)
+  local path = root .. '/' .. name
+  lfsu.mkdir_p(takeDirectory(path))
+  local tmp = tmpName(path)
+  if not (lfsu.write(tmp, data) and xpfs.rename(tmp, path)) then
+    xpfs.remove(tmp)
+    return false
+  end
+  return true
+end
+
+-- True if the relative path `p` names a file within its directory.
+local function isContained(p)
+  return p:sub(1, 1) ~= '/' and not ('/' .. p .. '/'):match('/%.%./')
+end
+
+local function isDigest(s)
+  return type(s) == 'string' and #s == 40 and s:match('^%x+$') ~= nil
+end
+
+-- Read a manifest written by put().  Manifests may come from a remote
+-- store, so they are read as data only, and one whose paths would reach
+-- outside of the tree is rejected.  Discovered inputs may be absolute (a
+-- system header, say); they are only hashed, never written.
+local function parseManifest(data)
+  local manifest = data and serialize.deserialize(data:match('^return (.*)') or data)
+  if type(manifest) ~= 'table' or type(manifest.files) ~= 'table'
+      or type(manifest.buildDir) ~= 'string'
+      or manifest.inputs ~= nil and type(manifest.inputs) ~= 'table' then
+    return nil
+  end
+  for p, rec in pairs(manifest.files) do
+    if type(p) ~= 'string' or not isContained(p) or type(rec) ~= 'table'
+        or not isDigest(rec.sha1) then
+      return nil
+    end
+  end
+  for p, digest in pairs(manifest.inputs or {}) do
+    if type(p) ~= 'string' or ('/' .. p .. '/'):match('/%.%./') or not isDigest(digest) then
+      return nil
+    end
+  end
+  return manifest
+end
+
+-- Run `f(x)` on a thread for each `x` in `xs`, and return true if every
+-- call returned true.
+local function forAll(xs, f)
+  local tasks = {}
+  for _, x in ipairs(xs) do
+    table.insert(tasks, thread.new(f, x))
+  end
+  local all = true
+  for _, t in ipairs(tasks) do
+    all = thread.join(t) == true and all
+  end
+  return all
+end
+
+-- Upload the manifest `k` and its objects.  The manifest goes last, so
+-- that a reader never finds a manifest whose objects are missing.
+local function upload(root, remote, k, manifest)
+  local names = {}
+  for _, rec in pairs(manifest.files) do
+    table.insert(names, entryName('objects', rec.sha1))
+  end
+  local ok = forAll(names, function(name)
+    local data = lfsu.read(root .. '/' .. name)
+    return data ~= nil and remote:put(name, data) == true
+  end)
+  local name = entryName('manifests', k)
+  local data = ok and lfsu.read(root .. '/' .. name)
+  if data then
+    remote:put(name, data)
+  end
+end
+
+-- Copy the manifest `k` and its objects from `remote` into the store.
+-- Objects are requested concurrently, so the requests are pipelined.
+local function fetch(root, remote, k)
+  local name = entryName('manifests', k)
+  local data = remote:get(name)
+  local manifest = parseManifest(data)
+  if not manifest then
+    return false
+  end
+  local digests = {}
+  for _, rec in pairs(manifest.files) do
+    if not xpfs.stat(entryPath(root, 'objects', rec.sha1), 'k') then
+      table.insert(digests, rec.sha1)
+    end
+  end
+  local ok = forAll(digests, function(digest)
+    local obj = remote:get(entryName('objects', digest))
+    return obj ~= nil and sha1.digest(obj) == digest and writeEntry(root, entryName('objects', digest), obj)
+  end)
+  return ok and writeEntry(root, name, data)
+end
+
+-- Return the store key for a builder key and its inputs (path -> sha1).
+local function key(builderKey, digests)
+  return sha1.digest(serialize.serialize({builderKey, digests}, nil, 's'))
+end
+
+-- Add each string in `v` that names a regular file in `dir` to `files`,
+-- skipping `sources`.  Returns false if a file is outside of `dir`, since
+-- restoring it could write into another tree.
+local function collectFiles(v, dir, sources, files)
+  if type(v) == 'string' then
+    if sources[v] then
+      return true
+    end
+    local st = xpfs.stat(v:sub(1, 1) == '/' and v or dir .. '/' .. v, 'k')
+    if st and st.kind == 'f' then
+      if not isContained(v) then
+        return false
+      end
+      files[v] = true
+    end
+  elseif type(v) == 'table' then
+    for _, x in pairs(v) do
+      if not collectFiles(x, dir, sources, files) then
+        return false
+      end
+    end
+  end
+  return true
+end
+
+-- Store the files named in `value`, and `value` itself, under `k`.  Paths
+-- are relative to `dir`; `buildDir` is the builder's build directory, which
+-- is renamed on restore.  `inputs` maps each discovered input to its sha1.
+-- Returns true if the outputs were stored.  The entry is then uploaded to
+-- `remote`, if given, on another thread.
+local function put(root, k, dir, value, buildDir, sources, remote, inputs)
+  local files = {}
+  if not collectFiles(value, dir, sources or {}, files) then
+    return false
+  end
+
+  local manifest = {value = value, buildDir = buildDir, files = {},
+                    inputs = inputs and next(inputs) and inputs or nil}
+  for p in pairs(files) do
+    local src = dir .. '/' .. p
+    local digest = sha1.file(src)
+    local st = xpfs.stat(src, 'p')
+    if not (digest and st) then
+      return false
+    end
+    local obj = entryPath(root, 'objects', digest)
+    if not xpfs.stat(obj, 'k') then
+      lfsu.mkdir_p(takeDirectory(obj))
+      local tmp = tmpName(obj)
+      if not (xpfs.copy(src, tmp) and xpfs.rename(tmp, obj)) then
+        xpfs.remove(tmp)
+        return false
+      end
+    end
+    manifest.files[p] = {sha1 = digest, exec = st.perm:sub(3, 3) == 'x'}
+  end
+
+  if not writeEntry(root, entryName('manifests', k), 'return ' .. serialize.serialize(manifest, nil, 's')) then
+    return false
+  end
+  if remote then
+    thread.new(upload, root, remote, k, manifest)
+  end
+  return true
+end
+
+-- Replace the `from` prefix of strings in `v` with `to`.
+local function rebase(v, from, to)
+  if type(v) == 'string' then
+    if v == from then
+      return to
+    elseif v:sub(1, #from + 1) == from .. '/' then
+      return to .. v:sub(#from + 1)
+    end
+  elseif type(v) == 'table' then
+    local t = {}
+    for k, x in pairs(v) do
+      t[k] = rebase(x, from, to)
+    end
+    return t
+  end
+  return v
+end
+
+-- Restore the outputs stored under `k` into `dir`, and return true, the
+-- builder's value and its discovered inputs (path -> sha1).  Returns nil if
+-- the outputs are not in the store or in `remote`, or if a discovered input
+-- differs from the one they were built from.
+local function get(root, k, dir, buildDir, remote)
+  local path = entryPath(root, 'manifests', k)
+  if remote and not xpfs.stat(path, 'k') and not fetch(root, remote, k) then
+    return nil
+  end
+  local manifest = parseManifest(lfsu.read(path))
+  if not manifest then
+    return nil
+  end
+
+  local inputs = {}
+  for p, digest in pairs(manifest.inputs or {}) do
+    local q = rebase(p, manifest.buildDir, buildDir)
+    local abs = q:sub(1, 1) == '/' and q or dir .. '/' .. q
+    -- Only regular files: hashing a fifo or a device could block.
+    local st = xpfs.stat(abs, 'k')
+    if not (st and st.kind == 'f' and sha1.file(abs) == digest) then
+      return nil
+    end
+    inputs[q] = digest
+  end
+
+  local targets = {}
+  for p, rec in pairs(manifest.files) do
+    local q = rebase(p, manifest.buildDir, buildDir)
+    if not isContained(q) then
+      return nil
+    end
+    targets[p] = dir .. '/' .. q
+  end
+
+  for p, rec in pairs(manifest.files) do
+    local target = targets[p]
+    if sha1.file(target) ~= rec.sha1 then
+      lfsu.mkdir_p(takeDirectory(target))
+      local tmp = tmpName(target)
+      if not xpfs.copy(entryPath(root, 'objects', rec.sha1), tmp) then
+        xpfs.remove(tmp)
+        return nil
+      end
+      xpfs.chmod(tmp, rec.exec and '+x' or '-x')
+      if not xpfs.rename(tmp, target) then
+        xpfs.remove(tmp)
+        return nil
+      end
+    end
+  end
+  return true, rebase(manifest.value, manifest.buildDir, buildDir), inputs
+end
+
+return {
+  defaultRoot = defaultRoot,
+  get         = get,
+  key         = key,
+  put         = put,
+}
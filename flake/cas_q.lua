@@ -0,0 +1,81 @@
+local cas   = require 'cas'
+local lfsu  = require 'lfsu'
+local xpfs  = require 'xpfs'
+local qt    = require 'qtest'
+local serialize = require 'serialize'
+
+local outdir = lfsu.abspath(assert(os.getenv 'OUTDIR', 'OUTDIR not set'))
+local root = outdir .. '/cas'
+local dir = outdir .. '/casTree'
+lfsu.rm_rf(root)
+lfsu.rm_rf(dir)
+lfsu.mkdir_p(dir .. '/bd/1')
+
+-- Keys depend on the builder and on the contents of each input.
+local k = cas.key('cc/abc', {['a.c'] = 'aaaa'})
+qt.eq(k, cas.key('cc/abc', {['a.c'] = 'aaaa'}))
+qt.eq(k == cas.key('cc/abc', {['a.c'] = 'bbbb'}), false)
+qt.eq(k == cas.key('cc/def', {['a.c'] = 'aaaa'}), false)
+
+qt.eq(cas.get(root, k, dir, 'bd/1'), nil)
+
+-- Store outputs.  Inputs named in the value are not stored.
+lfsu.write(dir .. '/a.c', 'int a;\n')
+lfsu.write(dir .. '/bd/1/a.o', 'object')
+lfsu.write(dir .. '/bd/1/a', 'program')
+xpfs.chmod(dir .. '/bd/1/a', '+x')
+local value = {obj = 'bd/1/a.o', exe = 'bd/1/a', src = 'a.c', n = 1}
+qt.eq(cas.put(root, k, dir, value, 'bd/1', {['a.c'] = 'aaaa'}), true)
+
+-- Restore into another build directory.
+lfsu.rm_rf(dir .. '/bd')
+local hit, v = cas.get(root, k, dir, 'bd/2')
+qt.eq(hit, true)
+qt.eq(v, {obj = 'bd/2/a.o', exe = 'bd/2/a', src = 'a.c', n = 1})
+qt.eq(lfsu.read(dir .. '/bd/2/a.o'), 'object')
+qt.eq(xpfs.stat(dir .. '/bd/2/a', 'p').perm:sub(3, 3), 'x')
+qt.eq(xpfs.stat(dir .. '/bd/2/a.o', 'p').perm:sub(3, 3), '-')
+
+-- Restored files are copies; modifying one leaves the store intact.
+lfsu.write(dir .. '/bd/2/a.o', 'changed')
+qt.eq(cas.get(root, k, dir, 'bd/2'), true)
+qt.eq(lfsu.read(dir .. '/bd/2/a.o'), 'object')
+
+-- Files outside of the tree are not stored.
+local k2 = cas.key('cc/out', {})
+qt.eq(cas.put(root, k2, dir, {dir .. '/a.c'}, 'bd/3'), false)
+qt.eq(cas.put(root, k2, dir, {'../casTree/a.c'}, 'bd/3'), false)
+qt.eq(cas.get(root, k2, dir, 'bd/3'), nil)
+
+-- Discovered inputs are not part of the key, but must match the tree.
+local sha1 = require 'sha1'
+local k3 = cas.key('cc/hdr', {['b.c'] = 'bbbb'})
+lfsu.write(dir .. '/a.h', 'int h;\n')
+lfsu.write(dir .. '/bd/2/b.o', 'object b')
+qt.eq(cas.put(root, k3, dir, {'bd/2/b.o'}, 'bd/2', {}, nil, {['a.h'] = sha1.digest('int h;\n')}), true)
+qt.eq({cas.get(root, k3, dir, 'bd/4')}, {true, {'bd/4/b.o'}, {['a.h'] = sha1.digest('int h;\n')}})
+lfsu.write(dir .. '/a.h', 'int g;\n')
+qt.eq(cas.get(root, k3, dir, 'bd/4'), nil)
+
+-- Manifests may come from a remote store.  They are read as data, and one
+-- that would write outside of the tree is not restored.
+local obj = sha1.digest('object b')
+local function plant(name, text)
+  local k = cas.key(name, {})
+  local p = root .. '/manifests/' .. k:sub(1, 2) .. '/' .. k
+  lfsu.mkdir_p(p:match('(.*)/'))
+  lfsu.write(p, text)
+  return k
+end
+local function manifest(files, inputs)
+  return 'return ' .. serialize.serialize{value = 1, buildDir = 'bd/5', files = files, inputs = inputs}
+end
+qt.eq(cas.get(root, plant('m/loop', 'while true do end'), dir, 'bd/5'), nil)
+qt.eq(cas.get(root, plant('m/code', 'return {files = {}, buildDir = os.exit()}'), dir, 'bd/5'), nil)
+qt.eq(cas.get(root, plant('m/up', manifest{['../up.o'] = {sha1 = obj}}), dir, 'bd/5'), nil)
+qt.eq(cas.get(root, plant('m/abs', manifest{[outdir .. '/abs.o'] = {sha1 = obj}}), dir, 'bd/5'), nil)
+qt.eq(cas.get(root, plant('m/name', manifest{['b.o'] = {sha1 = '../../objects'}}), dir, 'bd/5'), nil)
+qt.eq(cas.get(root, plant('m/in', manifest({}, {['../casTree/a.h'] = obj})), dir, 'bd/5'), nil)
+qt.eq(xpfs.stat(outdir .. '/up.o'), nil)
+qt.eq(xpfs.stat(outdir .. '/abs.o'), nil)
+qt.eq({cas.get(root, plant('m/ok', manifest{['bd/5/b.o'] = {sha1 = obj}}), dir, 'bd/6')}, {true, 1, {}})
@@ -0,0 +1,110 @@
+-- Keys for a cache of compiler outputs
+--
+-- An object is identified by the compiler that built it, the command-line
+-- flags, and the source after preprocessing, which takes in every header
+-- it includes.  Neither the paths of the object and its depfile nor the
+-- build directory they are in are part of the key, so an object compiled
+-- in one build directory or branch is reused by another.
+--
+-- Objects are kept in a content-addressed store (see cas.lua), apart from
+-- the one that holds builder outputs.
+
+local cas       = require 'cas'
+local sha1      = require 'sha1'
+local xpfs      = require 'xpfs'
+local serialize = require 'serialize'
+local process   = require 'process'
+
+-- $XDG_CACHE_HOME/flake/cc, or nil if there is no home directory.
+local function defaultRoot()
+  local root = cas.defaultRoot()
+  return root and (root:gsub('/cas$', '/cc'))
+end
+
+-- Digests of compilers, by path, with the stat each was computed from.
+local compilers = {}
+
+-- Return a digest identifying the compiler `cc`, or nil if it is not
+-- found.
+local function identity(cc)
+  local p = cc:find('/') and cc or process.findExecutable(cc)
+  local st = p and xpfs.stat(p, 'sn')
+  if not st then
+    return nil
+  end
+  local stamp = st.size .. ':' .. st.mtime_ns
+  local c = compilers[p]
+  if not (c and c.stamp == stamp) then
+    c = {stamp = stamp, sha1 = sha1.file(p)}
+    compilers[p] = c
+  end
+  return c.sha1
+end
+
+-- Flags that name an output, and so take a path that is not part of the
+-- key.
+local outputFlags = {['-o'] = true, ['-MF'] = true}
+
+-- Return the command that preprocesses the source compiled by `args`, a
+-- compile command such as cIO.object runs.
+local function preprocessArgs(args)
+  local t = {args[1], '-E'}
+  local i = 2
+  while i <= #args do
+    local a = args[i]
+    if outputFlags[a] then
+      i = i + 1
+    elseif a ~= '-c' and a ~= '-MD' and a ~= '-MMD' then
+      table.insert(t, a)
+    end
+    i = i + 1
+  end
+  return t
+end
+
+-- Return the cache key for the compile command `args`, whose output is
+-- `name` in `buildDir`, given `text`, the preprocessed source.  Returns
+-- nil if the compiler is not found.
+local function key(args, buildDir, name, text)
+  local id = identity(args[1])
+  if not id then
+    return nil
+  end
+  local flags = preprocessArgs(args)
+  for i,a in ipairs(flags) do
+    if a:match('^%-g') then
+      -- Debug info holds the working directory.
+      table.insert(flags, 'cwd=' .. xpfs.getcwd())
+      break
+    end
+  end
+  if name:sub(1, #buildDir + 1) == buildDir .. '/' then
+    name = name:sub(#buildDir + 1)
+  end
+  return sha1.digest(serialize.serialize({id, flags, name, sha1.digest(text)}, nil, 's'))
+end
+
+-- Return the files named in the line markers of preprocessed source, in
+-- order and without duplicates.
+local function includedFiles(text)
+  local files, seen = {}, {}
+  for p in text:gmatch('\n# %d+ "([^"\n]*)"') do
+    if not seen[p] and p:sub(1, 1) ~= '<' then
+      seen[p] = true
+      table.insert(files, p)
+    end
+  end
+  local p = text:match('^# %d+ "([^"\n]*)"')
+  if p and not seen[p] and p:sub(1, 1) ~= '<' then
+    table.insert(files, 1, p)
+  end
+  return files
+end
+
+return {
+  defaultRoot    = defaultRoot,
+  identity       = identity,
+  includedFiles  = includedFiles,
+  key            = key,
+  preprocessArgs = preprocessArgs,
+}
@@ -0,0 +1,46 @@
+local compilerCache = require 'compilerCache'
+local qt            = require 'qtest'
+local cIO           = require 'cIO'
+local lfsu          = require 'lfsu'
+local thread        = require 'thread'
+
+-- Preprocessing drops the output and depfile flags.
+local args = {'/bin/sh', '-o', 'bd/1/a.o', '-c', '-MD', '-MF', 'bd/1/a.o.d', '-I.', '-O2', 'a.c'}
+qt.eq(compilerCache.preprocessArgs(args), {'/bin/sh', '-E', '-I.', '-O2', 'a.c'})
+
+-- Keys do not depend on the build directory.
+local k = compilerCache.key(args, 'bd/1', 'bd/1/a.o', 'int a;')
+qt.eq(k, compilerCache.key({'/bin/sh', '-o', 'bd/2/a.o', '-c', '-MD', '-MF', 'bd/2/a.o.d', '-I.', '-O2', 'a.c'},
+                           'bd/2', 'bd/2/a.o', 'int a;'))
+
+-- They depend on the flags and the preprocessed source.
+qt.eq(k == compilerCache.key(args, 'bd/1', 'bd/1/a.o', 'int b;'), false)
+local args2 = {'/bin/sh', '-o', 'bd/1/a.o', '-c', '-MD', '-MF', 'bd/1/a.o.d', '-I.', '-O0', 'a.c'}
+qt.eq(k == compilerCache.key(args2, 'bd/1', 'bd/1/a.o', 'int a;'), false)
+
+-- No key without a compiler.
+qt.eq(compilerCache.key({'/nonexistent/cc', '-c', 'a.c'}, 'bd/1', 'bd/1/a.o', 'int a;'), nil)
+
+-- Headers come from the line markers.
+local text = '# 1 "a.c"\n# 1 "<built-in>"\n# 1 "a.c"\n# 1 "inc/a.h" 1\nint a;\n# 2 "a.c" 2\n'
+qt.eq(compilerCache.includedFiles(text), {'a.c', 'inc/a.h'})
+
+-- A compile through the cache gives its job slot back when its task is
+-- killed while preprocessing.
+local dir = lfsu.abspath(assert(os.getenv 'OUTDIR', 'OUTDIR not set')) .. '/ccSlot'
+lfsu.mkdir_p(dir)
+lfsu.write(dir .. '/cc', '#!/bin/sh\nexec sleep 10\n')
+os.execute('chmod +x ' .. dir .. '/cc')
+thread.dispatch(function()
+  local cfg = {quiet = true, io = {{write = function() end}, {write = function() end}},
+               jobs = thread.semaphore(1), compilerCache = dir .. '/cache',
+               buildDir = dir .. '/bd'}
+  local t = thread.new(cIO.object, cfg, {cc = dir .. '/cc', sourceFile = dir .. '/a.c'})
+  thread.sleep(0.05)
+  qt.eq(cfg.jobs.count, 0)
+  thread.kill(t)
+  qt.eq(cfg.jobs.count, 1)
+end)
+lfsu.rm_rf(dir)
+
+print 'passed!'
@@ -0,0 +1,252 @@
+-- Build daemon: a long-lived flake process that runs builds for clients
+--
+-- `flake --daemon` listens on a UNIX-domain socket in the workspace's
+-- build directory.  Later invocations of flake in the workspace connect to
+-- it and hand it their command line, working directory, stdout, and
+-- stderr.  The daemon runs the build in its own process, where the Lua
+-- modules, the parsed databases, and the file fingerprints in them stay
+-- loaded from one build to the next.
+--
+-- A build sees the client's environment through os.getenv.  The daemon
+-- remembers each variable that builds have read, and the value they saw,
+-- since loaded modules and results may depend on it.  A client that gives
+-- any of those another value, that cannot connect, or that runs under a
+-- make jobserver (whose descriptors the daemon cannot share) runs the
+-- build itself.  The working directory is sent with each request.
+--
+-- Protocol: the client sends a length-prefixed request, with its stdout
+-- and stderr attached, and the daemon replies `exit <code>` once the
+-- build is done, or `env` if it will not run the build.
+
+local xpio      = require 'xpio'
+local xpfs      = require 'xpfs'
+local serialize = require 'serialize'
+local thread    = require 'thread'
+local process   = require 'process'
+
+-- The socket of the daemon for the workspace at `dir`, in flake's build
+-- directory.  The client looks for it before flake is loaded.
+local function socketPath(dir)
+  return dir .. '/.flake/daemon.sock'
+end
+
+--------------------------------
+-- Client
+--------------------------------
+
+-- Run a build in the daemon listening at `path`, with the environment
+-- `env` (default: this process's).  Returns the build's exit code, or nil
+-- if the build must be run without the daemon.
+local function request(path, args, env)
+  env = env or xpio.env
+  if (env.MAKEFLAGS or ''):find('%-%-jobserver') or not xpfs.stat(path, 'k') then
+    return nil
+  end
+  local sock = xpio.socket('UNIX')
+  if not (sock and sock:connect(path)) then
+    if sock then
+      sock:close()
+    end
+    return nil
+  end
+
+  io.stdout:flush()
+  io.stderr:flush()
+  local body = serialize.serialize({
+    cwd  = xpfs.getcwd(),
+    args = args,
+    env  = env,
+  }, nil, 's')
+  local reply
+  if sock:sendfds(string.pack('<s4', body), 1, 2) then
+    local parts = {}
+    repeat
+      local s = sock:read(256)
+      table.insert(parts, s)
+    until not s
+    reply = table.concat(parts)
+  end
+  sock:close()
+  return math.tointeger(tonumber(reply and reply:match('^exit (%-?%d+)\n$')))
+end
+
+--------------------------------
+-- Server
+--------------------------------
+
+-- Modules loaded by builds, and the stat of the file each was loaded
+-- from.  A module whose file has changed is unloaded before the next
+-- build.
+local baseModules
+local loadedModules = {}
+
+local function moduleStamp(p)
+  local st = p and xpfs.stat(p, 'sn')
+  return st and st.size .. ':' .. st.mtime_ns
+end
+
+local function recordModules()
+  for name in pairs(package.loaded) do
+    if not (baseModules[name] or loadedModules[name]) then
+      local p = package.searchpath(name, package.path)
+      loadedModules[name] = {path = p, stamp = moduleStamp(p)}
+    end
+  end
+end
+
+local function unloadChangedModules()
+  for name, m in pairs(loadedModules) do
+    if not m.stamp or moduleStamp(m.path) ~= m.stamp then
+      package.loaded[name] = nil
+      loadedModules[name] = nil
+    end
+  end
+end
+
+-- The variables builds have read, and the values they saw (false if
+-- unset), and the environment of the client being served.
+local envRead = {}
+local clientEnv
+
+local getenv = os.getenv
+
+local function trackedGetenv(name)
+  local v
+  if clientEnv then
+    v = clientEnv[name]
+  else
+    v = getenv(name)
+  end
+  if envRead[name] == nil then
+    envRead[name] = v or false
+  end
+  return v
+end
+
+local function environmentMatches(env)
+  if type(env) ~= 'table' then
+    return false
+  end
+  for name, v in pairs(envRead) do
+    if (env[name] or false) ~= v then
+      return false
+    end
+  end
+  return true
+end
+
+local function readRequest(conn)
+  local data, out, err = conn:recvfds(4096)
+  if not data or #data < 4 then
+    return nil
+  end
+  local len = string.unpack('<I4', data)
+  while #data < 4 + len do
+    local s = conn:read(4 + len - #data)
+    if not s then
+      return nil
+    end
+    data = data .. s
+  end
+  local chunk = load('return ' .. data:sub(5, 4 + len), 'request', 't', {})
+  local ok, req = pcall(chunk or error)
+  if ok and type(req) == 'table' and out and err then
+    return req, out, err
+  end
+end
+
+-- Run `build(args)` with the client's working directory, stdout, and
+-- stderr, and return its exit code.  `os.exit` ends the build instead of
+-- the daemon.
+local function runRequest(req, out, err, build, saved)
+  io.stdout:flush()
+  io.stderr:flush()
+  xpio.dup(out, 1)
+  xpio.dup(err, 2)
+  out:close()
+  err:close()
+
+  local oldDir = xpfs.getcwd()
+  clientEnv = req.env
+  local code, e = process.catchExit(function()
+    assert(xpfs.chdir(req.cwd))
+    build(req.args)
+  end)
+  clientEnv = nil
+  xpfs.chdir(oldDir)
+  if e ~= nil then
+    io.stderr:write('flake: ' .. tostring(e) .. '\n')
+  end
+  io.stdout:flush()
+  io.stderr:flush()
+  xpio.dup(saved[1], 1)
+  xpio.dup(saved[2], 2)
+  return code
+end
+
+-- Run `build(args)` for each client that connects to the listening
+-- socket `sock`, one at a time.  `prepare()` is called before each build.
+-- Returns only on error.
+local function serve(sock, build, prepare)
+  baseModules = {}
+  for name in pairs(package.loaded) do
+    baseModules[name] = true
+  end
+  local saved = {xpio.dup(1), xpio.dup(2)}
+  os.getenv = trackedGetenv
+
+  while true do
+    local conn, err = sock:accept()
+    if not conn then
+      return nil, err
+    end
+    local req, out, errOut = readRequest(conn)
+    if req and not environmentMatches(req.env) then
+      out:close()
+      errOut:close()
+      conn:write('env\n')
+    elseif req then
+      unloadChangedModules()
+      prepare()
+      local code = runRequest(req, out, errOut, build, saved)
+      recordModules()
+      conn:write('exit ' .. code .. '\n')
+    end
+    conn:close()
+  end
+end
+
+-- Listen at `path` and serve builds.  Returns the listening socket and the
+-- server thread, or nil and an error message.
+local function listen(path, build, prepare)
+  if xpfs.stat(path, 'k') then
+    -- A daemon that answers is running; a socket that does not is stale.
+    local probe = xpio.socket('UNIX')
+    if probe:connect(path) then
+      probe:close()
+      return nil, 'a daemon is already running at ' .. path
+    end
+    probe:close()
+    xpfs.remove(path)
+  end
+  local sock, err = xpio.socket('UNIX')
+  if not sock then
+    return nil, err
+  end
+  local ok, err = sock:bind(path)
+  if ok then
+    ok, err = sock:listen()
+  end
+  if not ok then
+    sock:close()
+    return nil, err
+  end
+  return sock, thread.new(serve, sock, build, prepare or function() end)
+end
+
+return {
+  listen     = listen,
+  request    = request,
+  serve      = serve,
+  socketPath = socketPath,
+}
@@ -0,0 +1,104 @@
+local daemon = require 'daemon'
+local flake  = require 'flake'
+local thread = require 'thread'
+local xpfs   = require 'xpfs'
+local lfsu   = require 'lfsu'
+local qt     = require 'qtest'
+
+local outdir = lfsu.abspath(assert(os.getenv 'OUTDIR', 'OUTDIR not set'))
+local dir = outdir .. '/daemon'
+lfsu.rm_rf(dir)
+lfsu.mkdir_p(dir .. '/.flake')
+local path = daemon.socketPath(dir)
+
+-- Tests run under make, whose jobserver would keep requests from the daemon.
+local env = {}
+
+local function main()
+  qt.eq(daemon.request(path, {}, env), nil)
+
+  local builds, prepared = {}, 0
+  local function build(args)
+    table.insert(builds, {cwd = xpfs.getcwd(), args = args})
+    if args[1] == 'fail' then
+      os.exit(3)
+    end
+  end
+  local sock, server = assert(daemon.listen(path, build, function()
+    prepared = prepared + 1
+  end))
+  qt.eq({daemon.listen(path, build)}, {nil, 'a daemon is already running at ' .. path})
+
+  -- Builds run in the daemon, in the client's directory.
+  local cwd = xpfs.getcwd()
+  qt.eq(daemon.request(path, {'build.lua', 'main'}, env), 0)
+  qt.eq(builds, {{cwd = cwd, args = {'build.lua', 'main'}}})
+  qt.eq(prepared, 1)
+  qt.eq(xpfs.getcwd(), cwd)
+
+  -- os.exit ends the build, not the daemon.
+  qt.eq(daemon.request(path, {'fail'}, env), 3)
+  qt.eq(daemon.request(path, {}, env), 0)
+  qt.eq(#builds, 3)
+
+  -- Builds see the client's environment.  A client that disagrees about a
+  -- variable a build has read builds on its own; other variables and the
+  -- working directory do not matter.
+  local seen = {}
+  local function envBuild()
+    table.insert(seen, os.getenv 'DAEMON_Q')
+  end
+  sock:close()
+  thread.kill(server)
+  lfsu.rm_rf(path)
+  sock, server = assert(daemon.listen(path, envBuild))
+  qt.eq(daemon.request(path, {}, {DAEMON_Q = 'a', PWD = '/x'}), 0)
+  qt.eq(daemon.request(path, {}, {DAEMON_Q = 'a', PWD = '/y'}), 0)
+  qt.eq(daemon.request(path, {}, {DAEMON_Q = 'b'}), nil)
+  qt.eq(daemon.request(path, {}, {}), nil)
+  qt.eq(seen, {'a', 'a'})
+
+  -- Clients under a make jobserver build on their own.
+  qt.eq(daemon.request(path, {}, {DAEMON_Q = 'a', MAKEFLAGS = ' -j4 --jobserver-auth=3,4'}), nil)
+
+  sock:close()
+  thread.kill(server)
+
+  -- A build file the daemon keeps makes new builders for each build, so an
+  -- edited source is read again.
+  local src = dir .. '/src.txt'
+  local buildFile = dir .. '/build.lua'
+  lfsu.write(src, 'one')
+  lfsu.write(buildFile, ([[
+    local flake = require 'flake'
+    local read = flake.lift(function(cfg, p)
+      return nil, io.open(p):read('a')
+    end, 'read', {getInputFiles = function(cfg, p) return {p} end})
+    return read(%q)
+  ]]):format(src))
+  flake.configure{buildDir = dir .. '/.flake', silent = true, keepBuildFiles = true}
+  local values = {}
+  local function flakeBuild()
+    local x = assert(flake.loadBuildFile(buildFile))()
+    local err, v = flake.lower(x, flake.computeValue)
+    table.insert(values, err or v)
+  end
+  lfsu.rm_rf(path)
+  sock, server = assert(daemon.listen(path, flakeBuild))
+  local flakeEnv = {DAEMON_Q = 'a'}
+  qt.eq(daemon.request(path, {}, flakeEnv), 0)
+  lfsu.write(src, 'three')
+  qt.eq(daemon.request(path, {}, flakeEnv), 0)
+  qt.eq(values, {'one', 'three'})
+  flake.configure{keepBuildFiles = false}
+
+  sock:close()
+  thread.kill(server)
+
+  -- A socket left by a daemon that is gone is replaced.
+  sock, server = assert(daemon.listen(path, build))
+  sock:close()
+  thread.kill(server)
+end
+
+thread.dispatch(main)
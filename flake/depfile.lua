@@ -0,0 +1,69 @@
+-- Read the dependency files written by `cc -MD`
+--
+-- A depfile is a Makefile fragment naming the target and the files it was
+-- built from:
+--
+--     out/foo.o: src/foo.c src/foo.h \
+--       src/with\ space.h
+--
+-- Lines ending in a backslash continue on the next line.  In file names,
+-- `\ ` is a space, `\#` a hash, and `$$` a dollar sign.
+
+-- Return the list of prerequisites in the depfile text `s`, in order and
+-- without duplicates.
+local function parse(s)
+  s = s:gsub('\\\r?\n', ' ')
+  local deps, seen = {}, {}
+  for line in s:gmatch('[^\n]+') do
+    -- The target ends at the first colon followed by whitespace, which
+    -- skips drive letters like 'C:\'.
+    local rest = line:match(':%s(.*)$') or line:match(':$') and ''
+    if rest then
+      local word = {}
+      local function finish()
+        local p = table.concat(word)
+        if p ~= '' and not seen[p] then
+          seen[p] = true
+          table.insert(deps, p)
+        end
+        word = {}
+      end
+      local i = 1
+      while i <= #rest do
+        local c = rest:sub(i, i)
+        local n = rest:sub(i + 1, i + 1)
+        if c == '\\' and (n == ' ' or n == '#') then
+          table.insert(word, n)
+          i = i + 1
+        elseif c == '$' and n == '$' then
+          table.insert(word, '$')
+          i = i + 1
+        elseif c:match('%s') then
+          finish()
+        else
+          table.insert(word, c)
+        end
+        i = i + 1
+      end
+      finish()
+    end
+  end
+  return deps
+end
+
+-- Return the prerequisites listed in the depfile at `path`, or nil and an
+-- error message.
+local function read(path)
+  local f, err = io.open(path)
+  if not f then
+    return nil, err
+  end
+  local s = f:read('a')
+  f:close()
+  return parse(s)
+end
+
+return {
+  parse = parse,
+  read  = read,
+}
@@ -0,0 +1,27 @@
+local depfile = require 'depfile'
+local qt      = require 'qtest'
+
+local parse = depfile.parse
+
+qt.eq(parse 'foo.o: foo.c foo.h\n', {'foo.c', 'foo.h'})
+
+-- Continuation lines
+qt.eq(parse 'out/foo.o: foo.c \\\n  /usr/include/stdio.h \\\n  foo.h\n',
+      {'foo.c', '/usr/include/stdio.h', 'foo.h'})
+qt.eq(parse 'foo.o: \\\r\n foo.c\r\n', {'foo.c'})
+
+-- Escapes
+qt.eq(parse 'foo.o: a\\ b.h c\\#d.h e$$f.h\n', {'a b.h', 'c#d.h', 'e$f.h'})
+
+-- Colons in the target, and empty rules
+qt.eq(parse 'C:\\out\\foo.o: foo.c\n', {'foo.c'})
+qt.eq(parse 'foo.o:\n', {})
+qt.eq(parse '', {})
+
+-- Several rules, as with -MP
+qt.eq(parse 'foo.o: foo.c foo.h\nfoo.h:\n', {'foo.c', 'foo.h'})
+
+-- A missing file
+qt.eq(select('#', depfile.read('/nonexistent/foo.d')), 2)
+
+print 'passed!'
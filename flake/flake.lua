@@ -6,12 +6,26 @@ local xpio      = require 'xpio'
 local list      = require 'list'
 local lfsu      = require 'lfsu'
 local thread     = require 'thread'
+local jobserver = require 'jobserver'
+local Heap      = require 'heap'
+local cas       = require 'cas'
+local trace     = require 'trace'
 
 local config = {
   cache = true,
   quiet = false,
   silent = false,
+  paranoid = false,
+  jobs = xpio.nprocs(),
+  cas = false,           -- root of a content-addressed store, if enabled
+  remoteCache = false,   -- remoteCache client backing the store
+  compilerCache = false, -- root of a store of compiled objects, if enabled
+  batchCompiles = false, -- compile objects with like commands together
+  unchanged = false,     -- unchanged(path): true if a watcher saw no change to a source
+  keepBuildFiles = false, -- compile a build file again only when it changes
   databaseName = 'cache.lua',
+  journalName = 'cache.log',
+  journalLimit = 256,
   buildDir = '.flake',
 }
 
@@ -23,30 +37,219 @@ local function getDatabasePath()
   return config.buildDir .. '/' .. config.databaseName
 end
 
+local function getJournalPath()
+  return config.buildDir .. '/' .. config.journalName
+end
+
+local dbOfDatabases = {}
+
+-- Absolute paths of the sources and build files read since the last call
+-- to takeSourcePaths.
+local sourcePaths = {}
+
+-- Size and modification time of each loaded database's files, as this
+-- process last left them.  A mismatch means another process wrote them.
+local dbStamps = {}
+
+local function databaseStamp()
+  local stamp = ''
+  for _, p in ipairs{getDatabasePath(), getJournalPath()} do
+    local st = xpfs.stat(p, 'sn')
+    stamp = stamp .. (st and st.size .. ':' .. st.mtime_ns or '-') .. ';'
+  end
+  return stamp
+end
+
+-- Job slots limit the number of commands running at once.  They are
+-- shared with make when flake runs under make, and with any make that
+-- flake runs.
+local defaultJobSlots = jobserver.client() or jobserver.server(config.jobs)
+local jobSlots = defaultJobSlots
+
+-- Number of journal records appended since the last snapshot, and the
+-- number at which the journal is folded back into the snapshot.
+local journalCounts = {}
+
+-- Write a snapshot of the database and discard the journal.  The snapshot
+-- is renamed into place so that a crash never leaves a partial file.
 local function save(db)
   lfsu.mkdir_p(config.buildDir)
-  local f = assert(io.open(getDatabasePath(), 'w'))
+  local p = getDatabasePath()
+  local span = trace.begin('save', 'database', {path = p})
+  local f = assert(io.open(p .. '.tmp', 'w'))
   f:write('return ' .. serializeSorted(db))
   f:close()
+  assert(xpfs.rename(p .. '.tmp', p))
+  xpfs.remove(getJournalPath())
+  span:finish()
 end
 
-local dbOfDatabases = {}
+local function countResults(db)
+  local n = 0
+  for _ in pairs(db.results) do
+    n = n + 1
+  end
+  return n
+end
 
-local function initDatabase()
+local loadDatabase
+
+-- Drop the run times of builders that no longer have a result.
+local function pruneDurations(db)
+  if db.durations then
+    local live = {}
+    for _, entry in pairs(db.results) do
+      if entry.graphKey then
+        live[entry.graphKey] = true
+      end
+    end
+    for k in pairs(db.durations) do
+      if not live[k] then
+        db.durations[k] = nil
+      end
+    end
+  end
+end
+
+-- Fold the journal into the snapshot.  When another process has written
+-- the database since this one last did, its records are read back in
+-- first, so that the snapshot does not discard them.
+local function compact(cwd)
+  local db = dbOfDatabases[cwd]
+  if dbStamps[cwd] and databaseStamp() ~= dbStamps[cwd] then
+    for t, v in pairs((loadDatabase())) do
+      db[t] = v
+    end
+  end
+  pruneDurations(db)
+  save(db)
+  journalCounts[cwd] = {records = 0, limit = math.max(config.journalLimit, countResults(db))}
+  dbStamps[cwd] = databaseStamp()
+end
+
+-- Append the assignment `db[t][k] = v` to the journal.  Records are
+-- length-prefixed so that a record truncated by a crash can be detected
+-- and dropped during replay.
+local function journal(db, t, k, v)
+  local cwd = xpfs.getcwd()
+  local current = databaseStamp() == dbStamps[cwd]
+
+  lfsu.mkdir_p(config.buildDir)
+  local f = assert(io.open(getJournalPath(), 'ab'))
+  f:write(string.pack('<s4', serializeSorted{t, k, v}))
+  f:close()
+
+  -- Writes by other processes are left visible to compact() and
+  -- revalidateCache().
+  if current then
+    dbStamps[cwd] = databaseStamp()
+  end
+
+  dbOfDatabases[cwd] = dbOfDatabases[cwd] or db
+  local jc = journalCounts[cwd]
+  if not jc then
+    jc = {records = 0, limit = math.max(config.journalLimit, countResults(db))}
+    journalCounts[cwd] = jc
+  end
+  jc.records = jc.records + 1
+  if jc.records > jc.limit then
+    compact(cwd)
+  end
+end
+
+-- Apply each complete record in the journal at `p` to `db`.  Returns the
+-- number of records applied and whether the whole file was consumed.
+local function replay(db, p)
+  local f = io.open(p, 'rb')
+  if not f then
+    return 0, true
+  end
+  local s = f:read('a')
+  f:close()
+
+  local pos, n = 1, 0
+  while pos + 3 <= #s do
+    local len = string.unpack('<I4', s, pos)
+    if pos + 3 + len > #s then
+      break
+    end
+    local chunk = load('return ' .. s:sub(pos + 4, pos + 3 + len), p, 't', {})
+    local ok, r = false
+    if chunk then
+      ok, r = pcall(chunk)
+    end
+    if not ok or type(r) ~= 'table' then
+      break
+    end
+    local t, k, v = r[1], r[2], r[3]
+    db[t] = db[t] or {}
+    db[t][k] = v
+    pos = pos + 4 + len
+    n = n + 1
+  end
+  return n, pos > #s
+end
+
+function loadDatabase()
   local p = getDatabasePath()
+  local db
+  local f = io.open(p)
+  if f then
+    f:close()
+    db = loadfile(p)()
+  else
+    db = {results={}}
+  end
+  local n, complete = replay(db, getJournalPath())
+  return db, n, complete
+end
+
+local function initDatabase()
   local cwd = xpfs.getcwd()
   if dbOfDatabases[cwd] == nil then
-    local f = io.open(p)
-    if f then
-      f:close()
-      dbOfDatabases[cwd] = loadfile(p)()
+    local db, n, complete = loadDatabase()
+    dbOfDatabases[cwd] = db
+    journalCounts[cwd] = {records = n, limit = math.max(config.journalLimit, countResults(db))}
+
+    -- A damaged tail would hide any records appended after it.
+    if not complete or n > journalCounts[cwd].limit then
+      compact(cwd)
     else
-      dbOfDatabases[cwd] = {results={}}
+      dbStamps[cwd] = databaseStamp()
     end
   end
   return dbOfDatabases[cwd]
 end
 
+-- Forget each loaded database that another process has written since this
+-- one last read or wrote it, so that it is reloaded when next used.
+local function revalidateCache()
+  local oldDir = xpfs.getcwd()
+  for cwd in pairs(dbOfDatabases) do
+    if not xpfs.chdir(cwd) or databaseStamp() ~= dbStamps[cwd] then
+      dbOfDatabases[cwd] = nil
+      journalCounts[cwd] = nil
+      dbStamps[cwd] = nil
+    end
+  end
+  xpfs.chdir(oldDir)
+end
+
+-- Fold the journal of every loaded database into its snapshot.  With
+-- `fraction`, fold only journals that hold at least that fraction of the
+-- records that would force a fold.
+local function compactCache(fraction)
+  local oldDir = xpfs.getcwd()
+  for cwd in pairs(dbOfDatabases) do
+    local jc = journalCounts[cwd]
+    if jc and jc.records > 0 and jc.records >= (fraction or 0) * jc.limit then
+      xpfs.chdir(cwd)
+      compact(cwd)
+    end
+  end
+  xpfs.chdir(oldDir)
+end
+
 local function chdir(p)
   xpfs.chdir(p)
   return initDatabase()
@@ -83,92 +286,297 @@ local function isTask(t)
   return type(t) == 'table' and getmetatable(t) == thread.Task
 end
 
-local threadBuilderMap = {}
+--------------------------------
+-- Builder graph
+--------------------------------
+--
+-- Each builder is a node, numbered when it is created.  Its edges, the
+-- builders named in its arguments, are found once, on first use.
+--
+-- lower() collects the nodes reachable from a value that are not yet
+-- lowered and counts each node's unfinished dependencies.  It then works
+-- through a ready list, sparking each node once its last dependency has
+-- finished, so that every node is visited once.  The ready list is ordered
+-- by critical path, using the run times recorded in the database.  A node
+-- whose value contains builders is finished when those are lowered too;
+-- its final value is kept in `lowered`.
+
+-- forward-declare the 'sparkLowered' and 'lower' functions.
+local sparkLowered
+local lower
+
+-- Add the builders in `v` to the array `t`, without looking inside them.
+local function collectBuilders(v, t, seen)
+  if isBuilder(v) then
+    if not seen[v] then
+      seen[v] = true
+      table.insert(t, v)
+    end
+  elseif type(v) == 'table' and not seen[v] then
+    seen[v] = true
+    for _, x in pairs(v) do
+      collectBuilders(x, t, seen)
+    end
+  end
+  return t
+end
 
--- forward-declare the 'spark' function.
-local spark
+local function hasBuilders(v, seen)
+  if isBuilder(v) then
+    return true
+  elseif type(v) == 'table' and not seen[v] then
+    seen[v] = true
+    for _, x in pairs(v) do
+      if hasBuilders(x, seen) then
+        return true
+      end
+    end
+  end
+  return false
+end
 
-local function startLowering(v, compute)
-  -- if an argument is a builder, spark a thread that returns its value
-  local err
+-- Return the builders named in a builder's arguments.
+local function edges(o)
+  if not o.deps then
+    o.deps = collectBuilders(o.args, {}, {})
+  end
+  return o.deps
+end
+
+-- Return `v` with each builder `b` replaced by `f(b)`, and whether anything
+-- was replaced.  Tables without builders are shared, not copied.
+local function substitute(v, f)
   if isBuilder(v) then
-    local th
-    if v._priv.activeThunk then
-      th = v._priv.activeThunk
-    else
-      err, th = spark(v._priv, compute)
+    return f(v), true
+  elseif type(v) == 'table' then
+    local changes
+    for k, x in pairs(v) do
+      local y, changed = substitute(x, f)
+      if changed then
+        changes = changes or {}
+        table.insert(changes, {k, y})
+      end
     end
-    if err == nil then
-      if isTask(th) then
-        v._priv.activeThunk = th
-        threadBuilderMap[th] = v
+    if changes then
+      local t = setmetatable({}, getmetatable(v))
+      for k, x in pairs(v) do
+        t[k] = x
       end
-      v = th
+      for _, c in ipairs(changes) do
+        t[c[1]] = c[2]
+      end
+      return t, true
     end
-  elseif type(v) == 'table' and not isBuilder(v) then
-    local t = setmetatable({}, getmetatable(v))
-    for k,val in pairs(v) do
-      err, t[k] = startLowering(val, compute)
-      if err ~= nil then
-        break
+  end
+  return v, false
+end
+
+local function loweredValue(b)
+  return b._priv.lowered
+end
+
+-- Return `v` with each builder replaced by its lowered value.
+local function resolve(v)
+  return (substitute(v, loweredValue))
+end
+
+-- Return a name for a builder that is the same from one run to the next:
+-- its name and a digest of its arguments, with builders replaced by their
+-- own names.  Returns false if the arguments cannot be serialized.
+local function graphKey(o)
+  if o.graphKey == nil then
+    local args = substitute(o.args, function(b)
+      return {builder = graphKey(b._priv)}
+    end)
+    local ok, s = pcall(serializeSorted, args)
+    o.graphKey = ok and o.name .. '/' .. sha1.digest(s)
+  end
+  return o.graphKey
+end
+
+-- Return the run time recorded for a builder, or nil.
+local function recordedDuration(o)
+  local db = dbOfDatabases[o.dir]
+  if not db then
+    local oldDir = xpfs.getcwd()
+    db = chdir(o.dir)
+    xpfs.chdir(oldDir)
+  end
+  local key = graphKey(o)
+  return key and db.durations and db.durations[key]
+end
+
+-- Give each node a priority: the longest total run time along any path
+-- from it to a root.  Nodes on the critical path start first.  `order`
+-- lists each node before the nodes that depend on it.
+local function prioritize(order)
+  local known, total = 0, 0
+  for _, n in ipairs(order) do
+    local o = n.o
+    if not (o.valid or o.isPure) and config.cache then
+      n.duration = recordedDuration(o)
+      if n.duration then
+        known, total = known + 1, total + n.duration
       end
     end
-    v = t
   end
-  return err, v
+
+  -- Builders without a record are assumed to take the average time.
+  local default = known > 0 and total / known or 0
+  for i = #order, 1, -1 do
+    local n = order[i]
+    local tail = 0
+    for _, d in ipairs(n.dependents) do
+      tail = math.max(tail, d.priority)
+    end
+    local cost = n.duration or 0
+    if not (n.duration or n.o.valid or n.o.isPure) then
+      cost = default
+    end
+    n.priority = tail + cost
+  end
 end
 
-local function finishLowering(v)
-  if isTask(v) then
-    local th = v
-    local err
-    err, v = thread.join(th)
-    if err then
-      return err
+-- Lower the builders in `roots` and everything they depend on.  Returns
+-- nil, or the first error message.
+local function evaluate(roots, compute)
+  local nodes = {}     -- id -> node
+  local order = {}     -- nodes, each after its dependencies
+  local ready = Heap:new()  -- nodes whose dependencies are lowered
+  local running = 0    -- nodes waiting on a thread
+  local finished = thread.semaphore(0)
+  local results = {}   -- {node, join results...} of finished threads
+  local err
+
+  local function visit(b)
+    local o = b._priv
+    if o.done or nodes[o.id] then
+      return nodes[o.id]
+    end
+    local n = {o = o, waiting = 0, dependents = {}}
+    nodes[o.id] = n
+    if not o.valid then
+      for _, d in ipairs(edges(o)) do
+        local dn = visit(d)
+        if dn then
+          n.waiting = n.waiting + 1
+          table.insert(dn.dependents, n)
+        end
+      end
     end
+    table.insert(order, n)
+    return n
+  end
+
+  local function wait(n, task)
+    running = running + 1
+    thread.new(function()
+      table.insert(results, table.pack(n, pcall(thread.join, task)))
+      finished:release()
+    end)
+  end
 
-    if threadBuilderMap[th] then
-      threadBuilderMap[th]._priv.activeThunk = nil
-      threadBuilderMap[th] = nil
+  local function complete(n, value)
+    local o = n.o
+    if not n.lowering and hasBuilders(value, {}) then
+      -- The builder returned builders.  Lower them before going on.
+      n.lowering = true
+      return wait(n, thread.new(lower, value, compute))
     end
-  elseif type(v) == 'table' and not isBuilder(v) then
-    local t = setmetatable({}, getmetatable(v))
-    for k,val in pairs(v) do
-      local err
-      err, t[k] = finishLowering(val)
-      if err ~= nil then
-        return err
+    o.lowered, o.done = value, true
+    for _, d in ipairs(n.dependents) do
+      d.waiting = d.waiting - 1
+      if d.waiting == 0 then
+        ready:put(d, -d.priority)
       end
     end
-    v = t
   end
-  return nil, v
-end
 
--- lower one level
-local function decend(v, compute)
-  -- Spark a thread for each builder
-  local err, v = startLowering(v, compute)
-  if err ~= nil then
-    return err, v
+  local function start(n)
+    local o = n.o
+    if o.valid then
+      return complete(n, o.value)
+    end
+    -- Another call to lower() may have sparked it already.
+    local task = o.activeThunk
+    if not task then
+      -- Threads sparked for the node, and the job slots they ask for, go
+      -- by its priority.
+      local priority = thread.getPriority()
+      thread.setPriority(n.priority)
+      local e, value = sparkLowered(o, resolve(o.args), compute)
+      thread.setPriority(priority)
+      if e ~= nil then
+        err = e
+        return
+      elseif not isTask(value) then
+        return complete(n, value)
+      end
+      task = value
+      o.activeThunk = task
+    end
+    wait(n, task)
+  end
+
+  for _, b in ipairs(roots) do
+    visit(b)
+  end
+  prioritize(order)
+  for _, n in ipairs(order) do
+    if n.waiting == 0 then
+      ready:put(n, -n.priority)
+    end
+  end
+
+  local function collect()
+    finished:acquire()
+    running = running - 1
+    local r = table.remove(results, 1)
+    if not r[1].lowering then
+      r[1].o.activeThunk = nil
+    end
+    return table.unpack(r, 1, 4)
   end
 
-  -- Wait for all threads to complete
-  return finishLowering(v)
+  local thrown
+  while true do
+    while ready:first() and err == nil do
+      start(ready:get())
+    end
+    if err ~= nil or running == 0 then
+      break
+    end
+    local n, ok, e, value = collect()
+    if not ok then
+      err, thrown = e, true
+    elseif e ~= nil then
+      err = e
+    else
+      complete(n, value)
+    end
+  end
+  -- After a failure, wait for the builders still running, so that none of
+  -- them holds a job slot or writes to the journal once we have returned.
+  while running > 0 do
+    collect()
+  end
+  if thrown then
+    error(err, 0) -- Re-throw
+  end
+  return err
 end
 
-local function lower(v, compute)
-  local err, v = decend(v, compute)
+function lower(v, compute)
+  local err = evaluate(collectBuilders(v, {}, {}), compute)
   if err ~= nil then
-    return err, v
+    return err
   end
+  return nil, (resolve(v))
+end
 
-  -- If any builder returned builders, lower them too.
-  if #getBuilders(v) > 0 then
-    return lower(v, compute)
-  else
-    return nil, v
-  end
+-- Formerly lowered one level; lower() now finishes what it starts.
+local function decend(v, compute)
+  return lower(v, compute)
 end
 
 -- Buffered write all data from first file to second file
@@ -203,15 +611,29 @@ local function computeValue(o, args, key)
       w1:write(')\n')
     end
 
+    -- sparkIO starts the builder's span when it checks the cache.
+    local span = o.traceSpan or trace.begin(o.name, 'builder', {key = key})
+
     local cfg = {
       quiet    = config.quiet,
       silent   = config.silent,
       buildDir = config.buildDir .. '/' .. key,
       io       = {[1]=w1, [2]=w2},
+      jobs     = jobSlots,
+      compilerCache = config.compilerCache or nil,
+      batchCompiles = config.batchCompiles or nil,
       outPath  = o.outPath, -- Preferred output path
+      trace    = span,      -- Parent of the spans of spawned processes
+      inputFiles = {},      -- Inputs found while building, such as headers
     }
 
+    local t0 = xpio.gettime()
     local ok, err, val = xpcall(o.func, debug.traceback, cfg, table.unpack(args))
+    -- Time spent waiting for job slots depends on what else is running.
+    o.duration = xpio.gettime() - t0 - (cfg.slotWait or 0)
+    if span ~= o.traceSpan then
+      span:finish{error = (not ok or err ~= nil) or nil}
+    end
     if ok then
       if err ~= nil then
         errMsg = err
@@ -219,6 +641,7 @@ local function computeValue(o, args, key)
       else
         o.value = val
         o.valid = true
+        o.inputFiles = cfg.inputFiles
         if not config.silent then
           w1:write('--> ' .. serializeSorted(o.value) .. '\n\n')
         end
@@ -242,17 +665,193 @@ local function computeValue(o, args, key)
   return errMsg, o.value
 end
 
-local function readFile(p)
-  local f = assert(io.open(p, 'rb'))
-  local s = f:read('*a')
-  f:close()
-  return s
-end
-
 -- Return the sha1 checksum for the file at the given path
 local function digestFile(p)
-  local s = readFile(p)
-  return sha1.digest(s)
+  return assert(sha1.file(p))
+end
+
+-- Batches of at least this many files are hashed on native threads while
+-- other builders run.  Smaller ones are hashed inline.
+local hashBatchMin = 8
+
+-- Return a table mapping each of the given paths (relative to 'dir') to
+-- its sha1 checksum.  Large batches yield the current thread.
+local function digestFiles(dir, paths)
+  local digests = {}
+  if #paths < hashBatchMin then
+    for _,p in ipairs(paths) do
+      digests[p] = digestFile(p)
+    end
+    return digests
+  end
+
+  -- The working directory may change while we wait.
+  local absPaths = {}
+  for i,p in ipairs(paths) do
+    absPaths[i] = p:sub(1,1) == '/' and p or dir .. '/' .. p
+  end
+  local batch = sha1.batch(absPaths)
+  local done = xpio.fdopen(batch:fd())
+  done:read(1)
+  done:close()
+  local absDigests, errors = batch:results()
+  for i,p in ipairs(paths) do
+    digests[p] = absDigests[absPaths[i]] or error(p .. ': ' .. errors[absPaths[i]])
+  end
+  return digests
+end
+
+-- Files modified this recently may be modified again without their
+-- timestamp changing, so their fingerprint is not trusted.
+local racyWindow = 2
+
+-- Return a source record holding a file's sha1 and, when trustworthy, the
+-- stat fingerprint it was computed from.
+local function sourceRecord(st, digest)
+  local rec = {sha1 = digest}
+  if st.mtime_ns // 1000000000 < xpio.gettime() - racyWindow then
+    rec.size = st.size
+    rec.mtime = st.mtime_ns
+    rec.ctime = st.ctime_ns
+    rec.inode = st.inode
+  end
+  return rec
+end
+
+-- True if the source record 'rec' was taken from a file with stat 'st', so
+-- that its sha1 can be reused without reading the file.
+local function fingerprintMatches(rec, st)
+  return type(rec) == 'table' and not config.paranoid and rec.size == st.size
+     and rec.mtime == st.mtime_ns and rec.ctime == st.ctime_ns
+     and rec.inode == st.inode
+end
+
+-- Sources recorded before fingerprints were added are bare sha1 strings.
+local function sourceDigest(rec)
+  return type(rec) == 'table' and rec.sha1 or rec
+end
+
+local function flatten(t, o)
+  o = o or {}
+  for _, v in pairs(t) do
+    if type(v) == 'table' then
+      flatten(v, o)
+    else
+      table.insert(o, v)
+    end
+  end
+  return o
+end
+
+-- Digests of the files builders wrote during this run, keyed by absolute
+-- path, with the stat each was computed from.  A builder whose input was
+-- rewritten with the same bytes takes its digest from here rather than
+-- reading the file again, and so is not rerun.
+local outputDigests = {}
+
+-- Return the digest recorded for the output at 'abs', if the file is
+-- unchanged since.
+local function outputDigest(abs, st)
+  local rec = outputDigests[abs]
+  if rec and not config.paranoid and rec.size == st.size
+     and rec.mtime == st.mtime_ns and rec.ctime == st.ctime_ns
+     and rec.inode == st.inode then
+    return rec.sha1
+  end
+end
+
+-- Hash the files named in a builder's value (relative to 'dir') and
+-- record their digests in 'outputDigests'.  Returns true if there were
+-- some and each has the digest this run last recorded for it.
+local function hashOutputs(dir, value)
+  local stats, names, toHash, digests = {}, {}, {}, {}
+  local same = true
+  for _,v in ipairs(flatten{value}) do
+    if type(v) == 'string' and #v > 0 and #v < 4096 and not v:find('\n') and not digests[v] then
+      local abs = v:sub(1,1) == '/' and v or dir .. '/' .. v
+      local st = not names[abs] and xpfs.stat(abs, 'sink')
+      if st and st.kind == 'f' then
+        digests[v] = outputDigest(abs, st)
+        if not digests[v] then
+          stats[abs], names[abs] = st, v
+          table.insert(toHash, abs)
+        end
+      end
+    end
+  end
+  for abs,digest in pairs(digestFiles(dir, toHash)) do
+    local st = stats[abs]
+    digests[names[abs]] = digest
+    same = same and outputDigests[abs] ~= nil and outputDigests[abs].sha1 == digest
+    outputDigests[abs] = {sha1 = digest, size = st.size, mtime = st.mtime_ns,
+                          ctime = st.ctime_ns, inode = st.inode}
+  end
+  return same and next(digests) ~= nil
+end
+
+-- Inputs a builder reports while running, such as the headers a compiler
+-- read, are recorded as discovered sources.  They are checked like
+-- declared sources, but one that disappears makes the builder rerun rather
+-- than fail.
+local function isDiscovered(rec)
+  return type(rec) == 'table' and rec.discovered == true
+end
+
+-- Return 'sources' with its discovered sources replaced by the files in
+-- 'paths' (relative to 'dir').  Records whose fingerprint still matches
+-- are reused; other files are hashed.
+local function discoverSources(dir, sources, paths)
+  local t = {}
+  for k,v in pairs(sources) do
+    if not isDiscovered(v) then
+      t[k] = v
+    end
+  end
+  local stats, toHash, names = {}, {}, {}
+  for _,p in ipairs(paths) do
+    -- The working directory is not necessarily 'dir' here.
+    local abs = p:sub(1,1) == '/' and p or dir .. '/' .. p
+    local st = not t[p] and not stats[abs] and xpfs.stat(abs, 'sin')
+    if st then
+      sourcePaths[abs] = true
+      if fingerprintMatches(sources[p], st) then
+        t[p] = sources[p]
+      elseif outputDigest(abs, st) then
+        t[p] = sourceRecord(st, outputDigest(abs, st))
+        t[p].discovered = true
+      else
+        stats[abs], names[abs] = st, p
+        table.insert(toHash, abs)
+      end
+    end
+  end
+  for abs,digest in pairs(digestFiles(dir, toHash)) do
+    local rec = sourceRecord(stats[abs], digest)
+    rec.discovered = true
+    t[names[abs]] = rec
+  end
+  return t
+end
+
+-- Return 'sources' with its discovered sources replaced by 'inputs' (path
+-- -> sha1), the inputs recorded with outputs restored from the store.
+local function restoreSources(dir, sources, inputs)
+  local t = {}
+  for k,v in pairs(sources) do
+    if not isDiscovered(v) then
+      t[k] = v
+    end
+  end
+  for p,digest in pairs(inputs) do
+    local abs = p:sub(1,1) == '/' and p or dir .. '/' .. p
+    local st = not t[p] and xpfs.stat(abs, 'sin')
+    if st then
+      sourcePaths[abs] = true
+      t[p] = sourceRecord(st, digest)
+      t[p].discovered = true
+    end
+  end
+  return t
 end
 
 local function mkBuildName(db, nm)
@@ -260,6 +859,7 @@ local function mkBuildName(db, nm)
    db.builders[nm] = db.builders[nm] or {lastIndex = 0}
    local i = db.builders[nm].lastIndex + 1
    db.builders[nm].lastIndex = i
+   journal(db, 'builders', nm, db.builders[nm])
    return nm .. '/' .. i
 end
 
@@ -269,11 +869,14 @@ local function sparkIO(o, args, compute)
 
   -- Serialize the args and q unique ID for the function.
   local key = o.name .. '/' .. sha1.digest(argsString)
+  local span = trace.begin(o.name, 'builder', {key = key})
 
   local oldDir = xpfs.getcwd()
   local database = chdir(o.dir)
 
   local stale = nil
+  local paths = {}     -- sources to check
+  local oldSources = {}
 
   -- Check to see if the input arguments have changed
   --
@@ -295,105 +898,233 @@ local function sparkIO(o, args, compute)
     if inputFiles then
       dbEntry.sources = {}
     end
-    for _,v in ipairs(inputFiles or {}) do
-      if not xpfs.stat(v) then
-        chdir(oldDir)
-        return "File not found '" .. v .. "'."
-      end
-      stale[v] = digestFile(v)
-    end
+    paths = inputFiles or paths
   else
     -- Metatable is not serialized.  So add that here.
     local mt = o.info.outputMetatable
     if mt and dbEntry.valid then
       setmetatable(dbEntry.value, mt)
     end
+    oldSources = dbEntry.sources or oldSources
+    for k in pairs(oldSources) do
+      table.insert(paths, k)
+    end
   end
 
-  if dbEntry.sources then
-    for k,v in pairs(dbEntry.sources) do
-      -- Lookup sha1 from cache
-      if not xpfs.stat(k) then
+  if not dbEntry.sources then
+    -- If getInputFiles returned nil, dbEntry.sources will be nil,
+    -- which means ALWAYS recompute
+    stale = stale or {}
+  end
+
+  -- Stat every source.  Only those whose fingerprint has changed are
+  -- rehashed.  Stat before reading, so a write during the read leaves a
+  -- mismatch.
+  local stats, toCheck, toHash, known = {}, {}, {}, {}
+  for _,k in ipairs(paths) do
+    local abs = k:sub(1,1) == '/' and k or o.dir .. '/' .. k
+    sourcePaths[abs] = true
+    -- A file a watcher has seen no change to need not be stat'ed.
+    if not (oldSources[k] and config.unchanged and config.unchanged(abs)) then
+      local st = xpfs.stat(k, 'sin')
+      if not st and isDiscovered(oldSources[k]) then
+        -- A header that is no longer there is no longer included.
+        stale = stale or {}
+        dbEntry.sources[k] = nil
+      elseif not st then
         chdir(oldDir)
+        span:finish{error = true}
         return "File not found '" .. k .. "'."
+      elseif not fingerprintMatches(oldSources[k], st) then
+        stats[k] = st
+        table.insert(toCheck, k)
+        known[k] = outputDigest(abs, st)
+        if not known[k] then
+          table.insert(toHash, k)
+        end
       end
-      local hash = digestFile(k)
+    end
+  end
 
-      if v ~= hash then
+  local function checkDigests(digests)
+    local touched = false
+    for _,k in ipairs(toCheck) do
+      local rec = sourceRecord(stats[k], known[k] or digests[k])
+      rec.discovered = isDiscovered(oldSources[k]) or nil
+      if rec.sha1 ~= sourceDigest(oldSources[k]) then
         stale = stale or {}
-        stale[k] = hash
+        stale[k] = rec
+      else
+        -- Same contents, new fingerprint.  Remember it to skip the rehash.
+        dbEntry.sources[k] = rec
+        touched = true
       end
     end
-  else
-    -- If getInputFiles returned nil, dbEntry.sources will be nil,
-    -- which means ALWAYS recompute
-    stale = stale or {}
+    if touched and not stale then
+      journal(database, 'results', key, dbEntry)
+    end
   end
 
-  if stale then
-    local function computeAndSave()
-      dbEntry.valid = false
-      database.results[key] = dbEntry
-      local ok, err, val = xpcall(compute, debug.traceback, o, args, dbEntry.buildName)
-      if ok and err == nil then
-        dbEntry.value = o.value
-        dbEntry.valid = true
-        for k,v in pairs(stale) do
-          dbEntry.sources[k] = v
+  -- Return the store key for the builder's current declared inputs, or nil
+  -- if its results cannot be stored.  Discovered inputs are checked by the
+  -- store instead; a fresh tree has not discovered them yet.
+  local function casKey()
+    if not (config.cas and dbEntry.sources) then
+      return nil
+    end
+    local digests = {}
+    for k,v in pairs(dbEntry.sources) do
+      if not isDiscovered(v) then
+        digests[k] = sourceDigest(v)
+      end
+    end
+    for k,v in pairs(stale) do
+      digests[k] = not isDiscovered(v) and v.sha1 or nil
+    end
+    return cas.key(key, digests), digests
+  end
+
+  local function computeAndSave()
+    dbEntry.valid = false
+    database.results[key] = dbEntry
+    local buildDir = config.buildDir .. '/' .. dbEntry.buildName
+    local storeKey, digests = casKey()
+    local ok, err, val, hit, casValue, casInputs
+    if storeKey then
+      hit, casValue, casInputs = cas.get(config.cas, storeKey, o.dir, buildDir, config.remoteCache or nil)
+    end
+    if hit then
+      if not config.silent then
+        io.stdout:write('==> ' .. o.name .. ' (restored)\n')
+      end
+      local mt = o.info.outputMetatable
+      if mt and type(casValue) == 'table' then
+        setmetatable(casValue, mt)
+      end
+      o.value = casValue
+      o.valid = true
+      ok, val = true, casValue
+    else
+      o.traceSpan = span
+      ok, err, val = xpcall(compute, debug.traceback, o, args, dbEntry.buildName)
+      o.traceSpan = nil
+    end
+    local unchanged
+    if ok and err == nil then
+      -- Builders that consume identical outputs see no change.
+      unchanged = hashOutputs(o.dir, o.value)
+    end
+    span:finish{
+      cache  = hit and 'restored' or 'miss',
+      error  = (not ok or err ~= nil) or nil,
+      output = unchanged and 'unchanged' or nil,
+    }
+    if ok and err == nil then
+      dbEntry.value = o.value
+      dbEntry.valid = true
+      for k,v in pairs(stale) do
+        dbEntry.sources[k] = v
+      end
+      if o.inputFiles and dbEntry.sources then
+        dbEntry.sources = discoverSources(o.dir, dbEntry.sources, o.inputFiles)
+      elseif hit and dbEntry.sources then
+        dbEntry.sources = restoreSources(o.dir, dbEntry.sources, casInputs)
+      end
+      o.inputFiles = nil
+      -- Record the builder's graph key, so that compaction can tell
+      -- which run times are still in use.
+      dbEntry.graphKey = o.duration and o.graphKey or nil
+      journal(database, 'results', key, dbEntry)
+      if dbEntry.graphKey then
+        database.durations = database.durations or {}
+        database.durations[o.graphKey] = o.duration
+        journal(database, 'durations', o.graphKey, o.duration)
+      end
+      if storeKey and not hit then
+        local inputs = {}
+        for k,v in pairs(dbEntry.sources) do
+          if isDiscovered(v) then
+            inputs[k] = sourceDigest(v)
+          end
         end
-        save(database)
-        return nil, val
+        cas.put(config.cas, storeKey, o.dir, o.value, buildDir, digests, config.remoteCache or nil, inputs)
+      end
+      return nil, val
+    else
+      -- On failure, mark the previous result as invalid.
+      database.results[key].valid = nil
+      journal(database, 'results', key, dbEntry)
+      if ok then
+        return err
       else
-        -- On failure, mark the previous result as invalid.
-        database.results[key].valid = nil
-        save(database)
-        if ok then
-          return err
-        else
-          error(err) -- Re-throw
-        end
+        error(err) -- Re-throw
       end
     end
-    value = thread.new(computeAndSave)
+  end
+
+  if #toHash >= hashBatchMin then
+    -- Hash on worker threads and decide staleness once they finish.
+    value = thread.new(function()
+      local hashing = trace.begin('hash', 'hash', {files = #toHash}, span)
+      local digests = digestFiles(o.dir, toHash)
+      hashing:finish()
+      local dir = xpfs.getcwd()
+      chdir(o.dir)
+      checkDigests(digests)
+      chdir(dir)
+      if stale then
+        return computeAndSave()
+      end
+      o.value = dbEntry.value
+      o.valid = true
+      span:finish{cache = 'hit'}
+      return nil, o.value
+    end)
   else
-    value = dbEntry.value
-    o.value = value
-    o.valid = true
+    checkDigests(digestFiles(o.dir, toHash))
+    if stale then
+      value = thread.new(computeAndSave)
+    else
+      value = dbEntry.value
+      o.value = value
+      o.valid = true
+      span:finish{cache = 'hit'}
+    end
   end
   chdir(oldDir)
 
   return nil, value
 end
 
--- Either fetch a cached value or spark a thread that returns
--- a cached value.
-function spark(o, compute)
+-- Given a builder's lowered arguments, either fetch a cached value or
+-- spark a thread that returns it.
+function sparkLowered(o, args, compute)
   compute = compute or computeValue
-  local err, value
-  if not o.valid then
-    local args
-    err, args = lower(o.args, compute)
-    if err == nil then
-      if config.cache and not o.isPure then
-        err, value = sparkIO(o, args, compute)
-      else
-        value = thread.new(compute, o, args, o.name)
-      end
-    end
-  else
-    value = o.value
+  if config.cache and not o.isPure then
+    return sparkIO(o, args, compute)
   end
+  return nil, thread.new(compute, o, args, o.name)
+end
 
-  -- Uncomment this for serial evaluation
-  --if isTask(value) then
-  --  err, value = thread.join(value)
-  --end
-
-  return err, value
+-- Either fetch a cached value or spark a thread that returns
+-- a cached value.
+local function spark(o, compute)
+  if o.valid then
+    return nil, o.value
+  end
+  local err, args = lower(o.args, compute)
+  if err ~= nil then
+    return err
+  end
+  return sparkLowered(o, args, compute)
 end
 
+local builderCount = 0
+
 local function builder(f, name, info, isPure, args)
+  builderCount = builderCount + 1
   local priv = {
+    id      = builderCount,
     dir     = xpfs.getcwd(),
     func    = f,
     name    = name,
@@ -408,18 +1139,6 @@ local function builder(f, name, info, isPure, args)
   return setmetatable(t, builderMeta)
 end
 
-local function flatten(t, o)
-  o = o or {}
-  for _, v in pairs(t) do
-    if type(v) == 'table' then
-      flatten(v, o)
-    else
-      table.insert(o, v)
-    end
-  end
-  return o
-end
-
 local function defaultGetInputFiles(...)
   local vs = flatten{...}
   local fs = {}
@@ -464,8 +1183,19 @@ local function getBuildDirectory()
   return config.buildDir
 end
 
+-- Return the set of absolute paths of the sources and build files read
+-- since the last call, and start a new set.
+local function takeSourcePaths()
+  local paths = sourcePaths
+  sourcePaths = {}
+  return paths
+end
+
 local function clearCache()
-  dbOfDatabases[xpfs.getcwd()] = {results = {}}
+  local cwd = xpfs.getcwd()
+  dbOfDatabases[cwd] = {results = {}}
+  journalCounts[cwd] = {records = 0, limit = config.journalLimit}
+  dbStamps[cwd] = nil
 end
 
 local function requireBuilders(nm)
@@ -486,6 +1216,7 @@ local function requireWrapped(nm)
         silent   = config.silent,
         buildDir = config.buildDir .. '/' .. key,
         io       = {[1]=w1, [2]=w2},
+        jobs     = jobSlots,
       }
       wrapped[k] = function(...)
         local err, v = f(cfg, ...)
@@ -566,17 +1297,31 @@ local function validate(path, spec, ps)
   return ps
 end
 
-local function importBuild(path, evaluate)
-  local f = assert(loadfile(path .. '/build.lua'))
-
-  local oldDir = xpfs.getcwd()
-  chdir(path)
+-- The compiled chunk of each build file, when config.keepBuildFiles is
+-- set, and the stamp of the file it was compiled from.
+local keptBuildFiles = {}
 
-  local absDir = xpfs.getcwd()
-  local o = assert(f())
+local function fileStamp(p)
+  local st = xpfs.stat(p, 'sn')
+  return st and st.size .. ':' .. st.mtime_ns
+end
 
-  chdir(oldDir)
+-- Load the build file at `file` (absolute), like loadfile.  With
+-- config.keepBuildFiles, the chunk is compiled again only when the file
+-- changes.  Callers run it on every build, so that each build gets new
+-- builders, whose inputs are checked again.
+local function loadBuildFile(file)
+  local stamp = fileStamp(file)
+  local kept = keptBuildFiles[file]
+  if config.keepBuildFiles and kept and kept.stamp == stamp then
+    return kept.chunk
+  end
+  local chunk, err = loadfile(file)
+  keptBuildFiles[file] = config.keepBuildFiles and chunk and {stamp = stamp, chunk = chunk} or nil
+  return chunk, err
+end
 
+local function wrapImported(o, path, absDir, evaluate)
   if not isBuilder(o) and type(o) == 'table' then
     for k,func in pairs(o) do
       if type(func) == 'function' then
@@ -599,7 +1344,20 @@ local function importBuild(path, evaluate)
       end
     end
   end
+  return o
+end
 
+local function importBuild(path, evaluate)
+  local oldDir = xpfs.getcwd()
+  chdir(path)
+
+  local absDir = xpfs.getcwd()
+  local file = absDir .. '/build.lua'
+  sourcePaths[file] = true
+  local f = assert(loadBuildFile(file))
+  local o = wrapImported(assert(f()), path, absDir, evaluate)
+
+  chdir(oldDir)
   return o
 end
 
@@ -649,6 +1407,10 @@ local function configure(ps)
   if config.silent then
     config.quiet = true
   end
+  if ps.jobs ~= nil then
+    -- `jobs = false` restores the default.
+    jobSlots = ps.jobs and jobserver.server(ps.jobs) or defaultJobSlots
+  end
   initDatabase()
 end
 
@@ -656,6 +1418,7 @@ initDatabase()
 
 return {
   clearCache            = clearCache,
+  compactCache          = compactCache,
   computeValue          = computeValue,
   configure             = configure,
   decend                = decend,
@@ -664,6 +1427,9 @@ return {
   getBuilders           = getBuilders,
   getBuildDirectory     = getBuildDirectory,
   importBuild           = importBuild,
+  revalidateCache       = revalidateCache,
+  loadBuildFile         = loadBuildFile,
+  takeSourcePaths       = takeSourcePaths,
   importBuilt           = importBuilt,
   isBuilder             = isBuilder,
   lift                  = lift,
@@ -675,4 +1441,7 @@ return {
   requireWrapped        = requireWrapped,
   spark                 = spark,
   validate              = validate,
+
+  -- exported for testing
+  _loadDatabase         = loadDatabase,
 }
@@ -1,4 +1,5 @@
 local xpfs = require 'xpfs'
+local lfsu = require 'lfsu'
 local qtest = require 'qtest'
 local process = require 'process'
 
@@ -52,6 +53,12 @@ assert(flakeFail({'-'}, buildFile):match 'setting a field on a builder object is
 -- Sunny day tests
 eq(flakeGood({'-'}, 'print(123)'), '123')
 
+-- Build from a fresh cache, so that results journaled by a previous run
+-- do not turn the build below into a no-op.
+local cachedir = outdir .. '/cache'
+lfsu.rm_rf(cachedir)
+xpfs.mkdir(cachedir)
+
 local buildFile = [[
 local flake = require 'flake'
 local function foo()
@@ -59,7 +66,11 @@ end
 local fooBuilder = flake.lift(foo, 'foo')
 return fooBuilder()
 ]]
-eq(flakeGood({'-'}, buildFile), '==> foo()\n--> nil')
+local f = assert(io.open(cachedir .. '/build.lua', 'w'))
+f:write(buildFile)
+f:close()
+local out = flakeGood({'-C', cachedir})
+eq(out:match '==> .-\n%-%-> [^\n]*', '==> foo()\n--> nil')
 
 --TODO:
 --local buildFile = [[
@@ -21,9 +21,21 @@ Usage: flake [OPTIONS]... [FILE [TARGET [TARGET_PARAMS]]]
 Options:
 --directory=DIR   -C DIR  Change to this directory first
 --penniless               Run as fast as possible.  No cache.
+--paranoid                Rehash every source, ignoring file timestamps.
+--cas                     Share outputs through $XDG_CACHE_HOME/flake/cas.
+--compiler-cache          Reuse objects through $XDG_CACHE_HOME/flake/cc.
+--batch-compiles          Compile objects with like flags in one command.
+--remote-cache=ADDR       Back --cas with the cache server at IP:PORT.
+--serve-cache=ADDR        Serve the --cas store at IP:PORT until killed.
+--trace=FILE              Write a Chrome trace of the build to FILE.
+--daemon                  Run later builds in this workspace until killed.
+--server                  Same as --daemon.
+--no-daemon               Build in this process, even if a daemon is running.
+--watch                   Build, then rebuild whenever a source changes.
 --quiet                   Don't output commands.
 --silent          -s      Output as little as possible.
 --version         -v      Print flake version and exit
+--jobs=N          -j N    Run at most N commands at once.  Default: CPUs.
 --package=DIR     -I DIR  Include package directory
                   -e STR  Execute statement
 ]=]
@@ -32,9 +44,20 @@ local function parseArgs(args, errHdlr)
   local opts = {
     '--directory/-C=',  -- Change to this directory first
     '--penniless',      -- Run as fast as possible.  No cache.
+    '--paranoid',       -- Rehash every source, ignoring file timestamps.
+    '--cas',            -- Share outputs through a content-addressed store.
+    'compilerCache/--compiler-cache',  -- Reuse objects across build directories.
+    'batchCompiles/--batch-compiles',  -- Compile objects together.
+    'remoteCache/--remote-cache=',  -- Back --cas with a cache server.
+    'serveCache/--serve-cache=',    -- Serve the --cas store.
+    '--trace=',         -- Write a Chrome trace of the build.
+    '--daemon/--server',          -- Run builds for later invocations.
+    'noDaemon/--no-daemon',       -- Build in this process.
+    '--watch',          -- Rebuild whenever a source changes.
     '--quiet',          -- Don't output commands.
     '--silent/-s',      -- Output as little as possible.
     '--version/-v',     -- Print flake version and exit
+    '--jobs/-j=',       -- Run at most N commands at once.
     '--package/-I=*',   -- Include package directory
     '-e=',              -- Execute statement
     '-',                -- Execute stdin
@@ -5,13 +5,25 @@
 local flake    = require 'flake'
 local thread   = require 'thread'
 local lfsu     = require 'lfsu'
+local xpfs     = require 'xpfs'
 local qt       = require 'qtest'
 
-local function sparkWithFile(path)
+local function sparkWithFiles(paths, compute)
+  local info = {getInputFiles = function(cfg, srcs) return srcs end}
+  local f = flake.lift(function() end, 'foo', info)
+  local o = f(paths)
+  local err, v = flake.spark(o._priv, compute or function() end)
+  if err == nil and type(v) == 'table' and getmetatable(v) == thread.Task then
+    err, v = thread.join(v)
+  end
+  return err
+end
+
+local function sparkWithFile(path, compute)
   local info = {getInputFiles = function(cfg, src) return {src} end}
   local f = flake.lift(function() end, 'foo', info)
   local o = f(path)
-  local err, v = flake.spark(o._priv, function() end)
+  local err, v = flake.spark(o._priv, compute or function() end)
   if err == nil and type(v) == 'table' and getmetatable(v) == thread.Task then
     err, v = thread.join(v)
   end
@@ -38,6 +50,299 @@ local function testSparkWithBogusFile()
   qt.eq(sparkWithFile('bogus'), "File not found 'bogus'.")
 end
 
+local function testJournal()
+  local out = os.getenv 'OUTDIR'
+  local p = out .. '/journal.txt'
+  lfsu.mkdir_p(out)
+  lfsu.write(p, 'FOO\n')
+  qt.eq(sparkWithFile(p), nil)
+
+  -- Results are appended to the journal, not written to a new snapshot.
+  local dir = flake.getBuildDirectory()
+  qt.eq(xpfs.stat(dir .. '/cache.lua'), nil)
+
+  local function validResults(db)
+    local t = {}
+    for key, entry in pairs(db.results) do
+      if entry.valid then
+        table.insert(t, key)
+      end
+    end
+    table.sort(t)
+    return t
+  end
+  local journaled = validResults(flake._loadDatabase())
+  qt.eq(#journaled, 1)
+
+  -- A record truncated by a crash is dropped during replay.
+  local f = assert(io.open(dir .. '/cache.log', 'ab'))
+  f:write(string.pack('<I4', 100) .. 'return')
+  f:close()
+  local db, n, complete = flake._loadDatabase()
+  qt.eq(validResults(db), journaled)
+  qt.eq(complete, false)
+
+  -- Compaction folds the journal into the snapshot.
+  flake.compactCache()
+  qt.eq(xpfs.stat(dir .. '/cache.log'), nil)
+  qt.eq(xpfs.stat(dir .. '/cache.lua', 'k').kind, 'f')
+  db, n, complete = flake._loadDatabase()
+  qt.eq(db.results[journaled[1]].valid, true)
+  qt.eq({n, complete}, {0, true})
+
+  -- Records appended by another process survive compaction.
+  f = assert(io.open(dir .. '/cache.log', 'ab'))
+  f:write(string.pack('<s4', '{"results", "other", {valid = true}}'))
+  f:close()
+  local p2 = out .. '/journal2.txt'
+  lfsu.write(p2, 'BAR\n')
+  qt.eq(sparkWithFile(p2), nil)
+  flake.compactCache()
+  db = flake._loadDatabase()
+  qt.eq(db.results.other, {valid = true})
+  qt.eq(#validResults(db), 3)
+
+  -- Compaction drops run times of builders that have no result.
+  f = assert(io.open(dir .. '/cache.log', 'ab'))
+  f:write(string.pack('<s4', '{"results", "timed", {valid = true, graphKey = "kept"}}'))
+  f:write(string.pack('<s4', '{"durations", "kept", 2}'))
+  f:write(string.pack('<s4', '{"durations", "gone", 1}'))
+  f:close()
+  local p3 = out .. '/journal3.txt'
+  lfsu.write(p3, 'BAZ\n')
+  qt.eq(sparkWithFile(p3), nil)
+  flake.compactCache()
+  qt.eq(flake._loadDatabase().durations, {kept = 2})
+end
+
+local function testFingerprint()
+  local out = os.getenv 'OUTDIR'
+  local p = out .. '/fingerprint.txt'
+  lfsu.mkdir_p(out)
+
+  -- Backdate the file so its fingerprint is trusted.
+  local function writeOld(s)
+    lfsu.write(p, s)
+    assert(os.execute('touch -d 2001-09-09T01:46:40 ' .. p))
+  end
+
+  local computed = 0
+  local function compute()
+    computed = computed + 1
+  end
+
+  writeOld('FOO\n')
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(computed, 1)
+
+  local st = xpfs.stat(p, 'sin')
+  local rec
+  for _, entry in pairs(flake._loadDatabase().results) do
+    rec = entry.sources and entry.sources[p] or rec
+  end
+  qt.eq({rec.size, rec.mtime, rec.ctime, rec.inode},
+        {st.size, st.mtime_ns, st.ctime_ns, st.inode})
+
+  -- Unchanged fingerprint, or unchanged contents in paranoid mode.
+  qt.eq(sparkWithFile(p, compute), nil)
+  flake.configure{paranoid = true}
+  qt.eq(sparkWithFile(p, compute), nil)
+  flake.configure{paranoid = false}
+  qt.eq(computed, 1)
+
+  -- Same size and mtime, but ctime reveals the rewrite.
+  writeOld('BAR\n')
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(computed, 2)
+end
+
+local function testDiscovered()
+  local out = os.getenv 'OUTDIR'
+  local p = out .. '/discovered.c'
+  local h = lfsu.abspath(out .. '/discovered.h')
+  lfsu.mkdir_p(out)
+  lfsu.write(p, 'FOO\n')
+  lfsu.write(h, 'BAR\n')
+
+  -- The builder reports the header it read.
+  local computed = 0
+  local function compute(o)
+    computed = computed + 1
+    o.inputFiles = {h}
+    o.value, o.valid = true, true
+  end
+
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(computed, 1)
+
+  local rec
+  for _, entry in pairs(flake._loadDatabase().results) do
+    rec = entry.sources and entry.sources[h] or rec
+  end
+  qt.eq(rec.discovered, true)
+
+  -- Editing the header reruns the builder.
+  lfsu.write(h, 'BAZ\n')
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(computed, 2)
+
+  -- A header that is gone reruns it too, rather than failing.
+  lfsu.rm_rf(h)
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(computed, 3)
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(computed, 3)
+end
+
+local function testStore()
+  local out = lfsu.abspath(os.getenv 'OUTDIR')
+  local p = out .. '/stored.c'
+  local h = out .. '/stored.h'
+  lfsu.write(p, 'FOO\n')
+  lfsu.write(h, 'BAR\n')
+  lfsu.rm_rf(out .. '/store')
+  flake.configure{cas = out .. '/store'}
+
+  local computed = 0
+  local function compute(o)
+    computed = computed + 1
+    o.inputFiles = {h}
+    o.value, o.valid = true, true
+  end
+  local function freshTree()
+    lfsu.rm_rf(flake.getBuildDirectory())
+    lfsu.mkdir_p(flake.getBuildDirectory())
+    flake.clearCache()
+  end
+
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(computed, 1)
+
+  -- A fresh tree restores the result and learns the header from the store.
+  freshTree()
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(computed, 1)
+  local rec
+  for _, entry in pairs(flake._loadDatabase().results) do
+    rec = entry.sources and entry.sources[h] or rec
+  end
+  qt.eq(rec.discovered, true)
+
+  -- Editing the header of the restored result reruns the builder.
+  lfsu.write(h, 'BAZ\n')
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(computed, 2)
+
+  -- A fresh tree does not restore a result built with another header.
+  lfsu.write(h, 'QUX\n')
+  freshTree()
+  qt.eq(sparkWithFile(p, compute), nil)
+  qt.eq(computed, 3)
+
+  flake.configure{cas = false}
+end
+
+local function testKeepBuildFiles()
+  local out = lfsu.abspath(os.getenv 'OUTDIR')
+  local dir = out .. '/kept'
+  local file = dir .. '/build.lua'
+  lfsu.mkdir_p(dir)
+  local runs = 0
+  rawset(_G, 'countRun', function() runs = runs + 1 end)
+  lfsu.write(file, 'countRun() return {}')
+
+  -- The chunk is kept, but it is run on every import.
+  flake.configure{keepBuildFiles = true}
+  local f = flake.loadBuildFile(file)
+  qt.eq(flake.loadBuildFile(file) == f, true)
+  local t = flake.importBuild(dir)
+  qt.eq(flake.importBuild(dir) == t, false)
+  qt.eq(runs, 2)
+
+  -- A build file that changes is compiled again.
+  lfsu.write(file, 'countRun() return {1}')
+  qt.eq(flake.loadBuildFile(file) == f, false)
+  qt.eq(flake.importBuild(dir), {1})
+  qt.eq(runs, 3)
+
+  flake.configure{keepBuildFiles = false}
+  qt.eq(flake.loadBuildFile(file) == flake.loadBuildFile(file), false)
+  rawset(_G, 'countRun', nil)
+end
+
+local function testCutoff()
+  local out = lfsu.abspath(os.getenv 'OUTDIR')
+  local src = out .. '/cutoff.c'
+  local obj = out .. '/cutoff.o'
+  lfsu.mkdir_p(out)
+  lfsu.write(src, 'int x; // one\n')
+
+  -- Compiling drops comments.
+  local compiled = 0
+  local compile = flake.lift(function(cfg, p)
+    compiled = compiled + 1
+    lfsu.write(obj, (lfsu.read(p):gsub('//[^\n]*', '')))
+    return nil, obj
+  end, 'compile', {getInputFiles = function(cfg, p) return {p} end})
+
+  local linked = 0
+  local link = flake.lift(function(cfg, p)
+    linked = linked + 1
+    return nil, lfsu.read(p)
+  end, 'link')
+
+  local function build()
+    local err, val = flake.lower(link(compile(src)))
+    qt.eq(err, nil)
+    return val
+  end
+
+  qt.eq(build(), 'int x; \n')
+  qt.eq({compiled, linked}, {1, 1})
+
+  -- The object is rewritten with the same bytes.  Linking is skipped.
+  lfsu.write(src, 'int x; // two\n')
+  qt.eq(build(), 'int x; \n')
+  qt.eq({compiled, linked}, {2, 1})
+
+  -- Output digests are kept in memory only.
+  for _, entry in pairs(flake._loadDatabase().results) do
+    qt.eq(entry.outputs, nil)
+  end
+
+  lfsu.write(src, 'int y;\n')
+  qt.eq(build(), 'int y;\n')
+  qt.eq({compiled, linked}, {3, 2})
+end
+
+local function testHashBatch()
+  -- Enough inputs to be hashed on worker threads.
+  local out = os.getenv 'OUTDIR'
+  lfsu.mkdir_p(out)
+  local paths = {}
+  for i = 1, 20 do
+    paths[i] = out .. '/batch' .. i .. '.txt'
+    lfsu.write(paths[i], string.rep('x', i))
+  end
+
+  local computed = 0
+  local function compute()
+    computed = computed + 1
+  end
+
+  qt.eq(sparkWithFiles(paths, compute), nil)
+  qt.eq(sparkWithFiles(paths, compute), nil)
+  qt.eq(computed, 1)
+
+  lfsu.write(paths[7], 'changed')
+  qt.eq(sparkWithFiles(paths, compute), nil)
+  qt.eq(computed, 2)
+
+  lfsu.rm_rf(paths[20])
+  qt.eq(sparkWithFiles(paths, compute), "File not found '" .. paths[20] .. "'.")
+end
+
 local function testLowering()
   -- Initialize
   local out = flake.getBuildDirectory()
@@ -87,10 +392,85 @@ local function testLowering()
   assert(f1 == val)
 end
 
+local function testGraph()
+  local calls = {}
+  local function count(name, f)
+    return flake.liftPure(function(...)
+      calls[name] = (calls[name] or 0) + 1
+      return f(...)
+    end, name)
+  end
+  local leaf = count('leaf', function(x) return x end)
+  local inc = count('inc', function(x) return x + 1 end)
+  local add = count('add', function(t) return t[1] + t[2] end)
+  local wrap = count('wrap', function(x) return {n = inc(x)} end)
+
+  -- A diamond: the shared node is evaluated once.
+  local a = leaf(1)
+  local err, val = flake.lower({add{inc(a), inc(a)}, a, 'x'})
+  qt.eq(err, nil)
+  qt.eq(val, {4, 1, 'x'})
+  qt.eq(calls, {leaf = 1, inc = 2, add = 1})
+
+  -- Builders returned by a builder are lowered too.
+  local w = wrap(a)
+  err, val = flake.lower{w, w}
+  qt.eq(err, nil)
+  qt.eq(val, {{n = 2}, {n = 2}})
+  qt.eq(calls.wrap, 1)
+
+  -- Tables without builders are not copied.
+  local t = {1, {2}}
+  err, val = flake.lower{t, inc(a)}
+  qt.eq(val[1] == t, true)
+end
+
+local function testPriority()
+  local log = {}
+  local delays = {a = 0.01, b = 0.05, c = 0.03}
+  local info = {getInputFiles = function() return nil end}  -- always rerun
+  local step = flake.lift(function(cfg, name)
+    table.insert(log, name)
+    thread.sleep(delays[name])
+    return nil, name
+  end, 'step', info)
+
+  -- The first run records how long each step takes...
+  local err, val = flake.lower{step 'a', step 'b', step 'c'}
+  qt.eq(err, nil)
+  qt.eq(val, {'a', 'b', 'c'})
+
+  -- ...and later runs start the longest first.
+  log = {}
+  err, val = flake.lower{step 'a', step 'b', step 'c'}
+  qt.eq(val, {'a', 'b', 'c'})
+  qt.eq(log, {'b', 'c', 'a'})
+end
+
+local function testFailedPass()
+  local info = {getInputFiles = function() return nil end}  -- always rerun
+  local finished = {}
+  local step = flake.lift(function(cfg, name, delay)
+    thread.sleep(delay)
+    if name == 'bad' then
+      return 'failed'
+    end
+    finished[name] = true
+    return nil, name
+  end, 'step', info)
+
+  -- lower() does not return until the builders still running are done.
+  local err = flake.lower{step('bad', 0), step('slow', 0.05)}
+  qt.eq(err, 'failed')
+  qt.eq(finished, {slow = true})
+end
+
 local function runWithDB(dbDir, f)
   -- Initialize
-  flake.configure{buildDir = dbDir, silent = true}
+  flake.configure{buildDir = dbDir, silent = true, cache = true}
   lfsu.rm_rf(dbDir)
+  -- Drop the database loaded from the enclosing build's directory.
+  flake.clearCache()
   local out = flake.getBuildDirectory()
   lfsu.mkdir_p(out)
 
@@ -108,7 +488,17 @@ local function main()
   local dbDir = os.getenv 'OUTDIR' .. '/flake'
   runWithDB(dbDir, testSpark)
   runWithDB(dbDir, testSparkWithBogusFile)
+  runWithDB(dbDir, testJournal)
+  runWithDB(dbDir, testFingerprint)
+  runWithDB(dbDir, testDiscovered)
+  runWithDB(dbDir, testStore)
+  runWithDB(dbDir, testKeepBuildFiles)
+  runWithDB(dbDir, testCutoff)
+  runWithDB(dbDir, testHashBatch)
   runWithDB(dbDir, testLowering)
+  runWithDB(dbDir, testGraph)
+  runWithDB(dbDir, testPriority)
+  runWithDB(dbDir, testFailedPass)
 end
 
 thread.dispatch(main)
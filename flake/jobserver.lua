@@ -0,0 +1,206 @@
+-- GNU make jobserver support
+--
+-- A jobserver is a pipe holding one byte (a "token") for each job that may
+-- run in addition to the one every process may run implicitly.  A process
+-- reads a token before starting an extra job, and writes it back when the
+-- job exits.
+--
+-- When flake runs under make (MAKEFLAGS names a jobserver), job slots are
+-- taken from make's pool.  Otherwise flake serves a pool of its own.  In
+-- both cases the pool is passed to child processes through MAKEFLAGS and
+-- inherited descriptors, so a make run by flake shares flake's job limit.
+--
+-- Jobserver objects have the same acquire() and release() methods as a
+-- thread.semaphore, plus export() for preparing a child's environment.
+
+local thread = require 'thread'
+local xpio   = require 'xpio'
+local xpfs   = require 'xpfs'
+
+local yield = coroutine.yield
+
+-- Descriptors at which children find a pool served by flake.
+local childReadFd, childWriteFd = 3, 4
+
+-- Return the jobserver named in a MAKEFLAGS string as {fifo = path} or
+-- {read = fd, write = fd}, or nil if there is none.
+local function parseMakeflags(s)
+  local auth
+  for w in (s or ''):gmatch('%S+') do
+    auth = w:match('^%-%-jobserver%-auth=(.*)') or w:match('^%-%-jobserver%-fds=(.*)') or auth
+  end
+  if not auth then
+    return nil
+  end
+  local fifo = auth:match('^fifo:(.+)')
+  if fifo then
+    return {fifo = fifo}
+  end
+  local r, w = auth:match('^(%d+),(%d+)$')
+  if r then
+    return {read = tonumber(r), write = tonumber(w)}
+  end
+  return nil
+end
+
+local Jobserver = {}
+Jobserver.__index = Jobserver
+
+local function new(t)
+  t.free = true              -- the implicit token is unused
+  t.tokens = {}              -- tokens read from the pool
+  t.lock = thread.semaphore(1)
+  return setmetatable(t, Jobserver)
+end
+
+-- Create the pool of a server on first use.  The FIFO is removed as soon
+-- as it is open, so that nothing is left behind.  Children inherit a
+-- descriptor for it, and reset that descriptor to blocking mode; flake
+-- reads through a separate, non-blocking one.
+local function openPool(me)
+  if me.r then
+    return
+  end
+  local path = os.tmpname()
+  os.remove(path)
+  assert(xpfs.mkfifo(path))
+  me.r = assert(xpio.open(path, 'r'))
+  me.w = assert(xpio.open(path, 'rw'))
+  os.remove(path)
+  me.w:write(string.rep('+', me.jobs - 1))
+
+  local fd = me.w:fileno()
+  me.grant = {[childReadFd] = fd, [childWriteFd] = fd}
+  me.makeflags = ('-j%d --jobserver-fds=%d,%d --jobserver-auth=%d,%d'):format(
+    me.jobs, childReadFd, childWriteFd, childReadFd, childWriteFd)
+end
+
+-- Serve a pool of `jobs` slots.
+local function server(jobs)
+  return new{jobs = jobs}
+end
+
+-- Join the pool named by `makeflags` (default: $MAKEFLAGS), or return nil.
+local function client(makeflags)
+  makeflags = makeflags or os.getenv 'MAKEFLAGS'
+  local auth = parseMakeflags(makeflags)
+  if not auth then
+    return nil
+  end
+
+  local r, w, grant
+  if auth.fifo then
+    r = xpio.open(auth.fifo, 'r')
+    w = r and xpio.open(auth.fifo, 'w')
+    grant = {}
+  else
+    -- make passes the pool only to commands it knows are recursive, so
+    -- the descriptors may be closed or reused.
+    local proc = '/proc/self/fd/' .. auth.read
+    local st = xpfs.stat(proc, 'k')
+    if st and st.kind ~= 'p' then
+      return nil
+    end
+
+    -- Tokens are read through a descriptor of our own, opened through
+    -- /proc, so that making it non-blocking does not change make's.  The
+    -- inherited descriptor is shared with make and its other jobs, so it
+    -- is never changed.  Without /proc, only the implicit slot is used.
+    r = st and xpio.open(proc, 'r')
+    w = xpio.fdopen(auth.write)
+    grant = {[auth.read] = auth.read, [auth.write] = auth.write}
+    if w and not r then
+      return new{implicitOnly = thread.semaphore(1), w = w, grant = grant,
+                 makeflags = makeflags}
+    end
+  end
+  if not (r and w) then
+    return nil
+  end
+  return new{r = r, w = w, grant = grant, makeflags = makeflags}
+end
+
+-- Take a job slot, waiting until one is available.
+function Jobserver:acquire()
+  if self.implicitOnly then
+    return self.implicitOnly:acquire()
+  elseif self.free then
+    self.free = false
+    return
+  end
+
+  -- One task at a time waits on the pool.  If that task is killed while
+  -- it waits, the next one takes over.
+  self.lock:acquire()
+  local exitId = thread.atExit(function()
+    self.reader = nil
+    self.lock:release()
+  end)
+  openPool(self)
+  local task = xpio.getCurrentTask()
+  while true do
+    if self.free then
+      self.free = false
+      break
+    end
+    local token, err = self.r:try_read(1)
+    if token then
+      table.insert(self.tokens, token)
+      break
+    elseif err ~= 'retry' then
+      thread.cancelAtExit(exitId)
+      self.lock:release()
+      error('jobserver: ' .. (err or 'pool closed'), 0)
+    end
+    self.reader = task
+    yield( self.r:when_read(task) )
+    self.reader = nil
+  end
+  thread.cancelAtExit(exitId)
+  self.lock:release()
+end
+
+-- Return a job slot.  Tokens go back to the pool; the implicit slot is
+-- handed to the task waiting on the pool, if any.
+function Jobserver:release()
+  if self.implicitOnly then
+    return self.implicitOnly:release()
+  end
+  local token = table.remove(self.tokens)
+  if token then
+    self.w:write(token)
+  else
+    self.free = true
+    local task = self.reader
+    if task then
+      task:_dequeue()
+      task:makeReady()
+    end
+  end
+end
+
+-- Return copies of a child's environment and descriptor tables with the
+-- pool added.
+function Jobserver:export(env, files)
+  openPool(self)
+  local e, f = {}, {}
+  for k,v in pairs(env) do
+    e[k] = v
+  end
+  e.MAKEFLAGS = env.MAKEFLAGS and env.MAKEFLAGS .. ' ' .. self.makeflags or self.makeflags
+  for k,v in pairs(files) do
+    f[k] = v
+  end
+  for k,v in pairs(self.grant) do
+    if f[k] == nil then
+      f[k] = v
+    end
+  end
+  return e, f
+end
+
+return {
+  client         = client,
+  parseMakeflags = parseMakeflags,
+  server         = server,
+}
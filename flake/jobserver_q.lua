@@ -0,0 +1,124 @@
+local jobserver = require 'jobserver'
+local thread    = require 'thread'
+local xpio      = require 'xpio'
+local xpfs      = require 'xpfs'
+local qt        = require 'qtest'
+
+--
+-- parseMakeflags
+--
+qt.eq(jobserver.parseMakeflags(nil), nil)
+qt.eq(jobserver.parseMakeflags('-j4'), nil)
+qt.eq(jobserver.parseMakeflags(' -j4 --jobserver-fds=3,4 --jobserver-auth=3,4'), {read=3, write=4})
+qt.eq(jobserver.parseMakeflags('ks -j --jobserver-auth=fifo:/tmp/GMfifo1'), {fifo='/tmp/GMfifo1'})
+qt.eq(jobserver.parseMakeflags('-j4 --jobserver-auth=-2,-2'), nil)
+
+-- Acquire `n` slots from `js`, recording the order in which they arrive.
+local function acquireAll(js, n, log)
+  for i = 1, n do
+    thread.new(function()
+      js:acquire()
+      table.insert(log, i)
+    end)
+  end
+end
+
+local function testServer()
+  local js = jobserver.server(3)
+  local log = {}
+
+  -- The implicit slot and two tokens are granted; the fourth waits.
+  acquireAll(js, 4, log)
+  thread.sleep(0.05)
+  qt.eq(log, {1, 2, 3})
+
+  -- Returned slots reach the waiter.
+  js:release()
+  js:release()
+  js:release()
+  thread.sleep(0.05)
+  qt.eq(log, {1, 2, 3, 4})
+  js:release()
+
+  local env, files = js:export({MAKEFLAGS='k'}, {[0]=0})
+  qt.eq(env.MAKEFLAGS, 'k -j3 --jobserver-fds=3,4 --jobserver-auth=3,4')
+  qt.eq(files[0], 0)
+  qt.eq(type(files[3]), 'number')
+  qt.eq(files[3], files[4])
+end
+
+local function testFifoClient()
+  local path = os.getenv 'OUTDIR' .. '/jobserver.fifo'
+  os.remove(path)
+  assert(xpfs.mkfifo(path))
+  local pool = assert(xpio.open(path, 'rw'))
+  pool:write('+')
+
+  local js = jobserver.client('-j2 --jobserver-auth=fifo:' .. path)
+  qt.eq(js.makeflags, '-j2 --jobserver-auth=fifo:' .. path)
+
+  local log = {}
+  acquireAll(js, 3, log)
+  thread.sleep(0.05)
+  qt.eq(log, {1, 2})
+
+  -- Another process returns a token.
+  pool:write('+')
+  thread.sleep(0.05)
+  qt.eq(log, {1, 2, 3})
+
+  -- Tokens go back to the pool before the implicit slot is freed.
+  js:release()
+  qt.eq(pool:try_read(8), '+')
+  js:release()
+  js:release()
+  qt.eq(pool:try_read(8), '+')
+  qt.eq(js.free, true)
+
+  pool:close()
+  os.remove(path)
+end
+
+-- Return the file status flags of descriptor `fd`.
+local function fdFlags(fd)
+  for ln in io.lines('/proc/self/fdinfo/' .. fd) do
+    local flags = ln:match('^flags:%s*(%d+)')
+    if flags then
+      return tonumber(flags, 8)
+    end
+  end
+end
+
+local function testPipeClient()
+  if not xpfs.stat('/proc/self/fdinfo', 'k') then
+    return
+  end
+  local r, w = xpio.pipe()
+  r:setsockopt('O_NONBLOCK', false)
+  w:write('+')
+  local flags = fdFlags(r:fileno())
+
+  local js = jobserver.client(('-j2 --jobserver-auth=%d,%d'):format(r:fileno(), w:fileno()))
+  local log = {}
+  acquireAll(js, 3, log)
+  thread.sleep(0.05)
+  qt.eq(log, {1, 2})
+
+  -- The descriptor shared with make is left as it was.
+  qt.eq(fdFlags(r:fileno()), flags)
+
+  js:release()
+  thread.sleep(0.05)
+  qt.eq(log, {1, 2, 3})
+  r:close()
+  w:close()
+end
+
+local function main()
+  testServer()
+  testFifoClient()
+  testPipeClient()
+  qt.eq(jobserver.client('-j4'), nil)
+end
+
+thread.dispatch(main)
@@ -124,7 +124,7 @@ local function program(cfg, ps)
     return err
   end
 
-  local flags = {'-lm', '-ldl'}
+  local flags = {'-lm', '-ldl', '-lpthread'}
   flags = ps.flags and list.append(flags, ps.flags) or flags
 
   return cIO.program(cfg, {
@@ -35,12 +35,56 @@ coroutine.yield = function(...)
 end
 
 local flakeOpts = require 'flakeOpts'
+local daemon    = require 'daemon'
+local thread    = require 'thread'
+
+-- Collect args until the second set of options.
+--    When running as a Lua script, that second set of args is intended
+--    for the target script.
+-- Given:  "-a -b c d -e -f", return "-a -b c d"
+local function collectArgs(xs)
+  local args = {}
+  local gotit = false
+  for _,v in ipairs(xs) do
+    if v:sub(1,1) ~= '-' then
+      gotit = true
+    end
+    if gotit and v:sub(1,1) == '-' then
+      break
+    end
+    table.insert(args, v)
+  end
+  return args
+end
+
+-- If a daemon is running for the workspace, it runs the build.  This comes
+-- before loading flake, which reads the workspace's database.
+do
+  local args = collectArgs(arg)
+  local options = flakeOpts.parseArgs(args, function() end)
+  -- Builds read from stdin, and cache servers, run here.
+  if not (options.daemon or options.noDaemon or options.version or options.e
+          or options[''] or options.serveCache or options.watch) then
+    local code
+    thread.dispatch(function()
+      code = daemon.request(daemon.socketPath(options.directory), args)
+    end)
+    if code then
+      os.exit(code)
+    end
+  end
+end
+
 local flake     = require 'flake'
 local xpfs      = require 'xpfs'
-local thread    = require 'thread'
 local lfsu      = require 'lfsu'
 local lua       = require 'lua'
 local process   = require 'process'
+local cas       = require 'cas'
+local remoteCache = require 'remoteCache'
+local compilerCache = require 'compilerCache'
+local trace     = require 'trace'
+local watch     = require 'watch'
 
 -- Hack to package list.lua with Flake
 -- @require list
@@ -70,6 +114,7 @@ flake.decendThenCall(_G, 'pairs')
 flake.decendThenCall(_G, 'ipairs')
 
 local function fatal(msg)
+  trace.close()
   io.stderr:write('flake: ' .. msg .. '\n')
   os.exit(1)
 end
@@ -82,44 +127,62 @@ local function optsError(msg)
   fatal(msg .. '\n' .. flakeOpts.usage)
 end
 
--- Collect args until the second set of options.
---    When running as a Lua script, that second set of args is intended
---    for the target script.
--- Given:  "-a -b c d -e -f", return "-a -b c d"
-local function collectArgs(xs)
-  local args = {}
-  local gotit = false
-  for _,v in ipairs(xs) do
-    if v:sub(1,1) ~= '-' then
-      gotit = true
-    end
-    if gotit and v:sub(1,1) == '-' then
-      break
-    end
-    table.insert(args, v)
+local function copy(t)
+  local c = {}
+  for k, v in pairs(t) do
+    c[k] = v
   end
-  return args
+  return c
 end
 
-local function main()
-  local args = collectArgs(arg)
-  local options, targetArgs = flakeOpts.parseArgs(args, optsError)
-  table.remove(arg, 1)
+local function build(options, targetArgs)
+  local jobs = options.jobs and math.tointeger(tonumber(options.jobs))
+  if options.jobs and not (jobs and jobs > 0) then
+    optsError("Invalid job count '" .. options.jobs .. "'.")
+  end
 
-  local luaExe = arg[-1] or arg[0]
-  lua.configure {
-    luaExe = xpfs.stat(luaExe) and lfsu.abspath(luaExe) or process.findExecutable(luaExe),
-  }
+  local useCas = options.cas or options.remoteCache or options.serveCache
+  local casRoot = useCas and cas.defaultRoot()
+  if useCas and not casRoot then
+    optsError('--cas requires $XDG_CACHE_HOME or $HOME.')
+  end
 
-  if options.version then
-    print 'flake 0.9.0'
-    os.exit(0)
+  local ccRoot = options.compilerCache and compilerCache.defaultRoot()
+  if options.compilerCache and not ccRoot then
+    optsError('--compiler-cache requires $XDG_CACHE_HOME or $HOME.')
   end
 
+  if options.serveCache then
+    lfsu.mkdir_p(casRoot)
+    local sock, err = remoteCache.listen(options.serveCache, casRoot)
+    if not sock then
+      fatal(err)
+    end
+    if not options.silent then
+      info("Serving '" .. casRoot .. "' at " .. sock:getsockname())
+      io.stdout:flush()
+    end
+    return
+  end
+
+  if options.trace then
+    local ok, err = trace.open(options.trace)
+    if not ok then
+      fatal(err)
+    end
+  end
+
+  -- Options left out are false, not nil, since a daemon runs many builds.
   flake.configure{
     cache = not options.penniless,
-    quiet = options.quiet,
-    silent = options.silent,
+    cas = casRoot or false,
+    remoteCache = options.remoteCache and remoteCache.client(options.remoteCache) or false,
+    compilerCache = ccRoot or false,
+    batchCompiles = options.batchCompiles or false,
+    paranoid = options.paranoid or false,
+    jobs = jobs or false,
+    quiet = options.quiet or false,
+    silent = options.silent or false,
   }
 
   package.path = os.getenv 'LUA_PATH' or './?.lua'
@@ -171,7 +234,7 @@ local function main()
       targetMap = err
     end
   elseif xpfs.stat(options.file) then
-    local targetMapFunc, err = loadfile(options.file)
+    local targetMapFunc, err = flake.loadBuildFile(lfsu.abspath(options.file))
     if targetMapFunc == nil then
       fatal(err)
     end
@@ -241,12 +304,93 @@ local function main()
     flake.clearCache()
   end
 
+  -- Fold journals that have grown large, so that the next load replays
+  -- few records.  Small journals are left for a later build.
+  flake.compactCache(0.5)
+
   if oldDir then
     if not options.silent then
       info("Leaving directory '" .. xpfs.getcwd() .. "'")
     end
     xpfs.chdir(oldDir)
   end
+  trace.close()
+end
+
+local function main()
+  local args = collectArgs(arg)
+  local options, targetArgs = flakeOpts.parseArgs(args, optsError)
+  table.remove(arg, 1)
+
+  local luaExe = arg[-1] or arg[0]
+  lua.configure {
+    luaExe = xpfs.stat(luaExe) and lfsu.abspath(luaExe) or process.findExecutable(luaExe),
+  }
+
+  if options.version then
+    print 'flake 0.9.0'
+    os.exit(0)
+  end
+
+  if options.daemon then
+    local dir = lfsu.abspath(options.directory)
+    local sockPath = daemon.socketPath(dir)
+    lfsu.mkdir_p(sockPath:match('(.*)/'))
+    -- The daemon keeps the build files it has compiled, and watches sources
+    -- so that those unchanged since the last build need not be stat'ed.
+    local w = watch.new()
+    flake.configure{
+      keepBuildFiles = true,
+      unchanged = w and function(p) return w:unchanged(p) end or false,
+    }
+    local sock, err = daemon.listen(sockPath, function(args)
+      build(flakeOpts.parseArgs(args, optsError))
+    end, function()
+      flake.revalidateCache()
+      if w then
+        w:set(flake.takeSourcePaths())
+        w:poll()
+      end
+    end)
+    if not sock then
+      fatal(err)
+    end
+    if not options.silent then
+      info("Daemon serving '" .. dir .. "' at " .. sockPath)
+      io.stdout:flush()
+    end
+    return
+  end
+
+  if options.watch then
+    local w, err = watch.new()
+    if not w then
+      fatal(err)
+    end
+    local file = options.file == 'clean' and 'build.lua' or options.file
+    local buildFile = lfsu.abspath(options.directory .. '/' .. file)
+    while true do
+      -- build() rewrites its arguments, so each pass gets its own copies.
+      local _, err = process.catchExit(build, copy(options), copy(targetArgs))
+      if err ~= nil then
+        io.stderr:write('flake: ' .. tostring(err) .. '\n')
+      end
+      local paths = flake.takeSourcePaths()
+      if xpfs.stat(buildFile, 'k') then
+        paths[buildFile] = true
+      end
+      w:set(paths)
+      if not options.silent then
+        info('Watching for changes...')
+      end
+      io.stdout:flush()
+      io.stderr:flush()
+      w:wait(0.1)
+      flake.configure{unchanged = function(p) return w:unchanged(p) end}
+    end
+  end
+
+  build(options, targetArgs)
 end
 
 thread.dispatch(main)
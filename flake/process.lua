@@ -75,7 +75,31 @@ local function readProcess(args, env, stdinStr)
   return code, stdout, stderr, reason
 end
 
+-- Call `f(...)`, with `os.exit` ending the call instead of the process.
+-- Returns the exit code: 0 if `f` returns, or 1 and the error if it
+-- raises one.
+local function catchExit(f, ...)
+  local exit = os.exit
+  os.exit = function(code)
+    if code == nil or code == true then
+      code = 0
+    elseif code == false then
+      code = 1
+    end
+    error({exitCode = code}, 0)
+  end
+  local ok, err = pcall(f, ...)
+  os.exit = exit
+  if ok then
+    return 0
+  elseif type(err) == 'table' and math.tointeger(err.exitCode) then
+    return err.exitCode
+  end
+  return 1, err
+end
+
 return {
+  catchExit = catchExit,
   findExecutable = findExecutable,
   readProcess = readProcess,
 }
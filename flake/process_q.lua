@@ -4,6 +4,13 @@ local thread  = require 'thread'
 
 local function main()
   qtest.eq(table.pack(process.readProcess{'echo', 'abc'}), {nil, 'abc', '', 'exit', n=4})
+
+  local exit = os.exit
+  qtest.eq(process.catchExit(function(x) qtest.eq(x, 1) end, 1), 0)
+  qtest.eq(process.catchExit(function() os.exit(3) end), 3)
+  qtest.eq(process.catchExit(function() os.exit(false) end), 1)
+  qtest.eq({process.catchExit(function() error('boom', 0) end)}, {1, 'boom'})
+  qtest.eq(os.exit, exit)
 end
 
 thread.dispatch(main)
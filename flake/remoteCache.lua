@@ -0,0 +1,425 @@
+-- Remote cache: an HTTP/1.1 client and server for content-addressed stores
+--
+-- Entries are named by their path relative to a store root, as laid out
+-- by cas.lua (e.g. `objects/ab/abcdef...`).
+--
+--   GET /<path> HTTP/1.1                  200 and the contents, or 404
+--   PUT /<path> HTTP/1.1, with a body     201, or 400
+--
+-- Every message carries a Content-Length, and connections are persistent.
+-- The server rejects objects whose contents do not match their name.
+--
+-- A client sends requests from any number of threads over one connection.
+-- Requests are pipelined: each is written as soon as it is made.  Responses
+-- arrive in request order, and a reader thread hands each one to the
+-- thread that made the request.
+--
+-- A client gives up on a connect after `timeout` seconds, and on a
+-- connection that has sent nothing for `timeout` seconds while responses
+-- are due.  Requests that wait behind a large response are not timed out
+-- while it is arriving.  A timeout or a failed connect marks the server
+-- down for `retryDelay` seconds, during which requests fail at once, so
+-- that a store backed by an unreachable server works as a local-only one.
+--
+-- Bodies larger than `maxBody` bytes are refused by both ends, since a
+-- message is held in memory.
+
+local thread = require 'thread'
+local xpio   = require 'xpio'
+local lfsu   = require 'lfsu'
+local sha1   = require 'sha1'
+
+local readSize = 65536
+
+local defaultTimeout    = 5
+local defaultRetryDelay = 30
+local defaultMaxBody    = 256 * 1024 * 1024
+
+--------------------------------
+-- Message parsing
+--------------------------------
+
+local Reader = {}
+Reader.__index = Reader
+
+-- `lastRead` is the time at which bytes last arrived.
+local function newReader(sock)
+  return setmetatable({sock = sock, buf = '', lastRead = xpio.gettime()}, Reader)
+end
+
+local function fill(me)
+  local s, err = me.sock:read(readSize)
+  if not s then
+    return nil, err or 'connection closed'
+  end
+  me.lastRead = xpio.gettime()
+  me.buf = me.buf .. s
+  return true
+end
+
+-- Read a line ending in CRLF, and return it without the CRLF.
+function Reader:line()
+  while true do
+    local a, b = self.buf:find('\r\n', 1, true)
+    if a then
+      local ln = self.buf:sub(1, a - 1)
+      self.buf = self.buf:sub(b + 1)
+      return ln
+    end
+    local ok, err = fill(self)
+    if not ok then
+      return nil, err
+    end
+  end
+end
+
+-- Read exactly `n` bytes.
+function Reader:bytes(n)
+  local parts, have = {self.buf}, #self.buf
+  while have < n do
+    local s, err = self.sock:read(math.max(n - have, readSize))
+    if not s then
+      return nil, err or 'connection closed'
+    end
+    self.lastRead = xpio.gettime()
+    table.insert(parts, s)
+    have = have + #s
+  end
+  local data = table.concat(parts)
+  self.buf = data:sub(n + 1)
+  return data:sub(1, n)
+end
+
+-- Read a start line, headers, and body of at most `maxBody` bytes.  Returns
+-- the start line, the headers (keyed by lower-case name), and the body, or
+-- nil and an error.
+local function readMessage(r, maxBody)
+  local start, err = r:line()
+  if not start then
+    return nil, err
+  end
+  local headers = {}
+  while true do
+    local ln, err = r:line()
+    if not ln then
+      return nil, err
+    elseif ln == '' then
+      break
+    end
+    local k, v = ln:match('^([^:]+):%s*(.-)%s*$')
+    if k then
+      headers[k:lower()] = v
+    end
+  end
+  local n = math.tointeger(tonumber(headers['content-length'] or '0'))
+  if not n or n < 0 then
+    return nil, 'invalid Content-Length'
+  elseif n > maxBody then
+    return nil, 'message too large'
+  end
+  local body, err = r:bytes(n)
+  if not body then
+    return nil, err
+  end
+  return start, headers, body
+end
+
+-- Names the server will read or write: <kind>/<xx>/<hex digits>
+local function isEntryName(path)
+  return path:match('^%a+/%x%x/%x+$') ~= nil
+end
+
+--------------------------------
+-- Client
+--------------------------------
+
+local Client = {}
+Client.__index = Client
+
+-- Return a client for the server at `addr` ("ip:port").  The connection is
+-- made by the first request.  `opts` may set `timeout`, `retryDelay`, and
+-- `maxBody`.
+local function client(addr, opts)
+  opts = opts or {}
+  return setmetatable({
+    addr = addr,
+    lock = thread.semaphore(1),
+    pending = {},
+    timeout = opts.timeout or defaultTimeout,
+    retryDelay = opts.retryDelay or defaultRetryDelay,
+    maxBody = opts.maxBody or defaultMaxBody,
+    downUntil = 0,
+  }, Client)
+end
+
+-- Call `fn(...)` on another thread and return its results, or nil and
+-- 'timeout' if it has not returned within `timeout` seconds.
+local function callWithTimeout(timeout, fn, ...)
+  local task = thread.new(fn, ...)
+  local timedOut = false
+  local timer = thread.new(function()
+    thread.sleep(timeout)
+    timedOut = true
+    thread.kill(task)
+  end)
+  local results = table.pack(thread.join(task))
+  thread.kill(timer)
+  if timedOut then
+    return nil, 'timeout'
+  end
+  return table.unpack(results, 1, results.n)
+end
+
+local function connect(addr)
+  local sock, err = xpio.socket('TCP')
+  if not sock then
+    return nil, err
+  end
+  -- Close the socket if the connect is abandoned.
+  local exitId = thread.atExit(sock.close, sock)
+  local ok, err = sock:connect(addr)
+  thread.cancelAtExit(exitId)
+  if not ok then
+    sock:close()
+    return nil, err
+  end
+  return sock
+end
+
+-- Stop using the server for a while.
+local function markDown(me)
+  me.downUntil = xpio.gettime() + me.retryDelay
+end
+
+local function isDown(me)
+  return xpio.gettime() < me.downUntil
+end
+
+-- Fail the connection `sock` once nothing has arrived on it for
+-- `me.timeout` seconds.  Runs while responses are due.  While a request is
+-- being written, no response is due for it yet, so the clock waits.
+local function watchConnection(me, sock, r)
+  while true do
+    local idle = xpio.gettime() - r.lastRead
+    if idle >= me.timeout then
+      if r.writing == 0 then
+        markDown(me)
+        sock:shutdown('rw')
+        return
+      end
+      idle = 0
+    end
+    thread.sleep(me.timeout - idle)
+  end
+end
+
+-- Hand responses on `sock` to waiting requests.  On error, the connection
+-- is dropped and every pending request fails; the next request reconnects.
+local function readResponses(me, sock, r)
+  local watcher = thread.new(watchConnection, me, sock, r)
+  while me.pending[1] do
+    local start, headers, body = readMessage(r, me.maxBody)
+    local status = start and tonumber(start:match('^HTTP/1%.%d (%d%d%d)'))
+    if not status then
+      local err = start and 'invalid response' or headers
+      sock:close()
+      me.sock = nil
+      local pending = me.pending
+      me.pending = {}
+      for _, req in ipairs(pending) do
+        req.err = err
+        req.done:release()
+      end
+      break
+    end
+    local req = table.remove(me.pending, 1)
+    req.status, req.body = status, body
+    req.done:release()
+  end
+  thread.kill(watcher)
+  me.reading = false
+end
+
+-- Send a request and wait for its response.  Returns the status code and
+-- body, or nil and an error message.
+function Client:request(method, path, body)
+  body = body or ''
+  local req = {done = thread.semaphore(0)}
+
+  if isDown(self) then
+    return nil, 'server down'
+  end
+  self.lock:acquire()
+  if not self.sock then
+    -- Requests that queued behind a failed connect should not retry it.
+    if isDown(self) then
+      self.lock:release()
+      return nil, 'server down'
+    end
+    local sock, err = callWithTimeout(self.timeout, connect, self.addr)
+    if not sock then
+      markDown(self)
+      self.lock:release()
+      return nil, err
+    end
+    sock:setsockopt('TCP_NODELAY', true)
+    self.sock, self.reader = sock, newReader(sock)
+    self.reader.writing = 0
+  end
+  table.insert(self.pending, req)
+  local r = self.reader
+  local t0 = xpio.gettime()
+  r.writing = r.writing + 1
+  local ok = self.sock:write(method .. ' /' .. path .. ' HTTP/1.1\r\n' ..
+                             'Host: ' .. self.addr .. '\r\n' ..
+                             'Content-Length: ' .. #body .. '\r\n\r\n' .. body)
+  r.writing = r.writing - 1
+  -- Time spent sending a request does not count against the server.
+  r.lastRead = r.lastRead + xpio.gettime() - t0
+  if not ok then
+    -- Let the reader see the error and fail the pending requests.
+    self.sock:shutdown('rw')
+  end
+  if not self.reading then
+    -- The clock for the first response starts now.
+    r.lastRead = xpio.gettime()
+    self.reading = true
+    thread.new(readResponses, self, self.sock, r)
+  end
+  self.lock:release()
+
+  req.done:acquire()
+  if req.err then
+    return nil, isDown(self) and 'timeout' or req.err
+  end
+  return req.status, req.body
+end
+
+-- Close the connection.  Requests must not be outstanding.
+function Client:close()
+  if self.sock then
+    self.sock:close()
+    self.sock = nil
+  end
+end
+
+-- Return the contents of an entry, or nil and an error message.
+function Client:get(path)
+  local status, body = self:request('GET', path)
+  if status == 200 then
+    return body
+  end
+  return nil, status and 'HTTP ' .. status or body
+end
+
+-- Store an entry.  Returns true, or nil and an error message.
+function Client:put(path, data)
+  if #data > self.maxBody then
+    return nil, 'message too large'
+  end
+  local status, body = self:request('PUT', path, data)
+  if status == 200 or status == 201 or status == 204 then
+    return true
+  end
+  return nil, status and 'HTTP ' .. status or body
+end
+
+--------------------------------
+-- Server
+--------------------------------
+
+local reasons = {
+  [200] = 'OK',
+  [201] = 'Created',
+  [400] = 'Bad Request',
+  [404] = 'Not Found',
+  [405] = 'Method Not Allowed',
+  [500] = 'Internal Server Error',
+}
+
+local tmpCount = 0
+
+local function handle(root, method, path, body)
+  if not isEntryName(path) then
+    return 400, ''
+  end
+  local file = root .. '/' .. path
+  if method == 'GET' then
+    local data = lfsu.read(file)
+    if data then
+      return 200, data
+    end
+    return 404, ''
+  elseif method == 'PUT' then
+    if path:match('^objects/') and sha1.digest(body) ~= path:match('[^/]*$') then
+      return 400, ''
+    end
+    lfsu.mkdir_p(file:match('(.*)/'))
+    tmpCount = tmpCount + 1
+    local tmp = file .. '.tmp' .. tmpCount
+    if not (lfsu.write(tmp, body) and os.rename(tmp, file)) then
+      os.remove(tmp)
+      return 500, ''
+    end
+    return 201, ''
+  end
+  return 405, ''
+end
+
+local function serveConnection(conn, root)
+  local r = newReader(conn)
+  while true do
+    local start, _, body = readMessage(r, defaultMaxBody)
+    if not start then
+      break
+    end
+    local method, path = start:match('^(%u+) /(%S*) HTTP/1%.%d$')
+    local status, data = 400, ''
+    if method then
+      status, data = handle(root, method, path, body)
+    end
+    local ok = conn:write('HTTP/1.1 ' .. status .. ' ' .. reasons[status] .. '\r\n' ..
+                          'Content-Length: ' .. #data .. '\r\n\r\n' .. data)
+    if not ok then
+      break
+    end
+  end
+  conn:close()
+end
+
+-- Serve the store at `root` to connections accepted on the listening
+-- socket `sock`.  Returns only on error.
+local function serve(sock, root)
+  while true do
+    local conn, err = sock:accept()
+    if not conn then
+      return nil, err
+    end
+    thread.new(serveConnection, conn, root)
+  end
+end
+
+-- Listen at `addr` and serve the store at `root`.  Returns the listening
+-- socket and the server thread, or nil and an error message.
+local function listen(addr, root)
+  local sock, err = xpio.socket('TCP')
+  if not sock then
+    return nil, err
+  end
+  sock:setsockopt('SO_REUSEADDR', true)
+  local ok, err = sock:bind(addr)
+  if ok then
+    ok, err = sock:listen()
+  end
+  if not ok then
+    sock:close()
+    return nil, err
+  end
+  return sock, thread.new(serve, sock, root)
+end
+
+return {
+  client = client,
+  listen = listen,
+  serve  = serve,
+}
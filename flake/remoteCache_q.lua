@@ -0,0 +1,184 @@
+local remoteCache = require 'remoteCache'
+local cas         = require 'cas'
+local thread      = require 'thread'
+local lfsu        = require 'lfsu'
+local sha1        = require 'sha1'
+local xpio        = require 'xpio'
+local qt          = require 'qtest'
+
+local outdir = lfsu.abspath(assert(os.getenv 'OUTDIR', 'OUTDIR not set'))
+
+local function testProtocol(addr)
+  local c = remoteCache.client(addr)
+  local name = 'objects/' .. sha1.digest('abc'):sub(1, 2) .. '/' .. sha1.digest('abc')
+
+  qt.eq({c:get(name)}, {nil, 'HTTP 404'})
+  qt.eq({c:put(name, 'abd')}, {nil, 'HTTP 400'})
+  qt.eq({c:get('../x')}, {nil, 'HTTP 400'})
+  qt.eq(c:put(name, 'abc'), true)
+  qt.eq(c:get(name), 'abc')
+
+  -- Requests from many threads share the connection.
+  local big = string.rep('x', 300000)
+  local bigName = 'objects/' .. sha1.digest(big):sub(1, 2) .. '/' .. sha1.digest(big)
+  qt.eq(c:put(bigName, big), true)
+  local results, tasks = {}, {}
+  for i = 1, 10 do
+    tasks[i] = thread.new(function()
+      results[i] = c:get(i % 2 == 0 and name or bigName)
+    end)
+  end
+  for _, t in ipairs(tasks) do
+    thread.join(t)
+  end
+  for i = 1, 10 do
+    qt.eq(results[i] == (i % 2 == 0 and 'abc' or big), true)
+  end
+
+  -- The next request reconnects.
+  c:close()
+  qt.eq(c:get(name), 'abc')
+  c:close()
+
+  -- Bodies over the limit are refused.
+  local small = remoteCache.client(addr, {maxBody = 1000})
+  qt.eq({small:put(bigName, big)}, {nil, 'message too large'})
+  qt.eq({small:get(bigName)}, {nil, 'message too large'})
+  qt.eq(small:get(name), 'abc')
+  small:close()
+end
+
+local function testSlowResponse()
+  local name = 'objects/' .. sha1.digest('abc'):sub(1, 2) .. '/' .. sha1.digest('abc')
+
+  -- A server that sends a large response over three timeouts, then
+  -- answers the requests pipelined behind it.
+  local sock = xpio.socket('TCP')
+  qt.eq(sock:bind('127.0.0.1:0'), true)
+  qt.eq(sock:listen(), true)
+  local chunk = string.rep('x', 4096)
+  local server = thread.new(function()
+    local conn = sock:accept()
+    local buf = ''
+    while select(2, buf:gsub('\r\n\r\n', '')) < 3 do
+      buf = buf .. conn:read(4096)
+    end
+    conn:write('HTTP/1.1 200 OK\r\nContent-Length: ' .. 20 * #chunk .. '\r\n\r\n')
+    for _ = 1, 20 do
+      thread.sleep(0.015)
+      conn:write(chunk)
+    end
+    conn:write(string.rep('HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n', 2))
+    conn:read(1)
+    conn:close()
+  end)
+
+  -- Requests waiting behind it are not timed out while it arrives.
+  local c = remoteCache.client(sock:getsockname(), {timeout = 0.1, retryDelay = 0.2})
+  local results, tasks = {}, {}
+  for i = 1, 3 do
+    tasks[i] = thread.new(function()
+      results[i] = {c:get(name)}
+    end)
+  end
+  for _, t in ipairs(tasks) do
+    thread.join(t)
+  end
+  qt.eq(results[1][1] == string.rep(chunk, 20), true)
+  qt.eq(results[2], {nil, 'HTTP 404'})
+  qt.eq(results[3], {nil, 'HTTP 404'})
+  c:close()
+  thread.join(server)
+  sock:close()
+end
+
+local function testCas(addr, serverRoot)
+  local c = remoteCache.client(addr)
+  local dir = outdir .. '/remoteTree'
+  lfsu.rm_rf(dir)
+  lfsu.mkdir_p(dir .. '/bd/1')
+  lfsu.write(dir .. '/bd/1/a.o', 'object a')
+  lfsu.write(dir .. '/bd/1/b.o', 'object b')
+
+  -- A result stored in one store is uploaded...
+  local k = cas.key('cc/abc', {['a.c'] = 'aaaa'})
+  local a = outdir .. '/remoteA'
+  lfsu.rm_rf(a)
+  qt.eq(cas.put(a, k, dir, {'bd/1/a.o', 'bd/1/b.o'}, 'bd/1', {}, c), true)
+  local manifest = serverRoot .. '/manifests/' .. k:sub(1, 2) .. '/' .. k
+  for _ = 1, 100 do
+    if lfsu.read(manifest) then
+      break
+    end
+    thread.sleep(0.01)
+  end
+
+  -- ...and restored through another.
+  local b = outdir .. '/remoteB'
+  lfsu.rm_rf(b)
+  lfsu.rm_rf(dir .. '/bd')
+  qt.eq({cas.get(b, k, dir, 'bd/2', c)}, {true, {'bd/2/a.o', 'bd/2/b.o'}, {}})
+  qt.eq(lfsu.read(dir .. '/bd/2/b.o'), 'object b')
+  qt.eq(cas.get(b, cas.key('cc/def', {}), dir, 'bd/2', c), nil)
+  c:close()
+end
+
+local function testUnavailable()
+  local name = 'objects/' .. sha1.digest('abc'):sub(1, 2) .. '/' .. sha1.digest('abc')
+
+  -- A server that accepts connections but never responds.
+  local sock = xpio.socket('TCP')
+  qt.eq(sock:bind('127.0.0.1:0'), true)
+  qt.eq(sock:listen(), true)
+  local c = remoteCache.client(sock:getsockname(), {timeout = 0.1, retryDelay = 0.2})
+  local t0 = xpio.gettime()
+  local results, tasks = {}, {}
+  for i = 1, 3 do
+    tasks[i] = thread.new(function()
+      results[i] = {c:get(name)}
+    end)
+  end
+  for _, t in ipairs(tasks) do
+    thread.join(t)
+  end
+  for i = 1, 3 do
+    qt.eq(results[i], {nil, 'timeout'})
+  end
+  qt.eq(xpio.gettime() - t0 < 1, true)
+
+  -- While it is down, requests fail at once and the store works locally.
+  qt.eq({c:get(name)}, {nil, 'server down'})
+  local root = outdir .. '/remoteDown'
+  lfsu.rm_rf(root)
+  qt.eq(cas.get(root, cas.key('cc/abc', {}), outdir, 'bd', c), nil)
+  c:close()
+
+  -- A refused connect marks it down too, until the retry delay passes.
+  local addr = sock:getsockname()
+  sock:close()
+  c = remoteCache.client(addr, {timeout = 0.1, retryDelay = 0.2})
+  local _, err = c:get(name)
+  qt.eq(err ~= 'server down', true)
+  qt.eq({c:get(name)}, {nil, 'server down'})
+  thread.sleep(0.3)
+  _, err = c:get(name)
+  qt.eq(err ~= 'server down', true)
+end
+
+local function main()
+  local root = outdir .. '/remoteServer'
+  lfsu.rm_rf(root)
+  lfsu.mkdir_p(root)
+  local sock, server = assert(remoteCache.listen('127.0.0.1:0', root))
+  local addr = sock:getsockname()
+
+  testProtocol(addr)
+  testCas(addr, root)
+  testUnavailable()
+  testSlowResponse()
+
+  thread.kill(server)
+  sock:close()
+end
+
+thread.dispatch(main)
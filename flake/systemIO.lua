@@ -4,6 +4,7 @@ local thread = require 'thread'
 local xpio   = require 'xpio'
 local lfsu   = require 'lfsu'
 local list   = require 'list'
+local trace  = require 'trace'
 
 local concat = table.concat
 
@@ -37,11 +38,51 @@ local function execute(cfg, ps)
 
   assert(type(ps.args) == 'table', tostring(ps.args))
 
-  local proc = assert(xpio.spawn(ps.args, ps.env or {}, {[0]=r0, [1]=w1, [2]=w2}))
-  local t1 = thread.new(readFrom, r1, stdoutLines)
-  local t2 = thread.new(readFrom, r2, stderrLines)
+  -- Wait for a job slot, so that at most cfg.jobs commands run at once.
+  -- The slot is given back however this task leaves: when the command
+  -- finishes, when spawn or wait raises an error, or when the task is
+  -- killed.
+  local jobs = cfg and cfg.jobs
+  local proc, exitId
+  local function releaseSlot()
+    if proc then
+      proc:kill()
+    end
+    jobs:release()
+  end
+  if jobs then
+    local t0 = xpio.gettime()
+    jobs:acquire()
+    cfg.slotWait = (cfg.slotWait or 0) + xpio.gettime() - t0
+    exitId = thread.atExit(releaseSlot)
+  end
 
-  local reason, code = proc:wait()
+  local span, t1, t2
+  local ok, reason, code = pcall(function()
+    local env, files = ps.env or {}, {[0]=r0, [1]=w1, [2]=w2}
+    if jobs and jobs.export then
+      env, files = jobs:export(env, files)
+    end
+    span = trace.begin(ps.args[1]:match('[^/]*$'), 'process',
+                       {command = table.concat(ps.args, ' ')}, cfg and cfg.trace)
+    local err
+    proc, err = xpio.spawn(ps.args, env, files, {cwd = ps.dir})
+    if not proc then
+      span:finish{error = err}
+      error(err, 0)
+    end
+    t1 = thread.new(readFrom, r1, stdoutLines)
+    t2 = thread.new(readFrom, r2, stderrLines)
+    return proc:wait()
+  end)
+  if jobs then
+    thread.cancelAtExit(exitId)
+    jobs:release()
+  end
+  if not ok then
+    error(reason, 0)
+  end
+  span:finish{exit = code, reason = reason}
 
   local stdout = cfg and cfg.io and cfg.io[1] or io.stdout
   local stderr = cfg and cfg.io and cfg.io[2] or io.stderr
@@ -61,7 +102,8 @@ local function execute(cfg, ps)
         envStr = concat(list.map(ks, mkEnvArg), ' ') .. ' '
       end
     end
-    stdout:write('$ ' .. envStr .. concat(ps.args, ' ') .. '\n')
+    local cdStr = ps.dir and 'cd ' .. xpexec.quoteArg(ps.dir) .. ' && ' or ''
+    stdout:write('$ ' .. cdStr .. envStr .. concat(ps.args, ' ') .. '\n')
   end
 
   thread.join(t1)
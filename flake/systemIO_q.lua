@@ -2,6 +2,7 @@ local systemIO = require 'systemIO'
 local flake    = require 'flake'
 local list     = require 'list'
 local lfsu     = require 'lfsu'
+local thread   = require 'thread'
 
 lfsu.mkdir_p('tmp')
 lfsu.write('tmp/a.c', 'foo\n')
@@ -32,4 +33,23 @@ assertInputs({a='tmp/a.c', b='tmp/b.c'} , {'tmp/a.c', 'tmp/b.c'})  -- Multiple f
 
 lfsu.rm_rf('tmp')
 
+--
+-- execute() gives its job slot back
+--
+thread.dispatch(function()
+  local cfg = {quiet = true, io = {{write = function() end}, {write = function() end}},
+               jobs = thread.semaphore(1)}
+
+  -- when the command cannot be spawned
+  assert(not pcall(systemIO.execute, cfg, {'/nonexistent/cmd'}))
+  assert(cfg.jobs.count == 1)
+
+  -- when its task is killed
+  local t = thread.new(systemIO.execute, cfg, {'sleep', '10'})
+  thread.sleep(0.05)
+  thread.kill(t)
+  assert(cfg.jobs.count == 1)
+  assert(systemIO.execute(cfg, {'true'}) == nil)
+end)
+
 print 'passed!'
@@ -0,0 +1,159 @@
+-- Build tracing in Chrome's trace event format
+--
+-- trace.open(path) starts writing a trace that chrome://tracing and
+-- Perfetto can display.  Until then, trace.begin returns a span that
+-- records nothing.
+--
+-- Each span is drawn on a track.  A span started with a parent is drawn on
+-- its parent's track, nested inside it.  Other spans take the lowest
+-- numbered track that is free, so there are as many tracks as there were
+-- spans running at once.
+--
+-- Events are written as they finish, in the JSON array form of the
+-- format, which does not require the closing bracket.  A build that exits
+-- early leaves a readable trace.
+
+local xpio = require 'xpio'
+
+local file        -- output file, when tracing
+local t0          -- time at which the trace started
+local busy = {}   -- track number -> true while a root span uses it
+local named = {}  -- track number -> true once its name has been written
+local first = true
+
+local escapes = {
+  ['"'] = '\\"', ['\\'] = '\\\\', ['\b'] = '\\b', ['\f'] = '\\f',
+  ['\n'] = '\\n', ['\r'] = '\\r', ['\t'] = '\\t',
+}
+
+local function jsonString(s)
+  return '"' .. s:gsub('[%c"\\]', function(c)
+    return escapes[c] or ('\\u%04x'):format(c:byte())
+  end) .. '"'
+end
+
+-- Encode a value as JSON.  Tables are encoded as objects.
+local function json(v)
+  local ty = type(v)
+  if ty == 'number' then
+    return v == v and v ~= math.huge and v ~= -math.huge and tostring(v) or 'null'
+  elseif ty == 'boolean' then
+    return tostring(v)
+  elseif ty == 'table' then
+    local keys = {}
+    for k in pairs(v) do
+      table.insert(keys, tostring(k))
+    end
+    table.sort(keys)
+    local fields = {}
+    for _, k in ipairs(keys) do
+      local x = v[k]
+      if x == nil then
+        x = v[tonumber(k)]
+      end
+      table.insert(fields, jsonString(k) .. ':' .. json(x))
+    end
+    return '{' .. table.concat(fields, ',') .. '}'
+  elseif v == nil then
+    return 'null'
+  end
+  return jsonString(tostring(v))
+end
+
+local function emit(event)
+  file:write(first and '[\n' or ',\n', json(event))
+  first = false
+end
+
+local function micros(t)
+  return math.floor((t - t0) * 1e6 + 0.5)
+end
+
+local Span = {}
+Span.__index = Span
+
+-- A span that records nothing.
+local noSpan = setmetatable({}, Span)
+
+-- Start a span.  `cat` is its category, `args` a table of values shown
+-- with it, and `parent` the span it is nested in.
+local function begin(name, cat, args, parent)
+  if not file then
+    return noSpan
+  end
+  local track
+  if parent and parent.track then
+    track = parent.track
+  else
+    track = 1
+    while busy[track] do
+      track = track + 1
+    end
+    busy[track] = true
+    if not named[track] then
+      named[track] = true
+      emit{name = 'thread_name', ph = 'M', pid = 1, tid = track, args = {name = 'task ' .. track}}
+    end
+  end
+  return setmetatable({
+    name   = name,
+    cat    = cat,
+    args   = args or {},
+    track  = track,
+    root   = not (parent and parent.track),
+    start  = xpio.gettime(),
+  }, Span)
+end
+
+-- Finish a span, adding the values in `args` to it.
+function Span:finish(args)
+  if not self.track or self.done then
+    return
+  end
+  self.done = true
+  for k, v in pairs(args or {}) do
+    self.args[k] = v
+  end
+  local ts = micros(self.start)
+  emit{
+    name = self.name,
+    cat  = self.cat,
+    ph   = 'X',
+    ts   = ts,
+    dur  = micros(xpio.gettime()) - ts,
+    pid  = 1,
+    tid  = self.track,
+    args = self.args,
+  }
+  if self.root then
+    busy[self.track] = nil
+  end
+end
+
+-- Start writing a trace to `path`.  Returns true, or nil and an error.
+local function open(path)
+  local f, err = io.open(path, 'w')
+  if not f then
+    return nil, err
+  end
+  file, t0, first = f, xpio.gettime(), true
+  busy, named = {}, {}
+  emit{name = 'process_name', ph = 'M', pid = 1, tid = 0, args = {name = 'flake'}}
+  return true
+end
+
+-- Finish the trace.
+local function close()
+  if file then
+    file:write(first and '[]\n' or '\n]\n')
+    file:close()
+    file = nil
+  end
+end
+
+return {
+  begin = begin,
+  close = close,
+  json  = json,
+  open  = open,
+}
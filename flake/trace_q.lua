@@ -0,0 +1,43 @@
+local trace = require 'trace'
+local lfsu  = require 'lfsu'
+local qt    = require 'qtest'
+
+local outdir = lfsu.abspath(assert(os.getenv 'OUTDIR', 'OUTDIR not set'))
+local file = outdir .. '/trace.json'
+
+qt.eq(trace.json{b = 1, a = 'x"\n', c = {true}}, '{"a":"x\\"\\n","b":1,"c":{"1":true}}')
+
+-- Spans record nothing until a trace is opened.
+trace.begin('nothing', 'test'):finish()
+
+qt.eq(trace.open(file), true)
+
+-- Spans running at once take their own tracks; children share their
+-- parent's.  Finished tracks are reused.
+local a = trace.begin('a', 'builder', {key = 'a/1'})
+local b = trace.begin('b', 'builder')
+local child = trace.begin('cc', 'process', nil, b)
+child:finish{exit = 0}
+b:finish{cache = 'miss'}
+local c = trace.begin('c', 'builder')
+c:finish()
+a:finish{cache = 'hit'}
+trace.close()
+
+local text = lfsu.read(file)
+qt.eq(text:sub(1, 2), '[\n')
+qt.eq(text:sub(-3), '\n]\n')
+local function event(name)
+  for ln in text:gmatch('[^\n]+') do
+    if ln:match('"name":"' .. name .. '"') then
+      return ln
+    end
+  end
+end
+qt.eq(event('nothing'), nil)
+qt.eq(event('a'):match('"tid":(%d+)'), '1')
+qt.eq(event('b'):match('"tid":(%d+)'), '2')
+qt.eq(event('cc'):match('"tid":(%d+)'), '2')
+qt.eq(event('c'):match('"tid":(%d+)'), '2')
+qt.eq(event('a'):match('"args":(%b{})'), '{"cache":"hit","key":"a/1"}')
+qt.eq(event('cc'):match('"ph":"(%a)"'), 'X')
@@ -0,0 +1,133 @@
+-- Watch source files for changes between builds
+--
+-- A watcher holds an inotify watch on the directory of each file it
+-- watches, so that a file replaced by a rename (as editors do) is still
+-- seen.  `w:wait()` returns once files have changed and no more changes
+-- have arrived for a short while.
+--
+-- After a wait or a poll, `w:unchanged(p)` is true for a file known not to have
+-- changed since the start of the previous build: one that was watched
+-- through that build and has had no event since.  Flake skips stat'ing
+-- such files.
+
+local xpio   = require 'xpio'
+local thread = require 'thread'
+
+local Watcher = {}
+Watcher.__index = Watcher
+
+-- Return a new watcher, or nil and an error message.
+local function new()
+  local sock, err = xpio.inotify()
+  if not sock then
+    return nil, err
+  end
+  return setmetatable({
+    sock    = sock,
+    paths   = {},   -- watched file -> true
+    trusted = {},   -- files watched through the previous build
+    dirs    = {},   -- directory -> watch descriptor
+    wds     = {},   -- watch descriptor -> directory
+    changed = {},   -- files changed since the last wait
+  }, Watcher)
+end
+
+local function takeDirectory(p)
+  return p:match('(.*)/') or '.'
+end
+
+-- Watch the files in the set `paths` (absolute paths), and no others.
+function Watcher:set(paths)
+  local trusted, dirs = {}, {}
+  for p in pairs(paths) do
+    trusted[p] = self.paths[p] and not self.overflow and not self.changed[p] or nil
+    dirs[takeDirectory(p)] = true
+  end
+  for dir in pairs(dirs) do
+    if not self.dirs[dir] then
+      local wd = self.sock:addwatch(dir)
+      if wd then
+        self.dirs[dir], self.wds[wd] = wd, dir
+      end
+    end
+  end
+  for dir, wd in pairs(self.dirs) do
+    if not dirs[dir] then
+      self.sock:rmwatch(wd)
+      self.dirs[dir], self.wds[wd] = nil, nil
+    end
+  end
+  self.paths, self.trusted = paths, trusted
+  self.changed, self.overflow = {}, false
+end
+
+-- Read pending events, or wait for them if `block`.  Returns true if a
+-- watched file changed.
+local function readEvents(me, block)
+  local events = {}
+  if block then
+    events = me.sock:readwatch()
+    if not events then
+      -- Without events, nothing is known to be unchanged.
+      me.overflow = true
+      return true
+    end
+  else
+    repeat
+      local more = me.sock:try_readwatch()
+      for _, e in ipairs(more or {}) do
+        table.insert(events, e)
+      end
+    until not more
+  end
+  local any = false
+  for _, e in ipairs(events) do
+    local dir = me.wds[e.wd]
+    if e.overflow then
+      me.overflow, any = true, true
+    elseif dir and e.self then
+      -- The directory went away.  Every file in it may have changed.
+      for p in pairs(me.paths) do
+        if takeDirectory(p) == dir then
+          me.changed[p], any = true, true
+        end
+      end
+      me.dirs[dir], me.wds[e.wd] = nil, nil
+    elseif dir and me.paths[dir .. '/' .. e.name] then
+      me.changed[dir .. '/' .. e.name], any = true, true
+    end
+  end
+  return any
+end
+
+-- Wait until a watched file changes, and then until no file has changed
+-- for `quiet` seconds.  Returns the set of changed files.
+function Watcher:wait(quiet)
+  while not readEvents(self, true) do
+  end
+  repeat
+    thread.sleep(quiet)
+  until not readEvents(self, false)
+  return self.changed
+end
+
+-- Read the events that have arrived, without waiting.  Returns the set of
+-- changed files.  A daemon polls before each build instead of waiting.
+function Watcher:poll()
+  readEvents(self, false)
+  return self.changed
+end
+
+-- True if the file at `p` is known not to have changed since the start of
+-- the previous build.
+function Watcher:unchanged(p)
+  return self.trusted[p] and not self.overflow and not self.changed[p] or false
+end
+
+function Watcher:close()
+  self.sock:close()
+end
+
+return {
+  new = new,
+}
@@ -0,0 +1,57 @@
+local watch  = require 'watch'
+local thread = require 'thread'
+local lfsu   = require 'lfsu'
+local qt     = require 'qtest'
+
+local outdir = lfsu.abspath(assert(os.getenv 'OUTDIR', 'OUTDIR not set'))
+local dir = outdir .. '/watch'
+lfsu.rm_rf(dir)
+lfsu.mkdir_p(dir)
+local a, b, c = dir .. '/a.c', dir .. '/b.c', dir .. '/c.c'
+lfsu.write(a, 'a')
+lfsu.write(b, 'b')
+lfsu.write(c, 'c')
+
+local function main()
+  local w, err = watch.new()
+  if not w then
+    qt.eq(err, 'xpio: inotify is not supported')
+    return
+  end
+
+  -- Files are trusted only once watched through a build.
+  w:set{[a] = true, [b] = true}
+  qt.eq(w:unchanged(a), false)
+
+  -- A burst of changes is reported once.  Changes to other files in the
+  -- directory are ignored.
+  thread.new(function()
+    lfsu.write(c, 'cc')
+    thread.sleep(0.01)
+    lfsu.write(a, 'aa')
+    thread.sleep(0.01)
+    lfsu.write(a, 'aaa')
+  end)
+  qt.eq(w:wait(0.05), {[a] = true})
+
+  -- Next build...
+  w:set{[a] = true, [b] = true}
+  thread.new(function()
+    -- A file replaced by a rename is seen.
+    lfsu.write(dir .. '/b.tmp', 'bb')
+    os.rename(dir .. '/b.tmp', b)
+  end)
+  qt.eq(w:wait(0.05), {[b] = true})
+  qt.eq(w:unchanged(a), false)  -- changed before the build
+  qt.eq(w:unchanged(b), false)
+  qt.eq(w:unchanged(c), false)  -- not watched
+
+  w:set{[a] = true, [b] = true}
+  thread.new(function() lfsu.write(b, 'bbb') end)
+  w:wait(0.05)
+  qt.eq(w:unchanged(a), true)
+  qt.eq(w:unchanged(b), false)
+  w:close()
+end
+
+thread.dispatch(main)
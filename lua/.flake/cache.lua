@@ -0,0 +1 @@
+return {builders={["cIO.library"]={lastIndex=1},["cIO.object"]={lastIndex=33},["cIO.program"]={lastIndex=1},["systemIO.directory"]={lastIndex=1},["systemIO.find"]={lastIndex=1}},durations={["systemIO.find/97acb057bd03e5957badb63f5c48be4cdd53e5d4"]=0.00013899803161621},results={["cIO.library/68b2395d3a82553da427d0e0831ab9c02c801973"]={buildName="cIO.library/1",sources={[".flake/cIO.object/1/lapi.o"]="adf4d64f3fa661ce494ecc26657bad4ba166c480",[".flake/cIO.object/10/ldo.o"]="d57617f34c05e236dbcd84fc88a8cbb1aa2cc1c8",[".flake/cIO.object/11/ldump.o"]="1f832684dba7e68af2e8106c39087c67a79ecd90",[".flake/cIO.object/12/lfunc.o"]="332553236de5fdcaa9836eb680229ea4712e889b",[".flake/cIO.object/13/lgc.o"]="88135662ffbab06f74432a272c92f79963de769d",[".flake/cIO.object/14/linit.o"]="76fab17f0031f33ae6e8a030d7f17b7b0ea16fa8",[".flake/cIO.object/15/liolib.o"]="449df9cd5ee848efcf09c8967c8935e771f09e6d",[".flake/cIO.object/16/llex.o"]="1d752d96def16a97c347492e8df85657fa66b967",[".flake/cIO.object/17/lmathlib.o"]="3e30fc5257f3d57c446b6a752f5cdc6ac2382c16",[".flake/cIO.object/18/lmem.o"]="60690ab699611da678c0e6feb56a54a72c251765",[".flake/cIO.object/19/loadlib.o"]="767a5b58f4e9ce40f6cd0b934c4914f11adfd4ac",[".flake/cIO.object/2/lauxlib.o"]="c883cf26d7a1a8907a6619112f924a7e49119493",[".flake/cIO.object/20/lobject.o"]="28930558da83162c5bdde95b11d179148e4b4d12",[".flake/cIO.object/21/lopcodes.o"]="4bc897c4f4cdf2928acbb5900406375599360e13",[".flake/cIO.object/22/loslib.o"]="11d974a482d24af6abebc486e09b9cc2cd78e32d",[".flake/cIO.object/23/lparser.o"]="dde16ed843f737358605c979048387b59f7edd09",[".flake/cIO.object/24/lstate.o"]="ac998e66a82aaf7ff6b1dd9efbe3c157df62d260",[".flake/cIO.object/25/lstring.o"]="a83cc3c67638dbaf4283c6ad0e7991dd2d875b5d",[".flake/cIO.object/26/lstrlib.o"]="5dd3a63b5c623099c151c5091184ff73ebc67d84",[".flake/cIO.object/27/ltable.o"]="03122d3271aea1adf861155515f521d793fec1c6",[".flake/cIO.object/28/ltablib.o"]="f71b591fd49a18ef382641d078a439680d32fd13",[".flake/cIO.object/29/ltm.o"]="70c446a4d6df540752dcae7c07e81ddf6ecf1e24",[".flake/cIO.object/3/lbaselib.o"]="bc2804650fe755d414d2dd35b6963b3a5da482bb",[".flake/cIO.object/30/lundump.o"]="dd437dd790e683bcdd8373b86f33b81120461398",[".flake/cIO.object/31/lutf8lib.o"]="f06f2fe3fe51655c925ba2cc933e94b2f4332c72",[".flake/cIO.object/32/lvm.o"]="4c53fbcc726c12ae08d1255fc8328000ea703b06",[".flake/cIO.object/33/lzio.o"]="4bb710c2bd7870dd2ae47f84ee645818965060a4",[".flake/cIO.object/4/lbitlib.o"]="f660f84e0066a1c81e1441f24eee351d56f7bece",[".flake/cIO.object/5/lcode.o"]="74ff2c3f5df919284d5d61bbb0cd7c0b9f1fb297",[".flake/cIO.object/6/lcorolib.o"]="8f9e8a6b95d8333575a083a6f30f7368c1766515",[".flake/cIO.object/7/lctype.o"]="019c917d0d84b5739a5546ef8404e48202c52591",[".flake/cIO.object/8/ldblib.o"]="6ec7bdf27f0fe3a59d40f143d74ba876cdf77de1",[".flake/cIO.object/9/ldebug.o"]="244df59ee988235b2daf2f951ada1c4db2d00568"},valid=true,value="out/release/lib/liblua.lib"},["cIO.object/03eae984b973d491ffcbee793f8d82a12e4f5449"]={buildName="cIO.object/18",sources={["lua-5.3.1/src/lmem.c"]="f6f098998085fbfd637e80fc8571d236d93a51c9"},valid=true,value=".flake/cIO.object/18/lmem.o"},["cIO.object/07927e58f99d364406b39411975734f095cc4c96"]={buildName="cIO.object/26",sources={["lua-5.3.1/src/lstrlib.c"]="9f800f9a18f329572ca0efe26aeb3dde7d06ecf8"},valid=true,value=".flake/cIO.object/26/lstrlib.o"},["cIO.object/0e72f259d2a817c77da610378b3f10b29087c1db"]={buildName="cIO.object/32",sources={["lua-5.3.1/src/lvm.c"]="3f221b3ffc982dac80aeea7766a56de4b95facd4"},valid=true,value=".flake/cIO.object/32/lvm.o"},["cIO.object/1eb2b582c1950d0b650d6e680cfdb7ff93c7adc6"]={buildName="cIO.object/7",sources={["lua-5.3.1/src/lctype.c"]="4ffef420308d1b432701d2f4b57bc1cedd2db575"},valid=true,value=".flake/cIO.object/7/lctype.o"},["cIO.object/3e0a567bdf7406fa9880f6d18bdd0279460d2524"]={buildName="cIO.object/13",sources={["lua-5.3.1/src/lgc.c"]="6d6564370abcb3d3e26f45463e0024d033ea8c3a"},valid=true,value=".flake/cIO.object/13/lgc.o"},["cIO.object/3fa07f524b84eae716636168835f4e39ba2da871"]={buildName="cIO.object/28",sources={["lua-5.3.1/src/ltablib.c"]="e23b5de7ee94498b509f3ce76bef6c4eef0a315e"},valid=true,value=".flake/cIO.object/28/ltablib.o"},["cIO.object/43fbc3926011f0fbbb1022e7a5b1f68d87eb7db5"]={buildName="cIO.object/10",sources={["lua-5.3.1/src/ldo.c"]="9a5cfc32740900b3cb6450acaff9118d1fbaf880"},valid=true,value=".flake/cIO.object/10/ldo.o"},["cIO.object/4bbac976ce835d8617913babf78ec52ae3855cbd"]={buildName="cIO.object/14",sources={["lua-5.3.1/src/linit.c"]="5608487cf2f6c4660b5cc5753bfec1e6e8ac1eeb"},valid=true,value=".flake/cIO.object/14/linit.o"},["cIO.object/55f63f5f49f5d1943635c31d26f27bf22d320707"]={buildName="cIO.object/3",sources={["lua-5.3.1/src/lbaselib.c"]="01207829e804d4fe273b4dfc1b3879570c2f524e"},valid=true,value=".flake/cIO.object/3/lbaselib.o"},["cIO.object/573a08e92b49cbcd849b8b94e2fa6aa829c82a9f"]={buildName="cIO.object/29",sources={["lua-5.3.1/src/ltm.c"]="8bec4c3e3a85f27b0e9339d0b2a9c3d65da240ba"},valid=true,value=".flake/cIO.object/29/ltm.o"},["cIO.object/59755994fb256d16741b38b2b42b141bffdbf6fa"]={buildName="cIO.object/17",sources={["lua-5.3.1/src/lmathlib.c"]="fafbcdb097f612fb6b172ef951c5bfceb4eec9ad"},valid=true,value=".flake/cIO.object/17/lmathlib.o"},["cIO.object/59dba8a93d2899020fa3c9950854de51144b97f3"]={buildName="cIO.object/27",sources={["lua-5.3.1/src/ltable.c"]="6b828e8bdd1d1ad40d18c7198f4fad4b4716b72f"},valid=true,value=".flake/cIO.object/27/ltable.o"},["cIO.object/5d233bd6e9fbaef0aac629f3af25ed378a3886a9"]={buildName="cIO.object/5",sources={["lua-5.3.1/src/lcode.c"]="1b3038bb88dfa60c7e0f1aef04ce2c8bd1c72c23"},valid=true,value=".flake/cIO.object/5/lcode.o"},["cIO.object/69633fcf49f0db3164b90531ac245d9a404548bf"]={buildName="cIO.object/23",sources={["lua-5.3.1/src/lparser.c"]="7a861bf1bade9837699d0b4b8448af009f51a811"},valid=true,value=".flake/cIO.object/23/lparser.o"},["cIO.object/6ba66aa77f4e5ec0f926c857b3ca4d1b436464a5"]={buildName="cIO.object/6",sources={["lua-5.3.1/src/lcorolib.c"]="bfb30406a736cdc65bcfe1452c935bc49196163a"},valid=true,value=".flake/cIO.object/6/lcorolib.o"},["cIO.object/6d97b3c6a12db66070320a5514f52be4b7740ac8"]={buildName="cIO.object/24",sources={["lua-5.3.1/src/lstate.c"]="ed5ade78f87b826fe1bb24cf2995546c56b6cf83"},valid=true,value=".flake/cIO.object/24/lstate.o"},["cIO.object/81b31857d4d571cede5f3a07e3be3d9d3d87d0a6"]={buildName="cIO.object/22",sources={["lua-5.3.1/src/loslib.c"]="7c91dbea6c04c624c04bb739bda6230f7c2cfda6"},valid=true,value=".flake/cIO.object/22/loslib.o"},["cIO.object/845059134aaa0879fafe028ab3bd5d140d15a7ec"]={buildName="cIO.object/15",sources={["lua-5.3.1/src/liolib.c"]="598ec0754c3c283e6f02333a6779d799096d49b2"},valid=true,value=".flake/cIO.object/15/liolib.o"},["cIO.object/97c48ed6e195d9010755f34120dd0500265f281f"]={buildName="cIO.object/16",sources={["lua-5.3.1/src/llex.c"]="41232ec61bfd893b59f5a6c0b84a1268de3d368c"},valid=true,value=".flake/cIO.object/16/llex.o"},["cIO.object/99b654bd749b22d6dbf7d7e859c89c95c69df1f2"]={buildName="cIO.object/4",sources={["lua-5.3.1/src/lbitlib.c"]="e23515116c3efefbd8dcf20a44e5866f7bfd1158"},valid=true,value=".flake/cIO.object/4/lbitlib.o"},["cIO.object/a5365aaf50cabde069ea9a6a8990006901b00b3a"]={buildName="cIO.object/20",sources={["lua-5.3.1/src/lobject.c"]="1bcab5dbb76742f990ebf56b17b00dbe4449eacc"},valid=true,value=".flake/cIO.object/20/lobject.o"},["cIO.object/ae9117c17984260e5f82329f334de2c2e2492799"]={buildName="cIO.object/8",sources={["lua-5.3.1/src/ldblib.c"]="3d7198e536820e19fa6f4848e077fbc7a3e61e97"},valid=true,value=".flake/cIO.object/8/ldblib.o"},["cIO.object/bf48310da6176bce8b937f1def0a55d40c9930a1"]={buildName="cIO.object/25",sources={["lua-5.3.1/src/lstring.c"]="c4c74f4f3268361b5f2f61dde9bf24ed04cefc32"},valid=true,value=".flake/cIO.object/25/lstring.o"},["cIO.object/c021dfa569bd9658919635c1962d0bf376fecfba"]={buildName="cIO.object/33",sources={["lua-5.3.1/src/lzio.c"]="afc8294354f8374efd88b3b946ce552c45919df6"},valid=true,value=".flake/cIO.object/33/lzio.o"},["cIO.object/c48cbf198c7ae3b350541c87c211ffc889931e52"]={buildName="cIO.object/1",sources={["lua-5.3.1/src/lapi.c"]="ef0a4087c746bcc74aa7c57a4664efc28c67b0f3"},valid=true,value=".flake/cIO.object/1/lapi.o"},["cIO.object/c6c0269d41b655bcf018820eff676ba166e309e1"]={buildName="cIO.object/21",sources={["lua-5.3.1/src/lopcodes.c"]="ec07bc9c44c68371c94a8cb0287fa62908660823"},valid=true,value=".flake/cIO.object/21/lopcodes.o"},["cIO.object/cf146ecc23d265f39f68625b256fc752fa8cee80"]={buildName="cIO.object/30",sources={["lua-5.3.1/src/lundump.c"]="09f5ae6d8baff258e90f55be5b4fb6ecbbecb48d"},valid=true,value=".flake/cIO.object/30/lundump.o"},["cIO.object/d365bb0f4e236da5eb3c5b36d7dd5ec614fda38a"]={buildName="cIO.object/31",sources={["lua-5.3.1/src/lutf8lib.c"]="851610538cde0812de84077b6c18939f52910fe9"},valid=true,value=".flake/cIO.object/31/lutf8lib.o"},["cIO.object/e399ee8eec86cff88b1dff014f48b2add011000e"]={buildName="cIO.object/19",sources={["lua-5.3.1/src/loadlib.c"]="e750c5bf2a89f6f6c6608fdc5b435506e5bb8255"},valid=true,value=".flake/cIO.object/19/loadlib.o"},["cIO.object/e6f3aadd8b164a3ca57d48f092bd2eed4292fd2e"]={buildName="cIO.object/12",sources={["lua-5.3.1/src/lfunc.c"]="47694b371068f51fcc53569e6d1685972ed3af04"},valid=true,value=".flake/cIO.object/12/lfunc.o"},["cIO.object/ef00ce884fca4fbd0e101afe78382cce6c49b1be"]={buildName="cIO.object/9",sources={["lua-5.3.1/src/ldebug.c"]="45ae02ab3fd2eb05aef871f6c50bda878f14c414"},valid=true,value=".flake/cIO.object/9/ldebug.o"},["cIO.object/f02a7ad3af8c6d42a2da26d9ec3d16dd10d96c36"]={buildName="cIO.object/11",sources={["lua-5.3.1/src/ldump.c"]="97396e6b9d5a3ecb9f35817564fbc4eb18fa4d62"},valid=true,value=".flake/cIO.object/11/ldump.o"},["cIO.object/ff58376ebdeafc9e6144f03abe238d3194888f9a"]={buildName="cIO.object/2",sources={["lua-5.3.1/src/lauxlib.c"]="886add74dd812489ad166a9c799369e6da700c7f"},valid=true,value=".flake/cIO.object/2/lauxlib.o"},["cIO.program/b97de338fec89e23d60e58684b7928d4957f528f"]={buildName="cIO.program/1",sources={["lua-5.3.1/src/lua.c"]="bbf7bfd825254858f2833abeba89b83834552d48",["out/release/lib/liblua.lib"]="9070a1e713f5026ba0867eec83fe7bec53538aac"},valid=true,value="out/release/bin/lua"},["systemIO.directory/d1be3829fee16a69a2a1b1b4b56985f74de9d407"]={buildName="systemIO.directory/1",sources={["lua-5.3.1/src/lauxlib.h"]={ctime=1792189296935683447,inode=1172044,mtime=1454600802000000000,sha1="9b1f29d3482ee5692d44e63f09fef9c2ca27860a",size=8433.0},["lua-5.3.1/src/lua.h"]={ctime=1792189296935683447,inode=1172046,mtime=1454600802000000000,sha1="a4bee2580b7485cb9b037f117365567390831cb1",size=14825.0},["lua-5.3.1/src/luaconf.h"]={ctime=1792189296935683447,inode=1172062,mtime=1454600802000000000,sha1="4409317e060f2df6b6fb6e7576ba854a0539af33",size=20581.0},["lua-5.3.1/src/lualib.h"]={ctime=1792189296935683447,inode=1172058,mtime=1454600802000000000,sha1="3a176908a331de5bedfdfb5fc4217f97e59c9e68",size=1173.0},["out/release/bin/lua"]={ctime=1792189296945366559,inode=1172170,mtime=1792181609000000000,sha1="4559760d7519e1cc18a30beab3da0b5b7f2a100a",size=261136.0},["out/release/lib/liblua.lib"]={ctime=1792189296944514866,inode=1172168,mtime=1792181609000000000,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0}},valid=true,value={contents={bin={lua="out/release/bin/lua"},lib={["liblua.lib"]="out/release/lib/liblua.lib"},src={["lauxlib.h"]="out/release/src/lauxlib.h",["lua.h"]="out/release/src/lua.h",["luaconf.h"]="out/release/src/luaconf.h",["lualib.h"]="out/release/src/lualib.h"}},path="out/release"}},["systemIO.find/97acb057bd03e5957badb63f5c48be4cdd53e5d4"]={buildName="systemIO.find/1",outputs={["lua-5.3.1/src/lapi.c"]="ef0a4087c746bcc74aa7c57a4664efc28c67b0f3",["lua-5.3.1/src/lauxlib.c"]="886add74dd812489ad166a9c799369e6da700c7f",["lua-5.3.1/src/lbaselib.c"]="01207829e804d4fe273b4dfc1b3879570c2f524e",["lua-5.3.1/src/lbitlib.c"]="e23515116c3efefbd8dcf20a44e5866f7bfd1158",["lua-5.3.1/src/lcode.c"]="1b3038bb88dfa60c7e0f1aef04ce2c8bd1c72c23",["lua-5.3.1/src/lcorolib.c"]="bfb30406a736cdc65bcfe1452c935bc49196163a",["lua-5.3.1/src/lctype.c"]="4ffef420308d1b432701d2f4b57bc1cedd2db575",["lua-5.3.1/src/ldblib.c"]="3d7198e536820e19fa6f4848e077fbc7a3e61e97",["lua-5.3.1/src/ldebug.c"]="45ae02ab3fd2eb05aef871f6c50bda878f14c414",["lua-5.3.1/src/ldo.c"]="9a5cfc32740900b3cb6450acaff9118d1fbaf880",["lua-5.3.1/src/ldump.c"]="97396e6b9d5a3ecb9f35817564fbc4eb18fa4d62",["lua-5.3.1/src/lfunc.c"]="47694b371068f51fcc53569e6d1685972ed3af04",["lua-5.3.1/src/lgc.c"]="6d6564370abcb3d3e26f45463e0024d033ea8c3a",["lua-5.3.1/src/linit.c"]="5608487cf2f6c4660b5cc5753bfec1e6e8ac1eeb",["lua-5.3.1/src/liolib.c"]="598ec0754c3c283e6f02333a6779d799096d49b2",["lua-5.3.1/src/llex.c"]="41232ec61bfd893b59f5a6c0b84a1268de3d368c",["lua-5.3.1/src/lmathlib.c"]="fafbcdb097f612fb6b172ef951c5bfceb4eec9ad",["lua-5.3.1/src/lmem.c"]="f6f098998085fbfd637e80fc8571d236d93a51c9",["lua-5.3.1/src/loadlib.c"]="e750c5bf2a89f6f6c6608fdc5b435506e5bb8255",["lua-5.3.1/src/lobject.c"]="1bcab5dbb76742f990ebf56b17b00dbe4449eacc",["lua-5.3.1/src/lopcodes.c"]="ec07bc9c44c68371c94a8cb0287fa62908660823",["lua-5.3.1/src/loslib.c"]="7c91dbea6c04c624c04bb739bda6230f7c2cfda6",["lua-5.3.1/src/lparser.c"]="7a861bf1bade9837699d0b4b8448af009f51a811",["lua-5.3.1/src/lstate.c"]="ed5ade78f87b826fe1bb24cf2995546c56b6cf83",["lua-5.3.1/src/lstring.c"]="c4c74f4f3268361b5f2f61dde9bf24ed04cefc32",["lua-5.3.1/src/lstrlib.c"]="9f800f9a18f329572ca0efe26aeb3dde7d06ecf8",["lua-5.3.1/src/ltable.c"]="6b828e8bdd1d1ad40d18c7198f4fad4b4716b72f",["lua-5.3.1/src/ltablib.c"]="e23b5de7ee94498b509f3ce76bef6c4eef0a315e",["lua-5.3.1/src/ltm.c"]="8bec4c3e3a85f27b0e9339d0b2a9c3d65da240ba",["lua-5.3.1/src/lua.c"]="bbf7bfd825254858f2833abeba89b83834552d48",["lua-5.3.1/src/luac.c"]="42f153740614b1d956939332ff9c386a645a311b",["lua-5.3.1/src/lundump.c"]="09f5ae6d8baff258e90f55be5b4fb6ecbbecb48d",["lua-5.3.1/src/lutf8lib.c"]="851610538cde0812de84077b6c18939f52910fe9",["lua-5.3.1/src/lvm.c"]="3f221b3ffc982dac80aeea7766a56de4b95facd4",["lua-5.3.1/src/lzio.c"]="afc8294354f8374efd88b3b946ce552c45919df6"},valid=true,value={"lua-5.3.1/src/lapi.c","lua-5.3.1/src/lauxlib.c","lua-5.3.1/src/lbaselib.c","lua-5.3.1/src/lbitlib.c","lua-5.3.1/src/lcode.c","lua-5.3.1/src/lcorolib.c","lua-5.3.1/src/lctype.c","lua-5.3.1/src/ldblib.c","lua-5.3.1/src/ldebug.c","lua-5.3.1/src/ldo.c","lua-5.3.1/src/ldump.c","lua-5.3.1/src/lfunc.c","lua-5.3.1/src/lgc.c","lua-5.3.1/src/linit.c","lua-5.3.1/src/liolib.c","lua-5.3.1/src/llex.c","lua-5.3.1/src/lmathlib.c","lua-5.3.1/src/lmem.c","lua-5.3.1/src/loadlib.c","lua-5.3.1/src/lobject.c","lua-5.3.1/src/lopcodes.c","lua-5.3.1/src/loslib.c","lua-5.3.1/src/lparser.c","lua-5.3.1/src/lstate.c","lua-5.3.1/src/lstring.c","lua-5.3.1/src/lstrlib.c","lua-5.3.1/src/ltable.c","lua-5.3.1/src/ltablib.c","lua-5.3.1/src/ltm.c","lua-5.3.1/src/lua.c","lua-5.3.1/src/luac.c","lua-5.3.1/src/lundump.c","lua-5.3.1/src/lutf8lib.c","lua-5.3.1/src/lvm.c","lua-5.3.1/src/lzio.c"}}}}
\ No newline at end of file
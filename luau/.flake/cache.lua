@@ -0,0 +1 @@
+return {builders={["cIO.library"]={lastIndex=2},["cIO.object"]={lastIndex=2},["luaIO.dependencies"]={lastIndex=26},["luaIO.program"]={lastIndex=3},["luaIO.run"]={lastIndex=42},["luaIO.tools"]={lastIndex=1},["systemIO.directory"]={lastIndex=1},["systemIO.find"]={lastIndex=1}},durations={["cIO.library/2c8cb5ba13ba40a28d1bf0132ac9d0bb13746a98"]=0.007030725479126,["cIO.object/6b96367c47320218e48d36fdaa34b1db177c2eea"]=1.2107670307159,["luaIO.dependencies/26a8f9650cbf342ef68fb22dcdf2f253f0d144c5"]=0.038262128829956,["luaIO.dependencies/3b2f7e42cc52b5f7b332112ae482f491be84b298"]=0.10416197776794,["luaIO.dependencies/420f725c42d9046ee4f5cda148ec237ddc90fcd7"]=0.23639988899231,["luaIO.dependencies/5270cce8c416d99d4cbbc2f24909a0b101d5f5db"]=0.26605010032654,["luaIO.dependencies/5be6839c3d702d308e720f3803b51f25908ab561"]=0.21072101593018,["luaIO.dependencies/8e7490e1c06185fb0ebf6409adb080bb356d8c0a"]=0.088156938552856,["luaIO.dependencies/93bb644b0fffecd54e5657a60bdc28d007346efa"]=0.12359499931335,["luaIO.dependencies/9ede335816efe1bc348a5bdc3d38eab3df3b7229"]=0.064435005187988,["luaIO.dependencies/a274d7b5e3878b8aca0d74ea7ce72600d46c0a1e"]=0.1870641708374,["luaIO.dependencies/c7c5950709284a4977ac0f7216e7789e9dffee9b"]=0.22423601150513,["luaIO.dependencies/e47ccc3597fe71a9eced3b5575d11f4b925d7b11"]=0.052666902542114,["luaIO.dependencies/f031dcd545782be386d90cc8b4fa904b4414c0c0"]=0.15134596824646,["luaIO.dependencies/f4aff82f20d555120ede29d0eb7fa0711f685c46"]=0.16949200630188,["luaIO.program/8cc16a1ab85091aa6436b3da63d4865c50f3626b"]=0.10548567771912,["luaIO.run/15d390e21e4d8efdc010ce38f5ff2182b8d30608"]=0.015137195587158,["luaIO.run/21f8651fcd73baa264d048eaefc31f4204979804"]=0.057601928710938,["luaIO.run/270194cbf15f0dbca87adcbaa9b2bbc0cca50ddb"]=0.011416912078857,["luaIO.run/35d6fe4d9d9d32776ca1e1e982e37261c12e6f7b"]=0.0081367492675781,["luaIO.run/365cc19f0b1786cbbc7e05605528c76ee5f12cb7"]=0.36260199546814,["luaIO.run/5ba076f3e769ca9e8863be924df8f2ead04ac92c"]=0.01072096824646,["luaIO.run/960485a04e7882bd9176a2a2f7f99de5776f5eb6"]=0.013963937759399,["luaIO.run/ae122173692e23cd191a89a05fd27e9843b281da"]=0.013360977172852,["luaIO.run/e13a02436ed2b05a2688d4d5d8e8e26127a0f50c"]=0.0060818195343018,["luaIO.run/e700e123e8a0ed6321636c349b94b67b5035b832"]=0.73072695732117,["luaIO.run/f6685f60204bd0f122c287239b838f01c0799db8"]=0.0098991394042969,["luaIO.run/fbeec704c306ba00a83ed0e384f384d4eb1c6f37"]=0.011928796768188,["systemIO.directory/65e3de9218097971baf15d711898808ddf9777ce"]=0.0047800540924072,["systemIO.find/af1c401bc584516bf7d87203901216aee69a040d"]=9.8943710327148e-05},results={["cIO.library/2ade4e62b6cd7ff01a96da1ee93872af46af664d"]={buildName="cIO.library/1",outputs={[".flake/cIO.object/1/xpfs.lib"]="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be"},sources={[".flake/cIO.object/1/xpfs.o"]={ctime=1792191993491843738,inode=1171710,mtime=1792191993491843738,sha1="8ab4fb3abef3c56b829bd5a18933965604f456e4",size=12352.0}},valid=true,value=".flake/cIO.object/1/xpfs.lib"},["cIO.library/99f7fb84ff41e2613aab11d092fd6f15d7abe623"]={buildName="cIO.library/2",graphKey="cIO.library/2c8cb5ba13ba40a28d1bf0132ac9d0bb13746a98",outputs={[".flake/cIO.object/2/xpio_c.lib"]="5c6f60488301dca811f1e07511c8e0217cab9c60"},sources={[".flake/cIO.object/2/xpio_c.o"]={ctime=1792192727607887376,inode=1171484,mtime=1792192727607887376,sha1="bb12f16bc435b4d7dda1e54e4ad938d19ec102f7",size=70544.0}},valid=true,value=".flake/cIO.object/2/xpio_c.lib"},["cIO.object/460f437a3d4446c3c968eea105ed7adca5a9c3aa"]={buildName="cIO.object/1",outputs={[".flake/cIO.object/1/xpfs.o"]="8ab4fb3abef3c56b829bd5a18933965604f456e4"},sources={["/root/repo/luau/.flake/luaIO.tools/1/inc/lauxlib.h"]={ctime=1792189296970172909,discovered=true,inode=1172789,mtime=1792181609000000000,sha1="9b1f29d3482ee5692d44e63f09fef9c2ca27860a",size=8433.0},["/root/repo/luau/.flake/luaIO.tools/1/inc/lua.h"]={ctime=1792189296970172909,discovered=true,inode=1172790,mtime=1792181609000000000,sha1="a4bee2580b7485cb9b037f117365567390831cb1",size=14825.0},["/root/repo/luau/.flake/luaIO.tools/1/inc/luaconf.h"]={ctime=1792189296970172909,discovered=true,inode=1172792,mtime=1792181609000000000,sha1="4409317e060f2df6b6fb6e7576ba854a0539af33",size=20581.0},["/root/repo/luau/.flake/luaIO.tools/1/inc/lualib.h"]={ctime=1792189296970172909,discovered=true,inode=1172791,mtime=1792181609000000000,sha1="3a176908a331de5bedfdfb5fc4217f97e59c9e68",size=1173.0},["/usr/include/asm-generic/bitsperlong.h"]={ctime=1758394390000000000,discovered=true,inode=468685,mtime=1758394390000000000,sha1="442fb5206f829f1bd6af28894d9861998b456180",size=564.0},["/usr/include/asm-generic/errno-base.h"]={ctime=1758394390000000000,discovered=true,inode=468687,mtime=1758394390000000000,sha1="8525762c1ca905d36f502a25f60293bb1f790586",size=1612.0},["/usr/include/asm-generic/errno.h"]={ctime=1758394390000000000,discovered=true,inode=468688,mtime=1758394390000000000,sha1="733866b299abb7af7a50ae4b6454963452a4e420",size=5648.0},["/usr/include/asm-generic/int-ll64.h"]={ctime=1758394390000000000,discovered=true,inode=468692,mtime=1758394390000000000,sha1="f28c024997997eb44aa8d672f1893acfddbbecc4",size=864.0},["/usr/include/asm-generic/ioctl.h"]={ctime=1758394390000000000,discovered=true,inode=468693,mtime=1758394390000000000,sha1="7bb10a09230a4afcd4e95859198675b45c870faa",size=3478.0},["/usr/include/asm-generic/ioctls.h"]={ctime=1758394390000000000,discovered=true,inode=468694,mtime=1758394390000000000,sha1="c108d5b1e8f018d59ef6d934a1b56cc12d0cd290",size=3987.0},["/usr/include/asm-generic/posix_types.h"]={ctime=1758394390000000000,discovered=true,inode=468702,mtime=1758394390000000000,sha1="4d1afa905855dace6d17f0d31ded9dcdef305c55",size=2376.0},["/usr/include/asm-generic/types.h"]={ctime=1758394390000000000,discovered=true,inode=468718,mtime=1758394390000000000,sha1="685c775e030204b425ddbfd3bc5a92958fe010d0",size=233.0},["/usr/include/dirent.h"]={ctime=1756149065000000000,discovered=true,inode=485063,mtime=1756149065000000000,sha1="95beaebc880bda13df17d5d0cc7cc4f308a6d725",size=12617.0},["/usr/include/errno.h"]={ctime=1756149065000000000,discovered=true,inode=485680,mtime=1756149065000000000,sha1="dca750e23708513aeeaadaa7f8c02f21ea044e89",size=1679.0},["/usr/include/fcntl.h"]={ctime=1756149065000000000,discovered=true,inode=485719,mtime=1756149065000000000,sha1="17c426bc71c1287e5fbcc34752f318845ad543ef",size=10126.0},["/usr/include/features-time64.h"]={ctime=1756149065000000000,discovered=true,inode=485720,mtime=1756149065000000000,sha1="57c3c8093c3af70e5851f6d498600e2f6e24fdeb",size=1409.0},["/usr/include/features.h"]={ctime=1756149065000000000,discovered=true,inode=485721,mtime=1756149065000000000,sha1="b94a6163abd6bc2af44da5cd11649078fff49e07",size=18047.0},["/usr/include/limits.h"]={ctime=1756149065000000000,discovered=true,inode=486708,mtime=1756149065000000000,sha1="b56bb72a49520713ec4b14aaa9801a714e7f165b",size=5706.0},["/usr/include/linux/errno.h"]={ctime=1758394390000000000,discovered=true,inode=486849,mtime=1758394390000000000,sha1="0704791dc040cb1dac6d842e877ee331ee91e31e",size=23.0},["/usr/include/linux/fs.h"]={ctime=1758394390000000000,discovered=true,inode=486870,mtime=1758394390000000000,sha1="424e45d71dcad767cfed907382b118806baba3d3",size=12297.0},["/usr/include/linux/fscrypt.h"]={ctime=1758394390000000000,discovered=true,inode=486871,mtime=1758394390000000000,sha1="eb48bff3ed570066d9bcac35245bb24a4d97b1cf",size=6619.0},["/usr/include/linux/ioctl.h"]={ctime=1758394390000000000,discovered=true,inode=486960,mtime=1758394390000000000,sha1="87b35167add6ebda65c60e4b6d7b87d52ceb0f1f",size=163.0},["/usr/include/linux/limits.h"]={ctime=1758394390000000000,discovered=true,inode=487000,mtime=1758394390000000000,sha1="5a72a0a4c4e42c3116cbb2d00d980524c6cdaae7",size=937.0},["/usr/include/linux/mount.h"]={ctime=1758394390000000000,discovered=true,inode=487031,mtime=1758394390000000000,sha1="c8d2f2fd6faf09901cb6660d6d8b238ca477762a",size=5092.0},["/usr/include/linux/posix_types.h"]={ctime=1758394390000000000,discovered=true,inode=487254,mtime=1758394390000000000,sha1="90a52ac7bd1bb928d2152e89786fcdf80e67fd85",size=1098.0},["/usr/include/linux/stddef.h"]={ctime=1758394390000000000,discovered=true,inode=487338,mtime=1758394390000000000,sha1="b54bcfd29ee08cc99b8a2e40fffa465b9b226859",size=1750.0},["/usr/include/linux/types.h"]={ctime=1758394390000000000,discovered=true,inode=487400,mtime=1758394390000000000,sha1="5c8f08f83a866877d2be98d500cde27c806f8b73",size=1669.0},["/usr/include/stdc-predef.h"]={ctime=1756149065000000000,discovered=true,inode=493271,mtime=1756149065000000000,sha1="2fef05d80514ca0be77efec90bda051cf87d771f",size=2462.0},["/usr/include/stdint.h"]={ctime=1756149065000000000,discovered=true,inode=493272,mtime=1756149065000000000,sha1="56406ed22f7321ecd5bd6a8717c60b263c6f33c9",size=8474.0},["/usr/include/stdio.h"]={ctime=1756149065000000000,discovered=true,inode=493273,mtime=1756149065000000000,sha1="5b2013653407906bec6406b524c0fa57757ed8fe",size=31526.0},["/usr/include/stdlib.h"]={ctime=1756149065000000000,discovered=true,inode=493275,mtime=1756149065000000000,sha1="2b84729051692a72399143be4ef081ea56328b9d",size=36827.0},["/usr/include/string.h"]={ctime=1756149065000000000,discovered=true,inode=493276,mtime=1756149065000000000,sha1="688f83132f23c99a67da4320405bc9534775ce8c",size=19460.0},["/usr/include/unistd.h"]={ctime=1756149065000000000,discovered=true,inode=493678,mtime=1756149065000000000,sha1="941f99343b7aede886a9d55565e3fc10f804b507",size=44967.0},["/usr/include/x86_64-linux-gnu/asm/bitsperlong.h"]={ctime=1758394390000000000,discovered=true,inode=493699,mtime=1758394390000000000,sha1="c43c7e14cde0240ff04706f9609ee9874a9a518a",size=321.0},["/usr/include/x86_64-linux-gnu/asm/errno.h"]={ctime=1758394390000000000,discovered=true,inode=493706,mtime=1758394390000000000,sha1="a5a86e09ca9ec5d527aea099391aba148230c6d4",size=31.0},["/usr/include/x86_64-linux-gnu/asm/ioctl.h"]={ctime=1758394390000000000,discovered=true,inode=493710,mtime=1758394390000000000,sha1="7a280073874c53da60db0c3230315cc112042fd3",size=31.0},["/usr/include/x86_64-linux-gnu/asm/ioctls.h"]={ctime=1758394390000000000,discovered=true,inode=493711,mtime=1758394390000000000,sha1="b0cb396ce9fe1a695c2d9e375ed0ab0fb6114a35",size=32.0},["/usr/include/x86_64-linux-gnu/asm/posix_types.h"]={ctime=1758394390000000000,discovered=true,inode=493726,mtime=1758394390000000000,sha1="8816fa76482ccf45b8e92cb5903074e475d29e4a",size=224.0},["/usr/include/x86_64-linux-gnu/asm/posix_types_64.h"]={ctime=1758394390000000000,discovered=true,inode=493728,mtime=1758394390000000000,sha1="8816a15c19004b54d74c7fb75f96dc196d6c19b5",size=609.0},["/usr/include/x86_64-linux-gnu/asm/types.h"]={ctime=1758394390000000000,discovered=true,inode=493751,mtime=1758394390000000000,sha1="4ef91e673a47972027eda624051b957eac6ce406",size=31.0},["/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"]={ctime=1756149065000000000,discovered=true,inode=493763,mtime=1756149065000000000,sha1="ab1071b4164c5b232c25fca85b68fa8ca61b8206",size=1283.0},["/usr/include/x86_64-linux-gnu/bits/confname.h"]={ctime=1756149065000000000,discovered=true,inode=493767,mtime=1756149065000000000,sha1="e2bcbd3fed54609616f19e70b607d9ab9d0c3000",size=23828.0},["/usr/include/x86_64-linux-gnu/bits/dirent.h"]={ctime=1756149065000000000,discovered=true,inode=493769,mtime=1756149065000000000,sha1="c81dc4c96f07a9adff1483a1f49a4c2d32fc5809",size=1771.0},["/usr/include/x86_64-linux-gnu/bits/dirent_ext.h"]={ctime=1756149065000000000,discovered=true,inode=493770,mtime=1756149065000000000,sha1="8314729cc6cff28771b170f28e5c9f2f14c437a2",size=1275.0},["/usr/include/x86_64-linux-gnu/bits/endian.h"]={ctime=1756149065000000000,discovered=true,inode=493774,mtime=1756149065000000000,sha1="1e1cd0997aa6aa983425115f3273539e9a78b0dc",size=1905.0},["/usr/include/x86_64-linux-gnu/bits/endianness.h"]={ctime=1756149065000000000,discovered=true,inode=493775,mtime=1756149065000000000,sha1="307d6e62856943910badb0a6bb6a1d51fc5c5174",size=273.0},["/usr/include/x86_64-linux-gnu/bits/environments.h"]={ctime=1756149065000000000,discovered=true,inode=493776,mtime=1756149065000000000,sha1="9f90190f3baea8c0ba4ce8e32c0fda5f50156a46",size=3791.0},["/usr/include/x86_64-linux-gnu/bits/errno.h"]={ctime=1756149065000000000,discovered=true,inode=493779,mtime=1756149065000000000,sha1="60646edfceef43f757218ac6062e6b6013147534",size=1426.0},["/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h"]={ctime=1756149065000000000,discovered=true,inode=493783,mtime=1756149065000000000,sha1="d41a3c2ed6ab4be0015020b29a1d82a3abfb2b9a",size=14992.0},["/usr/include/x86_64-linux-gnu/bits/fcntl.h"]={ctime=1756149065000000000,discovered=true,inode=493784,mtime=1756149065000000000,sha1="04f0b0bfe84c6fe5e7a47ec96035a438ce6aea83",size=2246.0},["/usr/include/x86_64-linux-gnu/bits/floatn-common.h"]={ctime=1756149065000000000,discovered=true,inode=493787,mtime=1756149065000000000,sha1="38b847eed39710bfba03e11adbac005b0390ffbc",size=10325.0},["/usr/include/x86_64-linux-gnu/bits/floatn.h"]={ctime=1756149065000000000,discovered=true,inode=493788,mtime=1756149065000000000,sha1="4a823cc315a6e7187a5a288306216f6855e24174",size=4508.0},["/usr/include/x86_64-linux-gnu/bits/getopt_core.h"]={ctime=1756149065000000000,discovered=true,inode=493792,mtime=1756149065000000000,sha1="a7215753f4655e6104911cb17a9f73525c2acdc1",size=3667.0},["/usr/include/x86_64-linux-gnu/bits/getopt_posix.h"]={ctime=1756149065000000000,discovered=true,inode=493794,mtime=1756149065000000000,sha1="fe177dbd17e44fc17b250268e4cc467598147abc",size=1810.0},["/usr/include/x86_64-linux-gnu/bits/ioctl-types.h"]={ctime=1756149065000000000,discovered=true,inode=493800,mtime=1756149065000000000,sha1="15cacd6f34fe70c660f63a07c7f919d9927256fe",size=2456.0},["/usr/include/x86_64-linux-gnu/bits/ioctls.h"]={ctime=1756149065000000000,discovered=true,inode=493801,mtime=1756149065000000000,sha1="057721c623a905e52269a63713b95309dd7005b4",size=4478.0},["/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"]={ctime=1756149065000000000,discovered=true,inode=493806,mtime=1756149065000000000,sha1="e0a400c194cd3962a342a6504a441920163b799c",size=4286.0},["/usr/include/x86_64-linux-gnu/bits/local_lim.h"]={ctime=1756149065000000000,discovered=true,inode=493810,mtime=1756149065000000000,sha1="fd8393f90eaca094763fbccc062a06cdc0813add",size=3176.0},["/usr/include/x86_64-linux-gnu/bits/long-double.h"]={ctime=1756149065000000000,discovered=true,inode=493812,mtime=1756149065000000000,sha1="4e3f5928e816ad29079d1c7d75f3a510a0939ffb",size=970.0},["/usr/include/x86_64-linux-gnu/bits/posix1_lim.h"]={ctime=1756149065000000000,discovered=true,inode=493833,mtime=1756149065000000000,sha1="eb86fa479195858b97ab3aa89beb7081abc0b350",size=5189.0},["/usr/include/x86_64-linux-gnu/bits/posix2_lim.h"]={ctime=1756149065000000000,discovered=true,inode=493834,mtime=1756149065000000000,sha1="958e9cd689a6f4217b200f3f47ee3fef1f537fd6",size=2867.0},["/usr/include/x86_64-linux-gnu/bits/posix_opt.h"]={ctime=1756149065000000000,discovered=true,inode=493835,mtime=1756149065000000000,sha1="e877d8ac03c29730c61021cbab34a62c55ddd399",size=5913.0},["/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"]={ctime=1756149065000000000,discovered=true,inode=493841,mtime=1756149065000000000,sha1="eb05d7497770e4a4b862a9f85977d80547413055",size=1214.0},["/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"]={ctime=1756149065000000000,discovered=true,inode=493842,mtime=1756149065000000000,sha1="4b2fbb17cc806fa357f74a2a60f84f43df46299b",size=951.0},["/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"]={ctime=1756149065000000000,discovered=true,inode=493843,mtime=1756149065000000000,sha1="59383b78f4ced85f1575f51f5a7a0d7f76f35507",size=1838.0},["/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"]={ctime=1756149065000000000,discovered=true,inode=493844,mtime=1756149065000000000,sha1="04ef2842b4f12e8aaaf3b7e7af72bfc03d6e8055",size=3072.0},["/usr/include/x86_64-linux-gnu/bits/stat.h"]={ctime=1756149065000000000,discovered=true,inode=493877,mtime=1756149065000000000,sha1="b04a2dbe15f69c321c6eddcc5d62016b6d4898d5",size=2231.0},["/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"]={ctime=1756149065000000000,discovered=true,inode=493882,mtime=1756149065000000000,sha1="13bf8d97f0ed027d2fec6898c5d8f581143cd55a",size=1037.0},["/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"]={ctime=1756149065000000000,discovered=true,inode=493883,mtime=1756149065000000000,sha1="8abc1116bb9bd4e7d147543052f58481768a0b8d",size=1049.0},["/usr/include/x86_64-linux-gnu/bits/stdio.h"]={ctime=1756149065000000000,discovered=true,inode=493885,mtime=1756149065000000000,sha1="521d7cd0f6572f70122386784120cc55d84899bc",size=5599.0},["/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"]={ctime=1756149065000000000,discovered=true,inode=493888,mtime=1756149065000000000,sha1="6210c8ae410ee0f39a6096b0adb9fa86febd3517",size=1213.0},["/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"]={ctime=1756149065000000000,discovered=true,inode=493889,mtime=1756149065000000000,sha1="113cad15b50cdc4078d436264b5a38b9c3010454",size=1557.0},["/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"]={ctime=1756149065000000000,discovered=true,inode=493890,mtime=1756149065000000000,sha1="2dbada4f4cdc324caae4647112857f85de0fd8fb",size=1115.0},["/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"]={ctime=1756149065000000000,discovered=true,inode=493895,mtime=1756149065000000000,sha1="64110c28c7daa28078141a51701cb05153b821bd",size=1810.0},["/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"]={ctime=1756149065000000000,discovered=true,inode=493896,mtime=1756149065000000000,sha1="4885f0cd775c99d401f740f5396d4a9993163f96",size=2027.0},["/usr/include/x86_64-linux-gnu/bits/struct_stat.h"]={ctime=1756149065000000000,discovered=true,inode=493897,mtime=1756149065000000000,sha1="0e428e2028a6554096fdf4a27f175ed1fe1cc04d",size=6190.0},["/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"]={ctime=1756149065000000000,discovered=true,inode=493914,mtime=1756149065000000000,sha1="645fdc5c9dbdb527df5d2fb4f32fdb632fe2cedf",size=3912.0},["/usr/include/x86_64-linux-gnu/bits/time64.h"]={ctime=1756149065000000000,discovered=true,inode=493916,mtime=1756149065000000000,sha1="ab2017da21608498b58eea37b2aa6a3387ee978c",size=1340.0},["/usr/include/x86_64-linux-gnu/bits/timesize.h"]={ctime=1756149065000000000,discovered=true,inode=493918,mtime=1756149065000000000,sha1="f1dd8d62a4d75288654626933edfc82ccf2394a7",size=1109.0},["/usr/include/x86_64-linux-gnu/bits/types.h"]={ctime=1756149065000000000,discovered=true,inode=493969,mtime=1756149065000000000,sha1="e5893a9c4c523615c73a51feb9680279608027c6",size=8806.0},["/usr/include/x86_64-linux-gnu/bits/types/FILE.h"]={ctime=1756149065000000000,discovered=true,inode=493921,mtime=1756149065000000000,sha1="497924e329d53517631713ae52acb73e870d7d65",size=180.0},["/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"]={ctime=1756149065000000000,discovered=true,inode=493922,mtime=1756149065000000000,sha1="274242343e85d1c06e7f5ccc5abf15e120f6e957",size=110.0},["/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"]={ctime=1756149065000000000,discovered=true,inode=493923,mtime=1756149065000000000,sha1="ac38e294b004f6e2bf18f1c55e03dc80f48d6830",size=410.0},["/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"]={ctime=1756149065000000000,discovered=true,inode=493924,mtime=1756149065000000000,sha1="760ef77769ac1921f4b1f908cbf06863e2506775",size=381.0},["/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"]={ctime=1756149065000000000,discovered=true,inode=493925,mtime=1756149065000000000,sha1="53d1d78ce0ac04bf8c8deec62280606c4ec9f9ae",size=1661.0},["/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"]={ctime=1756149065000000000,discovered=true,inode=493926,mtime=1756149065000000000,sha1="e3a4f2ee55e635520db0b4610d2b361e9ce41de7",size=564.0},["/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"]={ctime=1756149065000000000,discovered=true,inode=493929,mtime=1756149065000000000,sha1="109b9c1f529c73e6317b8860f9942d8a536049d9",size=143.0},["/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"]={ctime=1756149065000000000,discovered=true,inode=493930,mtime=1756149065000000000,sha1="a523e6012cd050571f19d92948486007ce03750d",size=174.0},["/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"]={ctime=1756149065000000000,discovered=true,inode=493934,mtime=1756149065000000000,sha1="0f1f5fb3733afc8e7cc09272634c44c38e615965",size=983.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"]={ctime=1756149065000000000,discovered=true,inode=493943,mtime=1756149065000000000,sha1="1dbf8bac589cb09e09aa4c1d36913e549a57bcf0",size=4104.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"]={ctime=1756149065000000000,discovered=true,inode=493963,mtime=1756149065000000000,sha1="c8866b86e651cd4c9be5f6ab95e9f058e2bb49b3",size=867.0},["/usr/include/x86_64-linux-gnu/bits/types/time_t.h"]={ctime=1756149065000000000,discovered=true,inode=493966,mtime=1756149065000000000,sha1="8d039c8f875489d7850b473d45aab03b3a3dc598",size=203.0},["/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"]={ctime=1756149065000000000,discovered=true,inode=493967,mtime=1756149065000000000,sha1="a6da2e84409def7eaead063172a0524d50afaf7c",size=159.0},["/usr/include/x86_64-linux-gnu/bits/typesizes.h"]={ctime=1756149065000000000,discovered=true,inode=493970,mtime=1756149065000000000,sha1="ee94b5a60d007c23bdda9e5c46c8ba40f4eb402c",size=3737.0},["/usr/include/x86_64-linux-gnu/bits/unistd_ext.h"]={ctime=1756149065000000000,discovered=true,inode=493975,mtime=1756149065000000000,sha1="a6c55be0f6cbb5a3974d6c4190ef682655cfa8b2",size=2035.0},["/usr/include/x86_64-linux-gnu/bits/waitflags.h"]={ctime=1756149065000000000,discovered=true,inode=493979,mtime=1756149065000000000,sha1="e16fdf2498ef93e18c04b1cea3cdab97c8f4444d",size=1697.0},["/usr/include/x86_64-linux-gnu/bits/waitstatus.h"]={ctime=1756149065000000000,discovered=true,inode=493980,mtime=1756149065000000000,sha1="fb6b2e0ad0765ca8d12bf33d325d4c6622904920",size=2287.0},["/usr/include/x86_64-linux-gnu/bits/wchar.h"]={ctime=1756149065000000000,discovered=true,inode=493982,mtime=1756149065000000000,sha1="8cbac2894fb06fa38c2f4f87477ba2177630b530",size=1906.0},["/usr/include/x86_64-linux-gnu/bits/wordsize.h"]={ctime=1756149065000000000,discovered=true,inode=493986,mtime=1756149065000000000,sha1="1e22245796d0be58d7fbba29f494575a46dc1b7c",size=398.0},["/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"]={ctime=1756149065000000000,discovered=true,inode=494040,mtime=1756149065000000000,sha1="f7603fa3908b56e9d1b33c91590db3252e13a799",size=481.0},["/usr/include/x86_64-linux-gnu/gnu/stubs.h"]={ctime=1756149065000000000,discovered=true,inode=494041,mtime=1756149065000000000,sha1="be168037b7503a82b1cf694cdbac8c063bb6e476",size=384.0},["/usr/include/x86_64-linux-gnu/sys/cdefs.h"]={ctime=1756149065000000000,discovered=true,inode=494070,mtime=1756149065000000000,sha1="1c53cf60ec6faf7cab899c4513a60b8b7d09b9cc",size=26665.0},["/usr/include/x86_64-linux-gnu/sys/errno.h"]={ctime=1756149065000000000,discovered=true,inode=494075,mtime=1756149065000000000,sha1="c2ed58de46444e037a7a030f538c3e844cb1aca7",size=19.0},["/usr/include/x86_64-linux-gnu/sys/ioctl.h"]={ctime=1756149065000000000,discovered=true,inode=494085,mtime=1756149065000000000,sha1="b54a4fc8c48eb28ad59d241fe5fb74fe0e6f1398",size=2027.0},["/usr/include/x86_64-linux-gnu/sys/stat.h"]={ctime=1756149065000000000,discovered=true,inode=494123,mtime=1756149065000000000,sha1="f28662bbb962063901e7439f13717855cf500d1b",size=13767.0},["/usr/include/x86_64-linux-gnu/sys/ttydefaults.h"]={ctime=1756149065000000000,discovered=true,inode=494138,mtime=1756149065000000000,sha1="6d5167133c7bd8a3523d74e93d1ed09cf0c5ca5a",size=3568.0},["/usr/include/x86_64-linux-gnu/sys/types.h"]={ctime=1756149065000000000,discovered=true,inode=494139,mtime=1756149065000000000,sha1="680173eb5bfb132665e602c74a2fe2f5858fbf4e",size=5713.0},["/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h"]={ctime=1744025177000000000,discovered=true,inode=494434,mtime=1744025177000000000,sha1="7412c68d5e5451a7df9b29fef114d5f889405f9a",size=6355.0},["/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"]={ctime=1744025177000000000,discovered=true,inode=494466,mtime=1744025177000000000,sha1="ae3b5dd8d0ca0e76cdbde851a55325adf04995e1",size=4072.0},["/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"]={ctime=1744025177000000000,discovered=true,inode=494469,mtime=1744025177000000000,sha1="adfd40a1b64341d7abff2536ce7bbd8e5771ea13",size=13275.0},["/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"]={ctime=1744025177000000000,discovered=true,inode=494472,mtime=1744025177000000000,sha1="0a3e341f5e2de1c08c50919e49701eeeb4644c29",size=328.0},["/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h"]={ctime=1744025177000000000,discovered=true,inode=494474,mtime=1744025177000000000,sha1="238c8a1b9ec309de5bac212baf0a655a56da3a28",size=330.0},["xpfs.c"]={ctime=1792191931915242707,inode=1171566,mtime=1792191931915242707,sha1="a5aa4d4cdfb578ca06a306b1a901dc77c313374e",size=15090.0}},valid=true,value=".flake/cIO.object/1/xpfs.o"},["cIO.object/a01674e0726cfb54f826894a33dc8c93a66bef2a"]={buildName="cIO.object/2",graphKey="cIO.object/6b96367c47320218e48d36fdaa34b1db177c2eea",outputs={[".flake/cIO.object/2/xpio_c.o"]="4e6fab9e62ae12ef0fa80b740d0cb58ed4567f24"},sources={["/root/repo/luau/.flake/luaIO.tools/1/inc/lauxlib.h"]={ctime=1792189296970172909,inode=1172789,mtime=1792181609000000000,sha1="9b1f29d3482ee5692d44e63f09fef9c2ca27860a",size=8433.0},["/root/repo/luau/.flake/luaIO.tools/1/inc/lua.h"]={ctime=1792189296970172909,inode=1172790,mtime=1792181609000000000,sha1="a4bee2580b7485cb9b037f117365567390831cb1",size=14825.0},["/root/repo/luau/.flake/luaIO.tools/1/inc/luaconf.h"]={ctime=1792189296970172909,inode=1172792,mtime=1792181609000000000,sha1="4409317e060f2df6b6fb6e7576ba854a0539af33",size=20581.0},["/root/repo/luau/.flake/luaIO.tools/1/inc/lualib.h"]={ctime=1792189296970172909,inode=1172791,mtime=1792181609000000000,sha1="3a176908a331de5bedfdfb5fc4217f97e59c9e68",size=1173.0},["/root/repo/luau/xlua.h"]={ctime=1792189296974035793,inode=1172899,mtime=1454600802000000000,sha1="f262268221c412ba120310bc77e04cce912cbcf9",size=4990.0},["/usr/include/alloca.h"]={ctime=1756149065000000000,inode=468666,mtime=1756149065000000000,sha1="83e3e7761b60dfd6a78ba7c3d56cbfb5ab0ddd0f",size=1203.0},["/usr/include/asm-generic/bitsperlong.h"]={ctime=1758394390000000000,inode=468685,mtime=1758394390000000000,sha1="442fb5206f829f1bd6af28894d9861998b456180",size=564.0},["/usr/include/asm-generic/errno-base.h"]={ctime=1758394390000000000,inode=468687,mtime=1758394390000000000,sha1="8525762c1ca905d36f502a25f60293bb1f790586",size=1612.0},["/usr/include/asm-generic/errno.h"]={ctime=1758394390000000000,inode=468688,mtime=1758394390000000000,sha1="733866b299abb7af7a50ae4b6454963452a4e420",size=5648.0},["/usr/include/asm-generic/int-ll64.h"]={ctime=1758394390000000000,inode=468692,mtime=1758394390000000000,sha1="f28c024997997eb44aa8d672f1893acfddbbecc4",size=864.0},["/usr/include/asm-generic/posix_types.h"]={ctime=1758394390000000000,inode=468702,mtime=1758394390000000000,sha1="4d1afa905855dace6d17f0d31ded9dcdef305c55",size=2376.0},["/usr/include/asm-generic/socket.h"]={ctime=1758394390000000000,inode=468710,mtime=1758394390000000000,sha1="2342ae601ada27d332d75b7edf2151fa9f59a43d",size=3732.0},["/usr/include/asm-generic/sockios.h"]={ctime=1758394390000000000,inode=468711,mtime=1758394390000000000,sha1="3d9e3635e3a2ca3ee8b81c6941fa133cc187bc81",size=447.0},["/usr/include/asm-generic/types.h"]={ctime=1758394390000000000,inode=468718,mtime=1758394390000000000,sha1="685c775e030204b425ddbfd3bc5a92958fe010d0",size=233.0},["/usr/include/endian.h"]={ctime=1756149065000000000,inode=485677,mtime=1756149065000000000,sha1="ee7d049440bb12025abaefe2602a06b4eddc1f3e",size=2299.0},["/usr/include/errno.h"]={ctime=1756149065000000000,inode=485680,mtime=1756149065000000000,sha1="dca750e23708513aeeaadaa7f8c02f21ea044e89",size=1679.0},["/usr/include/fcntl.h"]={ctime=1756149065000000000,inode=485719,mtime=1756149065000000000,sha1="17c426bc71c1287e5fbcc34752f318845ad543ef",size=10126.0},["/usr/include/features-time64.h"]={ctime=1756149065000000000,inode=485720,mtime=1756149065000000000,sha1="57c3c8093c3af70e5851f6d498600e2f6e24fdeb",size=1409.0},["/usr/include/features.h"]={ctime=1756149065000000000,inode=485721,mtime=1756149065000000000,sha1="b94a6163abd6bc2af44da5cd11649078fff49e07",size=18047.0},["/usr/include/limits.h"]={ctime=1756149065000000000,inode=486708,mtime=1756149065000000000,sha1="b56bb72a49520713ec4b14aaa9801a714e7f165b",size=5706.0},["/usr/include/linux/close_range.h"]={ctime=1758394390000000000,inode=486804,mtime=1758394390000000000,sha1="489aba188a6989969c74dd100b45c1d8050f851e",size=377.0},["/usr/include/linux/errno.h"]={ctime=1758394390000000000,inode=486849,mtime=1758394390000000000,sha1="0704791dc040cb1dac6d842e877ee331ee91e31e",size=23.0},["/usr/include/linux/falloc.h"]={ctime=1758394390000000000,inode=486857,mtime=1758394390000000000,sha1="4542da569dc50db9ec6f4d9b027ed1a0d42d3fad",size=3584.0},["/usr/include/linux/limits.h"]={ctime=1758394390000000000,inode=487000,mtime=1758394390000000000,sha1="5a72a0a4c4e42c3116cbb2d00d980524c6cdaae7",size=937.0},["/usr/include/linux/posix_types.h"]={ctime=1758394390000000000,inode=487254,mtime=1758394390000000000,sha1="90a52ac7bd1bb928d2152e89786fcdf80e67fd85",size=1098.0},["/usr/include/linux/stat.h"]={ctime=1758394390000000000,inode=487337,mtime=1758394390000000000,sha1="0acfab2365e978759428cca2ec614e95bdf6d9d3",size=6929.0},["/usr/include/linux/stddef.h"]={ctime=1758394390000000000,inode=487338,mtime=1758394390000000000,sha1="b54bcfd29ee08cc99b8a2e40fffa465b9b226859",size=1750.0},["/usr/include/linux/types.h"]={ctime=1758394390000000000,inode=487400,mtime=1758394390000000000,sha1="5c8f08f83a866877d2be98d500cde27c806f8b73",size=1669.0},["/usr/include/netinet/in.h"]={ctime=1756149065000000000,inode=489400,mtime=1756149065000000000,sha1="34ae66ac9b6850c190e320af7cdf99f3321e6850",size=22320.0},["/usr/include/netinet/tcp.h"]={ctime=1756149065000000000,inode=489405,mtime=1756149065000000000,sha1="9a8b74fd942400ffc13204fa208e874a22fa50df",size=10490.0},["/usr/include/poll.h"]={ctime=1756149065000000000,inode=492827,mtime=1756149065000000000,sha1="7fa190f7bdea921613642cf007d7fdbbb1a00bc3",size=22.0},["/usr/include/sched.h"]={ctime=1756149065000000000,inode=493139,mtime=1756149065000000000,sha1="55b3b7f0466420a2d93e75174238a5d6dcf44f08",size=5038.0},["/usr/include/signal.h"]={ctime=1756149065000000000,inode=493149,mtime=1756149065000000000,sha1="8c1b26c724f82828d838e51667f208d7b4c164de",size=13040.0},["/usr/include/spawn.h"]={ctime=1756149065000000000,inode=493176,mtime=1756149065000000000,sha1="55a2d6e1b07f7fde1f050968ae8bad4d6f898f8a",size=8279.0},["/usr/include/stdc-predef.h"]={ctime=1756149065000000000,inode=493271,mtime=1756149065000000000,sha1="2fef05d80514ca0be77efec90bda051cf87d771f",size=2462.0},["/usr/include/stdint.h"]={ctime=1756149065000000000,inode=493272,mtime=1756149065000000000,sha1="56406ed22f7321ecd5bd6a8717c60b263c6f33c9",size=8474.0},["/usr/include/stdio.h"]={ctime=1756149065000000000,inode=493273,mtime=1756149065000000000,sha1="5b2013653407906bec6406b524c0fa57757ed8fe",size=31526.0},["/usr/include/stdlib.h"]={ctime=1756149065000000000,inode=493275,mtime=1756149065000000000,sha1="2b84729051692a72399143be4ef081ea56328b9d",size=36827.0},["/usr/include/string.h"]={ctime=1756149065000000000,inode=493276,mtime=1756149065000000000,sha1="688f83132f23c99a67da4320405bc9534775ce8c",size=19460.0},["/usr/include/strings.h"]={ctime=1756149065000000000,inode=493277,mtime=1756149065000000000,sha1="cc83ee2073a2c4f96dddef22f204c58d62b57f9a",size=4753.0},["/usr/include/unistd.h"]={ctime=1756149065000000000,inode=493678,mtime=1756149065000000000,sha1="941f99343b7aede886a9d55565e3fc10f804b507",size=44967.0},["/usr/include/x86_64-linux-gnu/asm/bitsperlong.h"]={ctime=1758394390000000000,inode=493699,mtime=1758394390000000000,sha1="c43c7e14cde0240ff04706f9609ee9874a9a518a",size=321.0},["/usr/include/x86_64-linux-gnu/asm/errno.h"]={ctime=1758394390000000000,inode=493706,mtime=1758394390000000000,sha1="a5a86e09ca9ec5d527aea099391aba148230c6d4",size=31.0},["/usr/include/x86_64-linux-gnu/asm/posix_types.h"]={ctime=1758394390000000000,inode=493726,mtime=1758394390000000000,sha1="8816fa76482ccf45b8e92cb5903074e475d29e4a",size=224.0},["/usr/include/x86_64-linux-gnu/asm/posix_types_64.h"]={ctime=1758394390000000000,inode=493728,mtime=1758394390000000000,sha1="8816a15c19004b54d74c7fb75f96dc196d6c19b5",size=609.0},["/usr/include/x86_64-linux-gnu/asm/socket.h"]={ctime=1758394390000000000,inode=493743,mtime=1758394390000000000,sha1="0f5ff4f44dadee7cf2a9b99cdbad9ab7f3d41e78",size=32.0},["/usr/include/x86_64-linux-gnu/asm/sockios.h"]={ctime=1758394390000000000,inode=493744,mtime=1758394390000000000,sha1="10c4df9c8c34f41ecc3228417f359f638c31e8d9",size=33.0},["/usr/include/x86_64-linux-gnu/asm/types.h"]={ctime=1758394390000000000,inode=493751,mtime=1758394390000000000,sha1="4ef91e673a47972027eda624051b957eac6ce406",size=31.0},["/usr/include/x86_64-linux-gnu/asm/unistd.h"]={ctime=1758394390000000000,inode=493753,mtime=1758394390000000000,sha1="74770392215f73406f41d0d22adc12baff91349e",size=623.0},["/usr/include/x86_64-linux-gnu/asm/unistd_64.h"]={ctime=1758394390000000000,inode=493755,mtime=1758394390000000000,sha1="d03fa5db838b6f39a5d0dbce8eb3db603323b8ad",size=9757.0},["/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"]={ctime=1756149065000000000,inode=493763,mtime=1756149065000000000,sha1="ab1071b4164c5b232c25fca85b68fa8ca61b8206",size=1283.0},["/usr/include/x86_64-linux-gnu/bits/byteswap.h"]={ctime=1756149065000000000,inode=493765,mtime=1756149065000000000,sha1="e4f3bca2818322db8a04ea3b123579812c1e6598",size=2450.0},["/usr/include/x86_64-linux-gnu/bits/confname.h"]={ctime=1756149065000000000,inode=493767,mtime=1756149065000000000,sha1="e2bcbd3fed54609616f19e70b607d9ab9d0c3000",size=23828.0},["/usr/include/x86_64-linux-gnu/bits/cpu-set.h"]={ctime=1756149065000000000,inode=493768,mtime=1756149065000000000,sha1="a3ec580510d302522d42752bea865281bed19bd8",size=4516.0},["/usr/include/x86_64-linux-gnu/bits/endian.h"]={ctime=1756149065000000000,inode=493774,mtime=1756149065000000000,sha1="1e1cd0997aa6aa983425115f3273539e9a78b0dc",size=1905.0},["/usr/include/x86_64-linux-gnu/bits/endianness.h"]={ctime=1756149065000000000,inode=493775,mtime=1756149065000000000,sha1="307d6e62856943910badb0a6bb6a1d51fc5c5174",size=273.0},["/usr/include/x86_64-linux-gnu/bits/environments.h"]={ctime=1756149065000000000,inode=493776,mtime=1756149065000000000,sha1="9f90190f3baea8c0ba4ce8e32c0fda5f50156a46",size=3791.0},["/usr/include/x86_64-linux-gnu/bits/epoll.h"]={ctime=1756149065000000000,inode=493777,mtime=1756149065000000000,sha1="d4141dcb6a9aa1d8ab4b8327b0356149a770302f",size=1071.0},["/usr/include/x86_64-linux-gnu/bits/errno.h"]={ctime=1756149065000000000,inode=493779,mtime=1756149065000000000,sha1="60646edfceef43f757218ac6062e6b6013147534",size=1426.0},["/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h"]={ctime=1756149065000000000,inode=493783,mtime=1756149065000000000,sha1="d41a3c2ed6ab4be0015020b29a1d82a3abfb2b9a",size=14992.0},["/usr/include/x86_64-linux-gnu/bits/fcntl.h"]={ctime=1756149065000000000,inode=493784,mtime=1756149065000000000,sha1="04f0b0bfe84c6fe5e7a47ec96035a438ce6aea83",size=2246.0},["/usr/include/x86_64-linux-gnu/bits/floatn-common.h"]={ctime=1756149065000000000,inode=493787,mtime=1756149065000000000,sha1="38b847eed39710bfba03e11adbac005b0390ffbc",size=10325.0},["/usr/include/x86_64-linux-gnu/bits/floatn.h"]={ctime=1756149065000000000,inode=493788,mtime=1756149065000000000,sha1="4a823cc315a6e7187a5a288306216f6855e24174",size=4508.0},["/usr/include/x86_64-linux-gnu/bits/getopt_core.h"]={ctime=1756149065000000000,inode=493792,mtime=1756149065000000000,sha1="a7215753f4655e6104911cb17a9f73525c2acdc1",size=3667.0},["/usr/include/x86_64-linux-gnu/bits/getopt_posix.h"]={ctime=1756149065000000000,inode=493794,mtime=1756149065000000000,sha1="fe177dbd17e44fc17b250268e4cc467598147abc",size=1810.0},["/usr/include/x86_64-linux-gnu/bits/in.h"]={ctime=1756149065000000000,inode=493796,mtime=1756149065000000000,sha1="d88de549db7ec052fa9bcb164970e91d481f8a9e",size=9309.0},["/usr/include/x86_64-linux-gnu/bits/inotify.h"]={ctime=1756149065000000000,inode=493799,mtime=1756149065000000000,sha1="0529f919f48bd8df7e6161726a41a6afee1d44a6",size=1080.0},["/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"]={ctime=1756149065000000000,inode=493806,mtime=1756149065000000000,sha1="e0a400c194cd3962a342a6504a441920163b799c",size=4286.0},["/usr/include/x86_64-linux-gnu/bits/local_lim.h"]={ctime=1756149065000000000,inode=493810,mtime=1756149065000000000,sha1="fd8393f90eaca094763fbccc062a06cdc0813add",size=3176.0},["/usr/include/x86_64-linux-gnu/bits/long-double.h"]={ctime=1756149065000000000,inode=493812,mtime=1756149065000000000,sha1="4e3f5928e816ad29079d1c7d75f3a510a0939ffb",size=970.0},["/usr/include/x86_64-linux-gnu/bits/poll.h"]={ctime=1756149065000000000,inode=493831,mtime=1756149065000000000,sha1="32751c2e0ae1b0c24e604d2e738f191dd89cc6d5",size=2076.0},["/usr/include/x86_64-linux-gnu/bits/posix1_lim.h"]={ctime=1756149065000000000,inode=493833,mtime=1756149065000000000,sha1="eb86fa479195858b97ab3aa89beb7081abc0b350",size=5189.0},["/usr/include/x86_64-linux-gnu/bits/posix2_lim.h"]={ctime=1756149065000000000,inode=493834,mtime=1756149065000000000,sha1="958e9cd689a6f4217b200f3f47ee3fef1f537fd6",size=2867.0},["/usr/include/x86_64-linux-gnu/bits/posix_opt.h"]={ctime=1756149065000000000,inode=493835,mtime=1756149065000000000,sha1="e877d8ac03c29730c61021cbab34a62c55ddd399",size=5913.0},["/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"]={ctime=1756149065000000000,inode=493841,mtime=1756149065000000000,sha1="eb05d7497770e4a4b862a9f85977d80547413055",size=1214.0},["/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"]={ctime=1756149065000000000,inode=493843,mtime=1756149065000000000,sha1="59383b78f4ced85f1575f51f5a7a0d7f76f35507",size=1838.0},["/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"]={ctime=1756149065000000000,inode=493844,mtime=1756149065000000000,sha1="04ef2842b4f12e8aaaf3b7e7af72bfc03d6e8055",size=3072.0},["/usr/include/x86_64-linux-gnu/bits/resource.h"]={ctime=1756149065000000000,inode=493846,mtime=1756149065000000000,sha1="47831a25548deb050895150f88534c185cfc0197",size=6308.0},["/usr/include/x86_64-linux-gnu/bits/sched.h"]={ctime=1756149065000000000,inode=493848,mtime=1756149065000000000,sha1="92a34e7fa68fdd304b842d4fdb96c7f7dcd3412a",size=4112.0},["/usr/include/x86_64-linux-gnu/bits/select.h"]={ctime=1756149065000000000,inode=493849,mtime=1756149065000000000,sha1="dcae808acaf259c15f4d6cccf181a2d322114298",size=1505.0},["/usr/include/x86_64-linux-gnu/bits/sigaction.h"]={ctime=1756149065000000000,inode=493857,mtime=1756149065000000000,sha1="bba606bbb954eccda8ff9f6e4a4c63086219a135",size=2935.0},["/usr/include/x86_64-linux-gnu/bits/sigcontext.h"]={ctime=1756149065000000000,inode=493858,mtime=1756149065000000000,sha1="2174282ec53d28f21500bdfc81651a505c0e1224",size=4266.0},["/usr/include/x86_64-linux-gnu/bits/sigevent-consts.h"]={ctime=1756149065000000000,inode=493859,mtime=1756149065000000000,sha1="0647c05d2e316066f4b0df365c83a7ba264dcef1",size=1471.0},["/usr/include/x86_64-linux-gnu/bits/siginfo-arch.h"]={ctime=1756149065000000000,inode=493860,mtime=1756149065000000000,sha1="8b8d06aec13371724ad1a512da573a855fc0382d",size=729.0},["/usr/include/x86_64-linux-gnu/bits/siginfo-consts-arch.h"]={ctime=1756149065000000000,inode=493861,mtime=1756149065000000000,sha1="1b549ae0ba885387728f9ad72f992fd479c332f1",size=204.0},["/usr/include/x86_64-linux-gnu/bits/siginfo-consts.h"]={ctime=1756149065000000000,inode=493862,mtime=1756149065000000000,sha1="a0116d3b7487e87225de8eb70c69c944d295568d",size=7036.0},["/usr/include/x86_64-linux-gnu/bits/signal_ext.h"]={ctime=1756149065000000000,inode=493863,mtime=1756149065000000000,sha1="0f4d9d4dd4869ecf685bfedd078c83c12b7b1201",size=1285.0},["/usr/include/x86_64-linux-gnu/bits/signum-arch.h"]={ctime=1756149065000000000,inode=493865,mtime=1756149065000000000,sha1="405c1d93434b7b2876de0bc90c495aac93c435f0",size=2580.0},["/usr/include/x86_64-linux-gnu/bits/signum-generic.h"]={ctime=1756149065000000000,inode=493866,mtime=1756149065000000000,sha1="a382143ee539b48676654899c632f652cfebc265",size=3313.0},["/usr/include/x86_64-linux-gnu/bits/sigstack.h"]={ctime=1756149065000000000,inode=493867,mtime=1756149065000000000,sha1="ea576b78d5c1e215bec6dc0386c677294fbb4164",size=1168.0},["/usr/include/x86_64-linux-gnu/bits/sigstksz.h"]={ctime=1756149065000000000,inode=493868,mtime=1756149065000000000,sha1="9f7e63a7ed6f6c9280fd5bb8365812f4e1b3f556",size=1283.0},["/usr/include/x86_64-linux-gnu/bits/sigthread.h"]={ctime=1756149065000000000,inode=493869,mtime=1756149065000000000,sha1="17ebab591a285fd02533fce508e816caad515604",size=1692.0},["/usr/include/x86_64-linux-gnu/bits/sockaddr.h"]={ctime=1756149065000000000,inode=493870,mtime=1756149065000000000,sha1="e8c3b9a302f697a92d71b3e07000f5ffd219744f",size=1514.0},["/usr/include/x86_64-linux-gnu/bits/socket.h"]={ctime=1756149065000000000,inode=493872,mtime=1756149065000000000,sha1="a8cb70ec365958cace39a146963dc850d2464a5a",size=13575.0},["/usr/include/x86_64-linux-gnu/bits/socket_type.h"]={ctime=1756149065000000000,inode=493874,mtime=1756149065000000000,sha1="9946ac87ada348e6013291b376cdf786cb9f51fa",size=2216.0},["/usr/include/x86_64-linux-gnu/bits/ss_flags.h"]={ctime=1756149065000000000,inode=493875,mtime=1756149065000000000,sha1="02b42c1d405660dc5dc263b39a3379a0ed33f290",size=1188.0},["/usr/include/x86_64-linux-gnu/bits/stat.h"]={ctime=1756149065000000000,inode=493877,mtime=1756149065000000000,sha1="b04a2dbe15f69c321c6eddcc5d62016b6d4898d5",size=2231.0},["/usr/include/x86_64-linux-gnu/bits/statx-generic.h"]={ctime=1756149065000000000,inode=493880,mtime=1756149065000000000,sha1="2deeee3d2fbd11fa24b14a7dc5371d8271abc4ea",size=2187.0},["/usr/include/x86_64-linux-gnu/bits/statx.h"]={ctime=1756149065000000000,inode=493881,mtime=1756149065000000000,sha1="dd28526cef4ca73201d6f2de9b514f62efbbab3f",size=1400.0},["/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"]={ctime=1756149065000000000,inode=493882,mtime=1756149065000000000,sha1="13bf8d97f0ed027d2fec6898c5d8f581143cd55a",size=1037.0},["/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"]={ctime=1756149065000000000,inode=493883,mtime=1756149065000000000,sha1="8abc1116bb9bd4e7d147543052f58481768a0b8d",size=1049.0},["/usr/include/x86_64-linux-gnu/bits/stdio.h"]={ctime=1756149065000000000,inode=493885,mtime=1756149065000000000,sha1="521d7cd0f6572f70122386784120cc55d84899bc",size=5599.0},["/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"]={ctime=1756149065000000000,inode=493888,mtime=1756149065000000000,sha1="6210c8ae410ee0f39a6096b0adb9fa86febd3517",size=1213.0},["/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"]={ctime=1756149065000000000,inode=493889,mtime=1756149065000000000,sha1="113cad15b50cdc4078d436264b5a38b9c3010454",size=1557.0},["/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"]={ctime=1756149065000000000,inode=493890,mtime=1756149065000000000,sha1="2dbada4f4cdc324caae4647112857f85de0fd8fb",size=1115.0},["/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"]={ctime=1756149065000000000,inode=493895,mtime=1756149065000000000,sha1="64110c28c7daa28078141a51701cb05153b821bd",size=1810.0},["/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"]={ctime=1756149065000000000,inode=493896,mtime=1756149065000000000,sha1="4885f0cd775c99d401f740f5396d4a9993163f96",size=2027.0},["/usr/include/x86_64-linux-gnu/bits/struct_stat.h"]={ctime=1756149065000000000,inode=493897,mtime=1756149065000000000,sha1="0e428e2028a6554096fdf4a27f175ed1fe1cc04d",size=6190.0},["/usr/include/x86_64-linux-gnu/bits/syscall.h"]={ctime=1756149065000000000,inode=493899,mtime=1756149065000000000,sha1="357f2eb419a1e70c945469628735f954fe6e2412",size=45663.0},["/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"]={ctime=1756149065000000000,inode=493914,mtime=1756149065000000000,sha1="645fdc5c9dbdb527df5d2fb4f32fdb632fe2cedf",size=3912.0},["/usr/include/x86_64-linux-gnu/bits/time64.h"]={ctime=1756149065000000000,inode=493916,mtime=1756149065000000000,sha1="ab2017da21608498b58eea37b2aa6a3387ee978c",size=1340.0},["/usr/include/x86_64-linux-gnu/bits/timesize.h"]={ctime=1756149065000000000,inode=493918,mtime=1756149065000000000,sha1="f1dd8d62a4d75288654626933edfc82ccf2394a7",size=1109.0},["/usr/include/x86_64-linux-gnu/bits/types.h"]={ctime=1756149065000000000,inode=493969,mtime=1756149065000000000,sha1="e5893a9c4c523615c73a51feb9680279608027c6",size=8806.0},["/usr/include/x86_64-linux-gnu/bits/types/FILE.h"]={ctime=1756149065000000000,inode=493921,mtime=1756149065000000000,sha1="497924e329d53517631713ae52acb73e870d7d65",size=180.0},["/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"]={ctime=1756149065000000000,inode=493922,mtime=1756149065000000000,sha1="274242343e85d1c06e7f5ccc5abf15e120f6e957",size=110.0},["/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"]={ctime=1756149065000000000,inode=493923,mtime=1756149065000000000,sha1="ac38e294b004f6e2bf18f1c55e03dc80f48d6830",size=410.0},["/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"]={ctime=1756149065000000000,inode=493924,mtime=1756149065000000000,sha1="760ef77769ac1921f4b1f908cbf06863e2506775",size=381.0},["/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"]={ctime=1756149065000000000,inode=493925,mtime=1756149065000000000,sha1="53d1d78ce0ac04bf8c8deec62280606c4ec9f9ae",size=1661.0},["/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"]={ctime=1756149065000000000,inode=493926,mtime=1756149065000000000,sha1="e3a4f2ee55e635520db0b4610d2b361e9ce41de7",size=564.0},["/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"]={ctime=1756149065000000000,inode=493927,mtime=1756149065000000000,sha1="7cdc5875c75071333701c117fec46585928ff8a3",size=206.0},["/usr/include/x86_64-linux-gnu/bits/types/__sigval_t.h"]={ctime=1756149065000000000,inode=493928,mtime=1756149065000000000,sha1="6e795423248c4f03d0116aa4a9d1a8d0a925fde5",size=1148.0},["/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"]={ctime=1756149065000000000,inode=493929,mtime=1756149065000000000,sha1="109b9c1f529c73e6317b8860f9942d8a536049d9",size=143.0},["/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"]={ctime=1756149065000000000,inode=493930,mtime=1756149065000000000,sha1="a523e6012cd050571f19d92948486007ce03750d",size=174.0},["/usr/include/x86_64-linux-gnu/bits/types/cookie_io_functions_t.h"]={ctime=1756149065000000000,inode=493931,mtime=1756149065000000000,sha1="37800db65ab48cfae66099025698630b3f741aec",size=2725.0},["/usr/include/x86_64-linux-gnu/bits/types/error_t.h"]={ctime=1756149065000000000,inode=493932,mtime=1756149065000000000,sha1="1905c5798c319458fa25f7e518a57892d8417a3b",size=894.0},["/usr/include/x86_64-linux-gnu/bits/types/idtype_t.h"]={ctime=1756149065000000000,inode=493933,mtime=1756149065000000000,sha1="10bb96ca50d1a11e5741d8d2360569ad315cbd9b",size=369.0},["/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"]={ctime=1756149065000000000,inode=493934,mtime=1756149065000000000,sha1="0f1f5fb3733afc8e7cc09272634c44c38e615965",size=983.0},["/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"]={ctime=1756149065000000000,inode=493937,mtime=1756149065000000000,sha1="fe9b0359e68fd3945de80479230c91612879b2de",size=272.0},["/usr/include/x86_64-linux-gnu/bits/types/sigevent_t.h"]={ctime=1756149065000000000,inode=493938,mtime=1756149065000000000,sha1="9feb317b09a2f3c9ed4ae17b6989b0a8d93e5043",size=1204.0},["/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h"]={ctime=1756149065000000000,inode=493939,mtime=1756149065000000000,sha1="62dbcfdafb09254ebdb2cd5cbb47daf5b56800cf",size=3892.0},["/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"]={ctime=1756149065000000000,inode=493940,mtime=1756149065000000000,sha1="7e5d3d9137c62d47ca1ab089028985d407c18fbd",size=195.0},["/usr/include/x86_64-linux-gnu/bits/types/sigval_t.h"]={ctime=1756149065000000000,inode=493941,mtime=1756149065000000000,sha1="c7c9cb9fd4ca38a46ffca7911a6f22d7e8e0b643",size=599.0},["/usr/include/x86_64-linux-gnu/bits/types/stack_t.h"]={ctime=1756149065000000000,inode=493942,mtime=1756149065000000000,sha1="75d3869d4466ee966206b666ab56f0762b18e55f",size=1062.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"]={ctime=1756149065000000000,inode=493943,mtime=1756149065000000000,sha1="1dbf8bac589cb09e09aa4c1d36913e549a57bcf0",size=4104.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"]={ctime=1756149065000000000,inode=493945,mtime=1756149065000000000,sha1="d0cdd5e8c4c7be7c77b8dd6df6a5fc7dccff457a",size=1066.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_osockaddr.h"]={ctime=1756149065000000000,inode=493950,mtime=1756149065000000000,sha1="0f9804265833255e385c7c96244c520866fe4cf3",size=274.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_rusage.h"]={ctime=1756149065000000000,inode=493951,mtime=1756149065000000000,sha1="66d13926fa3b6547c7e7b8bd44c59db83c9b49d0",size=4121.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"]={ctime=1756149065000000000,inode=493952,mtime=1756149065000000000,sha1="e635a0498a156c5eea104bb36855433baa53bc0b",size=1073.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_sigstack.h"]={ctime=1756149065000000000,inode=493959,mtime=1756149065000000000,sha1="b8d7b458d06058b3e6f6d319138a2d26a34c0539",size=1073.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_statx.h"]={ctime=1756149065000000000,inode=493960,mtime=1756149065000000000,sha1="7a240d413196c007ddeedb8c822ea3ea03af04d8",size=1897.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_statx_timestamp.h"]={ctime=1756149065000000000,inode=493961,mtime=1756149065000000000,sha1="2a5c211c1d7649283fb474019f322ff1750c874f",size=1202.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"]={ctime=1756149065000000000,inode=493963,mtime=1756149065000000000,sha1="c8866b86e651cd4c9be5f6ab95e9f058e2bb49b3",size=867.0},["/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"]={ctime=1756149065000000000,inode=493964,mtime=1756149065000000000,sha1="8b9f10e1dd9beeed202d21f29be537c6fa3f525d",size=411.0},["/usr/include/x86_64-linux-gnu/bits/types/time_t.h"]={ctime=1756149065000000000,inode=493966,mtime=1756149065000000000,sha1="8d039c8f875489d7850b473d45aab03b3a3dc598",size=203.0},["/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"]={ctime=1756149065000000000,inode=493967,mtime=1756149065000000000,sha1="a6da2e84409def7eaead063172a0524d50afaf7c",size=159.0},["/usr/include/x86_64-linux-gnu/bits/typesizes.h"]={ctime=1756149065000000000,inode=493970,mtime=1756149065000000000,sha1="ee94b5a60d007c23bdda9e5c46c8ba40f4eb402c",size=3737.0},["/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"]={ctime=1756149065000000000,inode=493971,mtime=1756149065000000000,sha1="24f0f9e9e22039ed6c25b990a56e64f7b722f0eb",size=1542.0},["/usr/include/x86_64-linux-gnu/bits/uio_lim.h"]={ctime=1756149065000000000,inode=493973,mtime=1756149065000000000,sha1="ff1e2d5ebf05214f7c06adf0ba894eb9f1b823e4",size=1385.0},["/usr/include/x86_64-linux-gnu/bits/unistd_ext.h"]={ctime=1756149065000000000,inode=493975,mtime=1756149065000000000,sha1="a6c55be0f6cbb5a3974d6c4190ef682655cfa8b2",size=2035.0},["/usr/include/x86_64-linux-gnu/bits/waitflags.h"]={ctime=1756149065000000000,inode=493979,mtime=1756149065000000000,sha1="e16fdf2498ef93e18c04b1cea3cdab97c8f4444d",size=1697.0},["/usr/include/x86_64-linux-gnu/bits/waitstatus.h"]={ctime=1756149065000000000,inode=493980,mtime=1756149065000000000,sha1="fb6b2e0ad0765ca8d12bf33d325d4c6622904920",size=2287.0},["/usr/include/x86_64-linux-gnu/bits/wchar.h"]={ctime=1756149065000000000,inode=493982,mtime=1756149065000000000,sha1="8cbac2894fb06fa38c2f4f87477ba2177630b530",size=1906.0},["/usr/include/x86_64-linux-gnu/bits/wordsize.h"]={ctime=1756149065000000000,inode=493986,mtime=1756149065000000000,sha1="1e22245796d0be58d7fbba29f494575a46dc1b7c",size=398.0},["/usr/include/x86_64-linux-gnu/bits/xopen_lim.h"]={ctime=1756149065000000000,inode=493987,mtime=1756149065000000000,sha1="b9fac6d1d25240b627f846a96232ceb5c424d12d",size=3858.0},["/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"]={ctime=1756149065000000000,inode=494040,mtime=1756149065000000000,sha1="f7603fa3908b56e9d1b33c91590db3252e13a799",size=481.0},["/usr/include/x86_64-linux-gnu/gnu/stubs.h"]={ctime=1756149065000000000,inode=494041,mtime=1756149065000000000,sha1="be168037b7503a82b1cf694cdbac8c063bb6e476",size=384.0},["/usr/include/x86_64-linux-gnu/sys/cdefs.h"]={ctime=1756149065000000000,inode=494070,mtime=1756149065000000000,sha1="1c53cf60ec6faf7cab899c4513a60b8b7d09b9cc",size=26665.0},["/usr/include/x86_64-linux-gnu/sys/epoll.h"]={ctime=1756149065000000000,inode=494074,mtime=1756149065000000000,sha1="e0ba0b151c6171a18c38c05104d01fd85536bf78",size=5236.0},["/usr/include/x86_64-linux-gnu/sys/errno.h"]={ctime=1756149065000000000,inode=494075,mtime=1756149065000000000,sha1="c2ed58de46444e037a7a030f538c3e844cb1aca7",size=19.0},["/usr/include/x86_64-linux-gnu/sys/inotify.h"]={ctime=1756149065000000000,inode=494083,mtime=1756149065000000000,sha1="3049c13688a1805cc787af1eed0bb19718d5af6b",size=3901.0},["/usr/include/x86_64-linux-gnu/sys/poll.h"]={ctime=1756149065000000000,inode=494100,mtime=1756149065000000000,sha1="1299638e821b55c9674604a90fa1723008eed019",size=3025.0},["/usr/include/x86_64-linux-gnu/sys/resource.h"]={ctime=1756149065000000000,inode=494111,mtime=1756149065000000000,sha1="fea6e4aadb7db47a84039d13f28a8b6d94e68386",size=4034.0},["/usr/include/x86_64-linux-gnu/sys/select.h"]={ctime=1756149065000000000,inode=494113,mtime=1756149065000000000,sha1="4fe4755fcb0f5fd9c932a2938dbe4307ec848a71",size=5039.0},["/usr/include/x86_64-linux-gnu/sys/socket.h"]={ctime=1756149065000000000,inode=494120,mtime=1756149065000000000,sha1="de0f4a4ee04180c8882c6bebac82b566ae0ae1ae",size=12382.0},["/usr/include/x86_64-linux-gnu/sys/stat.h"]={ctime=1756149065000000000,inode=494123,mtime=1756149065000000000,sha1="f28662bbb962063901e7439f13717855cf500d1b",size=13767.0},["/usr/include/x86_64-linux-gnu/sys/syscall.h"]={ctime=1756149065000000000,inode=494127,mtime=1756149065000000000,sha1="b05af9d01dcb4680b59340c7397c1c326bfbf55a",size=1256.0},["/usr/include/x86_64-linux-gnu/sys/time.h"]={ctime=1756149065000000000,inode=494132,mtime=1756149065000000000,sha1="6b0e85eed949b6a8950c6aa4176bb14fe0975e5e",size=9139.0},["/usr/include/x86_64-linux-gnu/sys/types.h"]={ctime=1756149065000000000,inode=494139,mtime=1756149065000000000,sha1="680173eb5bfb132665e602c74a2fe2f5858fbf4e",size=5713.0},["/usr/include/x86_64-linux-gnu/sys/ucontext.h"]={ctime=1756149065000000000,inode=494140,mtime=1756149065000000000,sha1="c16c9da95ecc35ebcc22340858d2da3149fbe996",size=5842.0},["/usr/include/x86_64-linux-gnu/sys/un.h"]={ctime=1756149065000000000,inode=494142,mtime=1756149065000000000,sha1="defec816bb52ab7155b20077b5d25c51efdb35b7",size=1453.0},["/usr/include/x86_64-linux-gnu/sys/wait.h"]={ctime=1756149065000000000,inode=494150,mtime=1756149065000000000,sha1="0d50d6b9ca480e2d4486d99059bde63dac085ee9",size=6106.0},["/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h"]={ctime=1744025177000000000,inode=494434,mtime=1744025177000000000,sha1="7412c68d5e5451a7df9b29fef114d5f889405f9a",size=6355.0},["/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"]={ctime=1744025177000000000,inode=494466,mtime=1744025177000000000,sha1="ae3b5dd8d0ca0e76cdbde851a55325adf04995e1",size=4072.0},["/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"]={ctime=1744025177000000000,inode=494469,mtime=1744025177000000000,sha1="adfd40a1b64341d7abff2536ce7bbd8e5771ea13",size=13275.0},["/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"]={ctime=1744025177000000000,inode=494472,mtime=1744025177000000000,sha1="0a3e341f5e2de1c08c50919e49701eeeb4644c29",size=328.0},["/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h"]={ctime=1744025177000000000,inode=494474,mtime=1744025177000000000,sha1="238c8a1b9ec309de5bac212baf0a655a56da3a28",size=330.0},["xpio_c.c"]={ctime=1792192724613364631,inode=1171576,mtime=1792192724613364631,sha1="a5882231014f5c60c7b6b972c3940c3a4b4abebe",size=63353.0}},valid=true,value=".flake/cIO.object/2/xpio_c.o"},["luaIO.dependencies/115d558e0c42e654684d4e409877906c988cbe0f"]={buildName="luaIO.dependencies/14",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0}},valid=true,value={}},["luaIO.dependencies/135becf0fa1e1536ba5992bb6b40e8b3260c4571"]={buildName="luaIO.dependencies/18",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["queue_q.lua"]={ctime=1792179886845646160,inode=1171630,mtime=1454600802000000000,sha1="3904d9a85288440a846168e695ebde5ae8f047b1",size=752.0}},valid=true,value={"./qtest.lua","./queue.lua","./object.lua"}},["luaIO.dependencies/15ae2ba7aa36151f62756b39691e6a09ffb4a63d"]={buildName="luaIO.dependencies/21",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["lfsu_q.lua"]={ctime=1792179886845646160,inode=1171620,mtime=1454600802000000000,sha1="2fcf09a937abb4c162acc1d7d81219f9185368c2",size=1667.0}},valid=true,value={"./qtest.lua","./lfsu.lua","./fsu.lua"}},["luaIO.dependencies/26a8f9650cbf342ef68fb22dcdf2f253f0d144c5"]={buildName="luaIO.dependencies/13",graphKey="luaIO.dependencies/26a8f9650cbf342ef68fb22dcdf2f253f0d144c5",outputs={["getopts.lua"]="41a0b573b7144c50cac86d2083f3ccfb3438ad25",["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["getopts_q.lua"]={ctime=1792189296974035793,inode=1172915,mtime=1454600802000000000,sha1="7a383be23918bbe3c8dcf834b98f774092871275",size=1735.0}},valid=true,value={"qtest.lua","getopts.lua"}},["luaIO.dependencies/292ba502c91dc651a0e2dcc73a48397ed56d62ad"]={buildName="luaIO.dependencies/20",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["fsu_q.lua"]={ctime=1792179886845646160,inode=1171614,mtime=1454600802000000000,sha1="1d95449d85c35f1b6da283bf2eda4b34ffc76099",size=4597.0}},valid=true,value={"./qtest.lua","./fsu.lua"}},["luaIO.dependencies/3b2f7e42cc52b5f7b332112ae482f491be84b298"]={buildName="luaIO.dependencies/4",graphKey="luaIO.dependencies/3b2f7e42cc52b5f7b332112ae482f491be84b298",outputs={["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["serialize_q.lua"]={ctime=1792189296973453132,inode=1172876,mtime=1454600802000000000,sha1="aea13d84b21bc4ac7ed10f1f0a076041e5afbf80",size=1176.0}},valid=true,value={"qtest.lua","serialize.lua"}},["luaIO.dependencies/3fb45a69a71697ce8923c528266d6135659d38cf"]={buildName="luaIO.dependencies/17",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["xpexec_q.lua"]={ctime=1792179886845646160,inode=1171639,mtime=1454600802000000000,sha1="a2292688586d910881490319c272568b53316891",size=2473.0}},valid=true,value={"./qtest.lua","./list.lua","./object.lua","./serialize.lua"}},["luaIO.dependencies/400430c0d22b92d322763d827cd63e5c6ddfd16c"]={buildName="luaIO.dependencies/24",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["thread_q.lua"]={ctime=1792184031821673550,inode=1171636,mtime=1792184031821673550,sha1="68a2b2dd0db628136be1f33f93a80f273c37d0fa",size=5269.0}},valid=true,value={"./qtest.lua","./thread.lua","./xpio.lua","./heap.lua","./object.lua","./queue.lua"}},["luaIO.dependencies/420f725c42d9046ee4f5cda148ec237ddc90fcd7"]={buildName="luaIO.dependencies/9",graphKey="luaIO.dependencies/420f725c42d9046ee4f5cda148ec237ddc90fcd7",outputs={["heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["heap_q.lua"]={ctime=1792191938105017341,inode=1171575,mtime=1792191938105017341,sha1="fb875a65ef8fb415767df7b7792427d4b14ed795",size=1538.0}},valid=true,value={"qtest.lua","heap.lua","object.lua"}},["luaIO.dependencies/45a71b539963598b72af7fec56c5b7c0bc72ab31"]={buildName="luaIO.dependencies/15",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["serialize_q.lua"]={ctime=1792179886845646160,inode=1171632,mtime=1454600802000000000,sha1="aea13d84b21bc4ac7ed10f1f0a076041e5afbf80",size=1176.0}},valid=true,value={"./qtest.lua","./serialize.lua"}},["luaIO.dependencies/47ec3f5a26f4a7c7dee2be9cc90577d815d36a74"]={buildName="luaIO.dependencies/19",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["getopts_q.lua"]={ctime=1792179886845646160,inode=1171616,mtime=1454600802000000000,sha1="7a383be23918bbe3c8dcf834b98f774092871275",size=1735.0}},valid=true,value={"./qtest.lua","./getopts.lua"}},["luaIO.dependencies/5270cce8c416d99d4cbbc2f24909a0b101d5f5db"]={buildName="luaIO.dependencies/1",graphKey="luaIO.dependencies/5270cce8c416d99d4cbbc2f24909a0b101d5f5db",sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0}},valid=true,value={}},["luaIO.dependencies/5be6839c3d702d308e720f3803b51f25908ab561"]={buildName="luaIO.dependencies/8",graphKey="luaIO.dependencies/5be6839c3d702d308e720f3803b51f25908ab561",outputs={["heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["thread_q.lua"]={ctime=1792191937901352862,inode=1171579,mtime=1792191937901352862,sha1="68a2b2dd0db628136be1f33f93a80f273c37d0fa",size=5269.0}},valid=true,value={"qtest.lua","thread.lua","xpio.lua","heap.lua","object.lua","queue.lua"}},["luaIO.dependencies/79e52e392099146d5dbbd510f30a1dabcc6dd7a1"]={buildName="luaIO.dependencies/23",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["list_q.lua"]={ctime=1792179886845646160,inode=1171622,mtime=1454600802000000000,sha1="8dfc22488cdbee440937dea6a4a2dcc4c2a8fce8",size=8647.0}},valid=true,value={"./list.lua","./object.lua","./serialize.lua"}},["luaIO.dependencies/8e7490e1c06185fb0ebf6409adb080bb356d8c0a"]={buildName="luaIO.dependencies/2",graphKey="luaIO.dependencies/8e7490e1c06185fb0ebf6409adb080bb356d8c0a",outputs={["fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["fsu_q.lua"]={ctime=1792189296974035793,inode=1172910,mtime=1454600802000000000,sha1="1d95449d85c35f1b6da283bf2eda4b34ffc76099",size=4597.0}},valid=true,value={"qtest.lua","fsu.lua"}},["luaIO.dependencies/93bb644b0fffecd54e5657a60bdc28d007346efa"]={buildName="luaIO.dependencies/3",graphKey="luaIO.dependencies/93bb644b0fffecd54e5657a60bdc28d007346efa",outputs={["list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["list_q.lua"]={ctime=1792189296974035793,inode=1172894,mtime=1454600802000000000,sha1="8dfc22488cdbee440937dea6a4a2dcc4c2a8fce8",size=8647.0}},valid=true,value={"list.lua","object.lua","serialize.lua"}},["luaIO.dependencies/9ede335816efe1bc348a5bdc3d38eab3df3b7229"]={buildName="luaIO.dependencies/11",graphKey="luaIO.dependencies/9ede335816efe1bc348a5bdc3d38eab3df3b7229",outputs={["object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["queue_q.lua"]={ctime=1792189296973453132,inode=1172874,mtime=1454600802000000000,sha1="3904d9a85288440a846168e695ebde5ae8f047b1",size=752.0}},valid=true,value={"qtest.lua","queue.lua","object.lua"}},["luaIO.dependencies/a274d7b5e3878b8aca0d74ea7ce72600d46c0a1e"]={buildName="luaIO.dependencies/7",graphKey="luaIO.dependencies/a274d7b5e3878b8aca0d74ea7ce72600d46c0a1e",outputs={["list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["xpexec_q.lua"]={ctime=1792189296968527394,inode=1172736,mtime=1454600802000000000,sha1="a2292688586d910881490319c272568b53316891",size=2473.0}},valid=true,value={"qtest.lua","list.lua","object.lua","serialize.lua"}},["luaIO.dependencies/a751abb152c91a7b4fc963d2eb99d145f10a7347"]={buildName="luaIO.dependencies/22",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["xpio_q.lua"]={ctime=1792184328213525963,inode=1171648,mtime=1792184328213525963,sha1="5b7a262e3ac0b603652b23699146abafc5457768",size=8445.0}},valid=true,value={"./qtest.lua","./xpio.lua"}},["luaIO.dependencies/a906be406b1049cb6476a6f6e7723bfb2c553316"]={buildName="luaIO.dependencies/26",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["heap_q.lua"]={sha1="831116bf56a3766a620f9a4973275474cd4e8835"}},valid=true,value={"./qtest.lua","./heap.lua","./object.lua"}},["luaIO.dependencies/be5afaa2747d0703b095b352a5c658792c628d51"]={buildName="luaIO.dependencies/16",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["object_q.lua"]={ctime=1792179886845646160,inode=1171625,mtime=1454600802000000000,sha1="daae5bc05b5be2ab6a852b29a5e1963e60c737db",size=1035.0}},valid=true,value={"./qtest.lua","./object.lua"}},["luaIO.dependencies/bf23a6f2321fe899f77e0e57d567cc4b9b10ab43"]={buildName="luaIO.dependencies/25",sources={["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["qtest_q.lua"]={ctime=1792179886845646160,inode=1171628,mtime=1454600802000000000,sha1="172cbcd9f6cc6cb9a794435b82f9166da2b4999b",size=3089.0}},valid=true,value={"./qtest.lua"}},["luaIO.dependencies/c7c5950709284a4977ac0f7216e7789e9dffee9b"]={buildName="luaIO.dependencies/6",graphKey="luaIO.dependencies/c7c5950709284a4977ac0f7216e7789e9dffee9b",outputs={["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["xpio_q.lua"]={ctime=1792192722392612825,inode=1171816,mtime=1792192722392612825,sha1="2223b2e1588504215b3fd23d4d565686619b1975",size=12381.0}},valid=true,value={"qtest.lua","xpio.lua"}},["luaIO.dependencies/e47ccc3597fe71a9eced3b5575d11f4b925d7b11"]={buildName="luaIO.dependencies/10",graphKey="luaIO.dependencies/e47ccc3597fe71a9eced3b5575d11f4b925d7b11",outputs={["object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["object_q.lua"]={ctime=1792189296974035793,inode=1172912,mtime=1454600802000000000,sha1="daae5bc05b5be2ab6a852b29a5e1963e60c737db",size=1035.0}},valid=true,value={"qtest.lua","object.lua"}},["luaIO.dependencies/f031dcd545782be386d90cc8b4fa904b4414c0c0"]={buildName="luaIO.dependencies/5",graphKey="luaIO.dependencies/f031dcd545782be386d90cc8b4fa904b4414c0c0",outputs={["fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["lfsu_q.lua"]={ctime=1792189296974035793,inode=1172898,mtime=1454600802000000000,sha1="2fcf09a937abb4c162acc1d7d81219f9185368c2",size=1667.0}},valid=true,value={"qtest.lua","lfsu.lua","fsu.lua"}},["luaIO.dependencies/f4aff82f20d555120ede29d0eb7fa0711f685c46"]={buildName="luaIO.dependencies/12",graphKey="luaIO.dependencies/f4aff82f20d555120ede29d0eb7fa0711f685c46",outputs={["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},sources={["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["qtest_q.lua"]={ctime=1792189296974035793,inode=1172916,mtime=1454600802000000000,sha1="172cbcd9f6cc6cb9a794435b82f9166da2b4999b",size=3089.0}},valid=true,value={"qtest.lua"}},["luaIO.program/3401ad58e90ea7fb0ecf875e795b23a7956e654b"]={buildName="luaIO.program/1",graphKey="luaIO.program/8cc16a1ab85091aa6436b3da63d4865c50f3626b",outputs={[".flake/luaIO.program/1/interpreter"]="bc7d21822f43730abc456685c5878a3e61df87b2"},sources={[".flake/cIO.object/1/xpfs.lib"]={ctime=1792191994638331781,inode=1171512,mtime=1792191994638331781,sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",size=12502.0},[".flake/cIO.object/2/xpio_c.lib"]={ctime=1792192727634447245,inode=1171775,mtime=1792192727634447245,sha1="4a1390686ce95d1c4a734781fea61648e326f07f",size=70696.0},["/root/repo/flake/out/boot/xplua"]={ctime=1792192726321481317,inode=1179667,mtime=1792192726321435033,sha1="bc560b38b75e4a1cc05bfd9a04ecfefc5ca7cfcd",size=314640.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792189296969745043,inode=1172787,mtime=1792181609000000000,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0}},valid=true,value=".flake/luaIO.program/1/interpreter"},["luaIO.program/43c1702ebc90d5381ba2127f3165f15386a6937f"]={buildName="luaIO.program/3",sources={}},["luaIO.program/75a01ae6a1d9386fba2926dcf9ef2315347ddfe4"]={buildName="luaIO.program/2",sources={[".flake/cIO.object/1/xpfs.lib"]={ctime=1792182546686028232,inode=1172858,mtime=1792182546686028232,sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",size=12502.0},[".flake/cIO.object/2/xpio_c.lib"]={ctime=1792184332309878992,inode=1172862,mtime=1792184332309878992,sha1="168961c940a098eec50d69aec1751dadb5a95576",size=60248.0},["/root/repo/flake/out/release/flake"]={ctime=1792184498147267943,inode=1172318,mtime=1792184498141525963,sha1="33d99b6f9dadb242295f8a47a9de7e5b05dfb780",size=1203176.0},["/root/repo/luau/.flake/luaIO.tools/1/lib/liblua.lib"]={ctime=1792181609575202119,inode=1172718,mtime=1792181609575202119,sha1="9070a1e713f5026ba0867eec83fe7bec53538aac",size=438088.0}},valid=true,value=".flake/luaIO.program/2/interpreter"},["luaIO.run/09c8e941e0bb5ed6eaa0e51bf692e89e3eee449a"]={buildName="luaIO.run/20",sources={}},["luaIO.run/0ac69c07ec4a4a0714b317b2918e028062d94f40"]={buildName="luaIO.run/9",graphKey="luaIO.run/5ba076f3e769ca9e8863be924df8f2ead04ac92c",outputs={["object.lua"]="d69b0c8869f070db83f431164d417851153db04f"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["object.lua"]={ctime=1792189296974035793,inode=1172914,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["object_q.lua"]={ctime=1792189296974035793,inode=1172912,mtime=1454600802000000000,sha1="daae5bc05b5be2ab6a852b29a5e1963e60c737db",size=1035.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0}},valid=true,value="object.lua"},["luaIO.run/0efab85d7b5173499aba0eafd632f6fa5a86cba8"]={buildName="luaIO.run/18",sources={["./fsu.lua"]={ctime=1792179886845646160,inode=1171613,mtime=1454600802000000000,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["fsu.lua"]={ctime=1792179886845646160,inode=1171613,mtime=1454600802000000000,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["fsu_q.lua"]={ctime=1792179886845646160,inode=1171614,mtime=1454600802000000000,sha1="1d95449d85c35f1b6da283bf2eda4b34ffc76099",size=4597.0}},valid=true,value="fsu.lua"},["luaIO.run/155508fe70790aa6e8e03c3fe6b294b2bafdb328"]={buildName="luaIO.run/17",sources={["./getopts.lua"]={ctime=1792179886845646160,inode=1171615,mtime=1454600802000000000,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["getopts.lua"]={ctime=1792179886845646160,inode=1171615,mtime=1454600802000000000,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["getopts_q.lua"]={ctime=1792179886845646160,inode=1171616,mtime=1454600802000000000,sha1="7a383be23918bbe3c8dcf834b98f774092871275",size=1735.0}},valid=true,value="getopts.lua"},["luaIO.run/262fd1752acb7b10ae9fe475b61dbc5a7774fb1a"]={buildName="luaIO.run/41",graphKey="luaIO.run/365cc19f0b1786cbbc7e05605528c76ee5f12cb7",outputs={["xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["xpio.lua"]={ctime=1792191938095900705,inode=1171587,mtime=1792191938095900705,sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c",size=8617.0},["xpio_q.lua"]={ctime=1792192722392612825,inode=1171816,mtime=1792192722392612825,sha1="2223b2e1588504215b3fd23d4d565686619b1975",size=12381.0}},valid=true,value="xpio.lua"},["luaIO.run/30ca6bbd6e5fca61974da1be31b180f2d7d8ad42"]={buildName="luaIO.run/4",graphKey="luaIO.run/f6685f60204bd0f122c287239b838f01c0799db8",outputs={["lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["fsu.lua"]={ctime=1792189296973453132,inode=1172868,mtime=1454600802000000000,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["lfsu.lua"]={ctime=1792189296973453132,inode=1172872,mtime=1454600802000000000,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["lfsu_q.lua"]={ctime=1792189296974035793,inode=1172898,mtime=1454600802000000000,sha1="2fcf09a937abb4c162acc1d7d81219f9185368c2",size=1667.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0}},valid=true,value="lfsu.lua"},["luaIO.run/46754a65d2a115bc238b6a7687652038430f22be"]={buildName="luaIO.run/30",sources={["./list.lua"]={ctime=1792179886845646160,inode=1171621,mtime=1454600802000000000,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["./object.lua"]={ctime=1792179886845646160,inode=1171623,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["./serialize.lua"]={ctime=1792179886845646160,inode=1171631,mtime=1454600802000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["list.lua"]={ctime=1792179886845646160,inode=1171621,mtime=1454600802000000000,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["list_q.lua"]={ctime=1792179886845646160,inode=1171622,mtime=1454600802000000000,sha1="8dfc22488cdbee440937dea6a4a2dcc4c2a8fce8",size=8647.0}},valid=true,value="list.lua"},["luaIO.run/4a1573840f3925ad409583f66d71e8231aae4fcb"]={buildName="luaIO.run/8",graphKey="luaIO.run/e700e123e8a0ed6321636c349b94b67b5035b832",outputs={["heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["heap.lua"]={ctime=1792191938105017341,inode=1171574,mtime=1792191938105017341,sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",size=2247.0},["heap_q.lua"]={ctime=1792191938105017341,inode=1171575,mtime=1792191938105017341,sha1="fb875a65ef8fb415767df7b7792427d4b14ed795",size=1538.0},["object.lua"]={ctime=1792189296974035793,inode=1172914,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0}},valid=true,value="heap.lua"},["luaIO.run/57d7135e26fd66cdcfdf8de331be936bac02be2e"]={buildName="luaIO.run/36",sources={["./heap.lua"]={ctime=1792184453665525963,inode=1171617,mtime=1792184453665525963,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["./object.lua"]={ctime=1792179886845646160,inode=1171623,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["./queue.lua"]={ctime=1792179886845646160,inode=1171629,mtime=1454600802000000000,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["./thread.lua"]={ctime=1792184027452760810,inode=1171634,mtime=1792184027452760810,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["./xpio.lua"]={ctime=1792184317377892780,inode=1171643,mtime=1792184317377892780,sha1="6551921686861ea121658b2423bcc2ddf8b8f207",size=7603.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["thread.lua"]={ctime=1792184027452760810,inode=1171634,mtime=1792184027452760810,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["thread_q.lua"]={ctime=1792184031821673550,inode=1171636,mtime=1792184031821673550,sha1="68a2b2dd0db628136be1f33f93a80f273c37d0fa",size=5269.0}},valid=true,value="thread.lua"},["luaIO.run/5a01a8bab6c5b68541b58aa95777d127d8b81d99"]={buildName="luaIO.run/5",sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792184673070771848,inode=1172105,mtime=1792184673065525963,sha1="4ec87a0f93c37554397b4a8cecf2a1c1272d46f1",size=296152.0},["qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["xpio.lua"]={ctime=1792184643288677619,inode=1171643,mtime=1792184643288677619,sha1="3bf34787507c17c2dc8b9bc899394a033ce1db94",size=8586.0},["xpio_q.lua"]={ctime=1792184602689525963,inode=1171648,mtime=1792184602689525963,sha1="9d9c024b34f3f31a2670c7db42ea0b2e3ad6c1d9",size=9092.0}},valid=true,value="xpio.lua"},["luaIO.run/733742980b003d38f35b7358b623ca9d6fb4b203"]={buildName="luaIO.run/1",graphKey="luaIO.run/e13a02436ed2b05a2688d4d5d8e8e26127a0f50c",outputs={["fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["fsu.lua"]={ctime=1792189296973453132,inode=1172868,mtime=1454600802000000000,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["fsu_q.lua"]={ctime=1792189296974035793,inode=1172910,mtime=1454600802000000000,sha1="1d95449d85c35f1b6da283bf2eda4b34ffc76099",size=4597.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0}},valid=true,value="fsu.lua"},["luaIO.run/86c2eca21cba61f7e4d6b11b022cfb36972e6451"]={buildName="luaIO.run/34",sources={["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["./xpio.lua"]={ctime=1792184317377892780,inode=1171643,mtime=1792184317377892780,sha1="6551921686861ea121658b2423bcc2ddf8b8f207",size=7603.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["xpio.lua"]={ctime=1792184317377892780,inode=1171643,mtime=1792184317377892780,sha1="6551921686861ea121658b2423bcc2ddf8b8f207",size=7603.0},["xpio_q.lua"]={ctime=1792184328213525963,inode=1171648,mtime=1792184328213525963,sha1="5b7a262e3ac0b603652b23699146abafc5457768",size=8445.0}},valid=true,value="xpio.lua"},["luaIO.run/88caf1cff700b65d0c2bd1e12202855bdb3a8d64"]={buildName="luaIO.run/31",sources={["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["qtest_q.lua"]={ctime=1792179886845646160,inode=1171628,mtime=1454600802000000000,sha1="172cbcd9f6cc6cb9a794435b82f9166da2b4999b",size=3089.0}},valid=true,value="qtest.lua"},["luaIO.run/9156a5ebbdc7567791c027ad29d808fcfac07773"]={buildName="luaIO.run/16",sources={["./object.lua"]={ctime=1792179886845646160,inode=1171623,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["./queue.lua"]={ctime=1792179886845646160,inode=1171629,mtime=1454600802000000000,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["queue.lua"]={ctime=1792179886845646160,inode=1171629,mtime=1454600802000000000,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["queue_q.lua"]={ctime=1792179886845646160,inode=1171630,mtime=1454600802000000000,sha1="3904d9a85288440a846168e695ebde5ae8f047b1",size=752.0}},valid=true,value="queue.lua"},["luaIO.run/923d23608cc6867e3de950fe4e0804fbd1396b37"]={buildName="luaIO.run/13",sources={["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["./serialize.lua"]={ctime=1792179886845646160,inode=1171631,mtime=1454600802000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["serialize.lua"]={ctime=1792179886845646160,inode=1171631,mtime=1454600802000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["serialize_q.lua"]={ctime=1792179886845646160,inode=1171632,mtime=1454600802000000000,sha1="aea13d84b21bc4ac7ed10f1f0a076041e5afbf80",size=1176.0}},valid=true,value="serialize.lua"},["luaIO.run/9962d5ae87c88cc2c22b6e93e5137fca809fbd6b"]={buildName="luaIO.run/40",outputs={["xpexec.lua"]="fb4c5b8b506467878ecc0fe73ad6a726219e2afc"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792190929574514506,inode=1171507,mtime=1792190929574496756,sha1="bc7d21822f43730abc456685c5878a3e61df87b2",size=301280.0},["list.lua"]={ctime=1792189296974035793,inode=1172917,mtime=1454600802000000000,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["object.lua"]={ctime=1792189296974035793,inode=1172914,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["serialize.lua"]={ctime=1792189296974035793,inode=1172896,mtime=1454600802000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["xpexec.lua"]={ctime=1792189296973453132,inode=1172867,mtime=1454600802000000000,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["xpexec_q.lua"]={ctime=1792189296968527394,inode=1172736,mtime=1454600802000000000,sha1="a2292688586d910881490319c272568b53316891",size=2473.0}},valid=true,value="xpexec.lua"},["luaIO.run/9f9766f3f1e0107314a8512269d218a8b15b1839"]={buildName="luaIO.run/39",outputs={["xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792190929574514506,inode=1171507,mtime=1792190929574496756,sha1="bc7d21822f43730abc456685c5878a3e61df87b2",size=301280.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["xpio.lua"]={ctime=1792190875616753160,inode=1172902,mtime=1792190875616753160,sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c",size=8617.0},["xpio_q.lua"]={ctime=1792190951154126140,inode=1172907,mtime=1792190951154126140,sha1="066b3a1e4856310d220090376ebef1acbb9eea06",size=11704.0}},valid=true,value="xpio.lua"},["luaIO.run/a8a7d32604b7493dfa4b63c05d0a4b3359dd7e95"]={buildName="luaIO.run/19",sources={["./fsu.lua"]={ctime=1792179886845646160,inode=1171613,mtime=1454600802000000000,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["./lfsu.lua"]={ctime=1792179886845646160,inode=1171619,mtime=1454600802000000000,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["lfsu.lua"]={ctime=1792179886845646160,inode=1171619,mtime=1454600802000000000,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["lfsu_q.lua"]={ctime=1792179886845646160,inode=1171620,mtime=1454600802000000000,sha1="2fcf09a937abb4c162acc1d7d81219f9185368c2",size=1667.0}},valid=true,value="lfsu.lua"},["luaIO.run/aa11683c1bc891ab2000d1ee7740b7b66b03ea1a"]={buildName="luaIO.run/2",graphKey="luaIO.run/270194cbf15f0dbca87adcbaa9b2bbc0cca50ddb",outputs={["list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["list.lua"]={ctime=1792189296974035793,inode=1172917,mtime=1454600802000000000,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["list_q.lua"]={ctime=1792189296974035793,inode=1172894,mtime=1454600802000000000,sha1="8dfc22488cdbee440937dea6a4a2dcc4c2a8fce8",size=8647.0},["object.lua"]={ctime=1792189296974035793,inode=1172914,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["serialize.lua"]={ctime=1792189296974035793,inode=1172896,mtime=1454600802000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0}},valid=true,value="list.lua"},["luaIO.run/af5f89503768a6ec6532ab6fb0d35eb23aed1984"]={buildName="luaIO.run/42",graphKey="luaIO.run/15d390e21e4d8efdc010ce38f5ff2182b8d30608",outputs={["xpexec.lua"]="fb4c5b8b506467878ecc0fe73ad6a726219e2afc"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["list.lua"]={ctime=1792189296974035793,inode=1172917,mtime=1454600802000000000,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["object.lua"]={ctime=1792189296974035793,inode=1172914,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["serialize.lua"]={ctime=1792189296974035793,inode=1172896,mtime=1454600802000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["xpexec.lua"]={ctime=1792189296973453132,inode=1172867,mtime=1454600802000000000,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["xpexec_q.lua"]={ctime=1792189296968527394,inode=1172736,mtime=1454600802000000000,sha1="a2292688586d910881490319c272568b53316891",size=2473.0}},valid=true,value="xpexec.lua"},["luaIO.run/c539e68f5704e14037460eae1095be1aec8b79a1"]={buildName="luaIO.run/25",sources={["./heap.lua"]={ctime=1792184453665525963,inode=1171617,mtime=1792184453665525963,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["./object.lua"]={ctime=1792179886845646160,inode=1171623,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["heap.lua"]={ctime=1792184453665525963,inode=1171617,mtime=1792184453665525963,sha1="a00d42a11fbcf141902cc317b27fb2edec6d9b10",size=1075.0},["heap_q.lua"]={sha1="831116bf56a3766a620f9a4973275474cd4e8835"}},valid=true,value="heap.lua"},["luaIO.run/cc6c52846a8a185769343e93f8306e180edf5b8a"]={buildName="luaIO.run/35",sources={["./list.lua"]={ctime=1792179886845646160,inode=1171621,mtime=1454600802000000000,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["./object.lua"]={ctime=1792179886845646160,inode=1171623,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["./serialize.lua"]={ctime=1792179886845646160,inode=1171631,mtime=1454600802000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["xpexec.lua"]={ctime=1792179886845646160,inode=1171638,mtime=1454600802000000000,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["xpexec_q.lua"]={ctime=1792179886845646160,inode=1171639,mtime=1454600802000000000,sha1="a2292688586d910881490319c272568b53316891",size=2473.0}},valid=true,value="xpexec.lua"},["luaIO.run/de4620fe91245df88d68d648e53e44d187173b78"]={buildName="luaIO.run/14",sources={["./object.lua"]={ctime=1792179886845646160,inode=1171623,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["./qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},[".flake/luaIO.program/2/interpreter"]={sha1="ea9b6ffc1e28876f5b34b2afd33155a0c20c4162"},["object.lua"]={ctime=1792179886845646160,inode=1171623,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["object_q.lua"]={ctime=1792179886845646160,inode=1171625,mtime=1454600802000000000,sha1="daae5bc05b5be2ab6a852b29a5e1963e60c737db",size=1035.0}},valid=true,value="object.lua"},["luaIO.run/ea8f831afb70a260ff4ffb146acaec28494279da"]={buildName="luaIO.run/3",graphKey="luaIO.run/ae122173692e23cd191a89a05fd27e9843b281da",outputs={["serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["serialize.lua"]={ctime=1792189296974035793,inode=1172896,mtime=1454600802000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["serialize_q.lua"]={ctime=1792189296973453132,inode=1172876,mtime=1454600802000000000,sha1="aea13d84b21bc4ac7ed10f1f0a076041e5afbf80",size=1176.0}},valid=true,value="serialize.lua"},["luaIO.run/ef821d9bac5ae9d17a37e8a8c1d8e2cf2cdd6924"]={buildName="luaIO.run/10",graphKey="luaIO.run/fbeec704c306ba00a83ed0e384f384d4eb1c6f37",outputs={["queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["object.lua"]={ctime=1792189296974035793,inode=1172914,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["queue.lua"]={ctime=1792189296974035793,inode=1172900,mtime=1454600802000000000,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["queue_q.lua"]={ctime=1792189296973453132,inode=1172874,mtime=1454600802000000000,sha1="3904d9a85288440a846168e695ebde5ae8f047b1",size=752.0}},valid=true,value="queue.lua"},["luaIO.run/f69d18aa437f93f46ed90fe092dd3ed940056cfa"]={buildName="luaIO.run/37",sources={}},["luaIO.run/f826bbe439d5dc4377e85e1024c2c1efccefdfc0"]={buildName="luaIO.run/7",graphKey="luaIO.run/21f8651fcd73baa264d048eaefc31f4204979804",outputs={["thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["heap.lua"]={ctime=1792191938105017341,inode=1171574,mtime=1792191938105017341,sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",size=2247.0},["object.lua"]={ctime=1792189296974035793,inode=1172914,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["queue.lua"]={ctime=1792189296974035793,inode=1172900,mtime=1454600802000000000,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["thread.lua"]={ctime=1792191937901352862,inode=1171577,mtime=1792191937901352862,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["thread_q.lua"]={ctime=1792191937901352862,inode=1171579,mtime=1792191937901352862,sha1="68a2b2dd0db628136be1f33f93a80f273c37d0fa",size=5269.0},["xpio.lua"]={ctime=1792191938095900705,inode=1171587,mtime=1792191938095900705,sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c",size=8617.0}},valid=true,value="thread.lua"},["luaIO.run/f9fc3cc730d10e97bb71cc5ba76a5a906784551d"]={buildName="luaIO.run/12",graphKey="luaIO.run/960485a04e7882bd9176a2a2f7f99de5776f5eb6",outputs={["getopts.lua"]="41a0b573b7144c50cac86d2083f3ccfb3438ad25"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["getopts.lua"]={ctime=1792189296974035793,inode=1172911,mtime=1454600802000000000,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["getopts_q.lua"]={ctime=1792189296974035793,inode=1172915,mtime=1454600802000000000,sha1="7a383be23918bbe3c8dcf834b98f774092871275",size=1735.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0}},valid=true,value="getopts.lua"},["luaIO.run/fcf3a910a41f1d239876945c6eae470dab5c9bb6"]={buildName="luaIO.run/6",sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792184673070771848,inode=1172105,mtime=1792184673065525963,sha1="4ec87a0f93c37554397b4a8cecf2a1c1272d46f1",size=296152.0},["list.lua"]={ctime=1792179886845646160,inode=1171621,mtime=1454600802000000000,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["object.lua"]={ctime=1792179886845646160,inode=1171623,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["qtest.lua"]={ctime=1792179886845646160,inode=1171627,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["serialize.lua"]={ctime=1792179886845646160,inode=1171631,mtime=1454600802000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["xpexec.lua"]={ctime=1792179886845646160,inode=1171638,mtime=1454600802000000000,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["xpexec_q.lua"]={ctime=1792179886845646160,inode=1171639,mtime=1454600802000000000,sha1="a2292688586d910881490319c272568b53316891",size=2473.0}},valid=true,value="xpexec.lua"},["luaIO.run/ffb16582d2cd81c7e7baedd44ee92b79ea996681"]={buildName="luaIO.run/11",graphKey="luaIO.run/35d6fe4d9d9d32776ca1e1e982e37261c12e6f7b",outputs={["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb"},sources={[".flake/luaIO.program/1/interpreter"]={ctime=1792192727741547526,inode=1171507,mtime=1792192727741510260,sha1="db4742556f7a061b48d1f60c19d39cfd18757685",size=301280.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["qtest_q.lua"]={ctime=1792189296974035793,inode=1172916,mtime=1454600802000000000,sha1="172cbcd9f6cc6cb9a794435b82f9166da2b4999b",size=3089.0}},valid=true,value="qtest.lua"},["luaIO.tools/bf21a9e8fbc5a3846fb05b4fa0859e0917b2202f"]={buildName="luaIO.tools/1",sources={},valid=true,value={contents={inc={["lauxlib.h"]=".flake/luaIO.tools/1/inc/lauxlib.h",["lua.h"]=".flake/luaIO.tools/1/inc/lua.h",["luaconf.h"]=".flake/luaIO.tools/1/inc/luaconf.h",["lualib.h"]=".flake/luaIO.tools/1/inc/lualib.h"},lib={["liblua.lib"]=".flake/luaIO.tools/1/lib/liblua.lib"},src={["cfromlua.lua"]=".flake/luaIO.tools/1/src/cfromlua.lua",["interpreter.lua"]=".flake/luaIO.tools/1/src/interpreter.lua"}},path=".flake/luaIO.tools/1"}},["systemIO.directory/5d0ade379dfa790e94e5e2521c7f9e94ed5c2433"]={buildName="systemIO.directory/1",graphKey="systemIO.directory/65e3de9218097971baf15d711898808ddf9777ce",outputs={["out/release/fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["out/release/getopts.lua"]="41a0b573b7144c50cac86d2083f3ccfb3438ad25",["out/release/heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["out/release/lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["out/release/list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["out/release/object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["out/release/procdemo.lua"]="24b76116ef7d14d5fdd70fa650e8522e9accfcd7",["out/release/qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["out/release/queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["out/release/serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["out/release/thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["out/release/xpexec.lua"]="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",["out/release/xpfs.lib"]="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",["out/release/xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["out/release/xpio_c.lib"]="5c6f60488301dca811f1e07511c8e0217cab9c60"},sources={[".flake/cIO.object/1/xpfs.lib"]={ctime=1792191994638331781,inode=1171512,mtime=1792191994638331781,sha1="2775d05f3bfb9c2605f7b3fb4c0a1f65aaf3b5be",size=12502.0},[".flake/cIO.object/2/xpio_c.lib"]={ctime=1792192727634447245,inode=1171775,mtime=1792192727634447245,sha1="4a1390686ce95d1c4a734781fea61648e326f07f",size=70696.0},["fsu.lua"]={ctime=1792189296973453132,inode=1172868,mtime=1454600802000000000,sha1="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",size=8210.0},["getopts.lua"]={ctime=1792189296974035793,inode=1172911,mtime=1454600802000000000,sha1="41a0b573b7144c50cac86d2083f3ccfb3438ad25",size=5855.0},["heap.lua"]={ctime=1792191938105017341,inode=1171574,mtime=1792191938105017341,sha1="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",size=2247.0},["lfsu.lua"]={ctime=1792189296973453132,inode=1172872,mtime=1454600802000000000,sha1="875434cb7808e599e3df8a85f17d7ebce527c495",size=2554.0},["list.lua"]={ctime=1792189296974035793,inode=1172917,mtime=1454600802000000000,sha1="ee759597989305d90572e637f34c2ae1ce0d5737",size=5299.0},["object.lua"]={ctime=1792189296974035793,inode=1172914,mtime=1454600802000000000,sha1="d69b0c8869f070db83f431164d417851153db04f",size=676.0},["procdemo.lua"]={ctime=1792189296974035793,inode=1172895,mtime=1454600802000000000,sha1="24b76116ef7d14d5fdd70fa650e8522e9accfcd7",size=1589.0},["qtest.lua"]={ctime=1792189296974035793,inode=1172905,mtime=1454600802000000000,sha1="142fd7130f60d4eed83b52cef2bc1ebf24aababb",size=13597.0},["queue.lua"]={ctime=1792189296974035793,inode=1172900,mtime=1454600802000000000,sha1="892c54ad53db8fb2b36404fb769db58c205380ca",size=1026.0},["serialize.lua"]={ctime=1792189296974035793,inode=1172896,mtime=1454600802000000000,sha1="0c427d032b8703f5e22d810d4370cc9d7c995c74",size=4036.0},["thread.lua"]={ctime=1792191937901352862,inode=1171577,mtime=1792191937901352862,sha1="131fbadfcdf8fb061c1d261153ccde807d87a405",size=8407.0},["xpexec.lua"]={ctime=1792189296973453132,inode=1172867,mtime=1454600802000000000,sha1="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",size=5282.0},["xpio.lua"]={ctime=1792191938095900705,inode=1171587,mtime=1792191938095900705,sha1="d945faac6fefa495e168cd65ebec08d2b16d3f2c",size=8617.0}},valid=true,value={contents={["fsu.lua"]="out/release/fsu.lua",["getopts.lua"]="out/release/getopts.lua",["heap.lua"]="out/release/heap.lua",["lfsu.lua"]="out/release/lfsu.lua",["list.lua"]="out/release/list.lua",["object.lua"]="out/release/object.lua",["procdemo.lua"]="out/release/procdemo.lua",["qtest.lua"]="out/release/qtest.lua",["queue.lua"]="out/release/queue.lua",["serialize.lua"]="out/release/serialize.lua",["thread.lua"]="out/release/thread.lua",["xpexec.lua"]="out/release/xpexec.lua",["xpfs.lib"]="out/release/xpfs.lib",["xpio.lua"]="out/release/xpio.lua",["xpio_c.lib"]="out/release/xpio_c.lib"},path="out/release"}},["systemIO.find/af1c401bc584516bf7d87203901216aee69a040d"]={buildName="systemIO.find/1",graphKey="systemIO.find/af1c401bc584516bf7d87203901216aee69a040d",outputs={["build.lua"]="8b945c62c1956a8721b5febcd5c8beb7d73c1dd2",["fsu.lua"]="78bcdd3ccd0d57c9e6fcf77c7cafe6ac857754be",["fsu_q.lua"]="1d95449d85c35f1b6da283bf2eda4b34ffc76099",["getopts.lua"]="41a0b573b7144c50cac86d2083f3ccfb3438ad25",["getopts_q.lua"]="7a383be23918bbe3c8dcf834b98f774092871275",["heap.lua"]="07855d391b6af8e81cb01d7ef4e2ec03ea90630a",["heap_q.lua"]="fb875a65ef8fb415767df7b7792427d4b14ed795",["lfsu.lua"]="875434cb7808e599e3df8a85f17d7ebce527c495",["lfsu_q.lua"]="2fcf09a937abb4c162acc1d7d81219f9185368c2",["list.lua"]="ee759597989305d90572e637f34c2ae1ce0d5737",["list_q.lua"]="8dfc22488cdbee440937dea6a4a2dcc4c2a8fce8",["object.lua"]="d69b0c8869f070db83f431164d417851153db04f",["object_q.lua"]="daae5bc05b5be2ab6a852b29a5e1963e60c737db",["procdemo.lua"]="24b76116ef7d14d5fdd70fa650e8522e9accfcd7",["qtest.lua"]="142fd7130f60d4eed83b52cef2bc1ebf24aababb",["qtest_q.lua"]="172cbcd9f6cc6cb9a794435b82f9166da2b4999b",["queue.lua"]="892c54ad53db8fb2b36404fb769db58c205380ca",["queue_q.lua"]="3904d9a85288440a846168e695ebde5ae8f047b1",["serialize.lua"]="0c427d032b8703f5e22d810d4370cc9d7c995c74",["serialize_q.lua"]="aea13d84b21bc4ac7ed10f1f0a076041e5afbf80",["thread.lua"]="131fbadfcdf8fb061c1d261153ccde807d87a405",["thread_q.lua"]="68a2b2dd0db628136be1f33f93a80f273c37d0fa",["xpexec.lua"]="fb4c5b8b506467878ecc0fe73ad6a726219e2afc",["xpexec_q.lua"]="a2292688586d910881490319c272568b53316891",["xpfs_q.lua"]="a248000f5671ee45636f4d9b548723f02d479797",["xpio.lua"]="d945faac6fefa495e168cd65ebec08d2b16d3f2c",["xpio_c_q.lua"]="33809b2815e581cd6db344bc470ffa35c50fd8cc",["xpio_q.lua"]="066b3a1e4856310d220090376ebef1acbb9eea06"},valid=true,value={"build.lua","fsu.lua","fsu_q.lua","getopts.lua","getopts_q.lua","heap.lua","heap_q.lua","lfsu.lua","lfsu_q.lua","list.lua","list_q.lua","object.lua","object_q.lua","procdemo.lua","qtest.lua","qtest_q.lua","queue.lua","queue_q.lua","serialize.lua","serialize_q.lua","thread.lua","thread_q.lua","xpexec.lua","xpexec_q.lua","xpfs_q.lua","xpio.lua","xpio_c_q.lua","xpio_q.lua"}}}}
\ No newline at end of file
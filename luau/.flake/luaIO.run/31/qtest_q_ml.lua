@@ -0,0 +1,9 @@
+local a = 1
+local function f()
+   return a
+end
+local b = 2
+return {
+  f = f,
+  x = 2
+}
@@ -1,55 +1,107 @@
 local Object = require "object"
 
+-- Heap: a priority queue of objects, ordered by value.  Objects with equal
+-- values are returned in the order they were put.
+--
+-- Entries live in an array-backed binary heap (in self[1...#self]), and
+-- `pos` maps each object to the index of its entry, so put(), get() and
+-- remove() take O(log n) time, and first() takes O(1).  An object may be
+-- in a heap only once at a time.
+
 local Heap = Object:new()
 
 
 function Heap:initialize()
+   self.pos = {}     -- obj -> index of its entry
+   self.seq = 0      -- order of insertion, for equal values
 end
 
-function Heap:put(obj, value)
-   table.insert(self, {obj=obj, value=value})
+
+local function less(a, b)
+   return a.value < b.value or (a.value == b.value and a.seq < b.seq)
 end
 
--- Return the object with the least value. This is *not* optimal and
--- hopefully will be replaced with something optimized to timer user cases
--- (once we have timer use cases).
---
-function Heap:minPos()
-   if #self > 0 then
-      local minpos = 1
-      local minvalue = self[minpos].value
-      for n = 2, #self do
-         if self[n].value < minvalue then
-            minpos = n
-            minvalue = self[minpos].value
-         end
+
+local function place(self, n, e)
+   self[n] = e
+   self.pos[e.obj] = n
+end
+
+
+local function siftUp(self, n)
+   local e = self[n]
+   while n > 1 do
+      local parent = n // 2
+      if not less(e, self[parent]) then
+         break
       end
-      return minpos
+      place(self, n, self[parent])
+      n = parent
    end
+   place(self, n, e)
 end
 
-function Heap:first()
-   local n = self:minPos()
-   if n then
-      return self[n].obj
+
+local function siftDown(self, n)
+   local e = self[n]
+   local size = #self
+   while true do
+      local child = n * 2
+      if child > size then
+         break
+      end
+      if child < size and less(self[child+1], self[child]) then
+         child = child + 1
+      end
+      if not less(self[child], e) then
+         break
+      end
+      place(self, n, self[child])
+      n = child
    end
+   place(self, n, e)
+end
+
+
+local function removeAt(self, n)
+   local e = self[n]
+   local size = #self
+   local last = self[size]
+   self[size] = nil
+   self.pos[e.obj] = nil
+   if n < size then
+      place(self, n, last)
+      siftDown(self, n)
+      siftUp(self, self.pos[last.obj])
+   end
+   return e.obj
+end
+
+
+function Heap:put(obj, value)
+   assert(not self.pos[obj], "heap: object already present")
+   self.seq = self.seq + 1
+   self[#self+1] = {obj=obj, value=value, seq=self.seq}
+   siftUp(self, #self)
+end
+
+-- Return the object with the least value.
+--
+function Heap:first()
+   local e = self[1]
+   return e and e.obj
 end
 
 function Heap:get()
-   local n = self:minPos()
-   if n then
-      local obj = self[n].obj
-      table.remove(self, n)
-      return obj
+   if self[1] then
+      return removeAt(self, 1)
    end
 end
 
 function Heap:remove(obj)
-   for n = 1, #self do
-      if rawequal(self[n].obj, obj) then
-         table.remove(self, n)
-         return obj
-      end
+   local n = self.pos[obj]
+   if n then
+      return removeAt(self, n)
    end
 end
 
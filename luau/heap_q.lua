@@ -24,3 +24,64 @@ eq(h:get(), "d")
 eq(h:first(), nil)
 eq(h:get(), nil)
 eq(h:first(), nil)
+
+
+-- equal values come out in the order they were put
+
+h:put("x1", 5)
+h:put("y", 1)
+h:put("x2", 5)
+h:put("x3", 5)
+eq(h:get(), "y")
+eq(h:get(), "x1")
+eq(h:remove("x2"), "x2")
+eq(h:remove("x2"), nil)
+eq(h:get(), "x3")
+eq(h:get(), nil)
+
+
+-- random puts and removes agree with a sorted array
+
+math.randomseed(1)
+local expected = {}
+for n = 1, 500 do
+   local v = math.random(1, 50)
+   h:put(n, v)
+   expected[#expected+1] = {n = n, v = v}
+end
+for n = 1, 500, 3 do
+   eq(h:remove(n), n)
+end
+local kept = {}
+for _, e in ipairs(expected) do
+   if e.n % 3 ~= 1 then
+      kept[#kept+1] = e
+   end
+end
+table.sort(kept, function (a, b)
+   return a.v < b.v or (a.v == b.v and a.n < b.n)
+end)
+for _, e in ipairs(kept) do
+   eq(h:first(), e.n)
+   eq(h:get(), e.n)
+end
+eq(h:first(), nil)
+
+
+-- benchmark: many sleepers, each removed before it is due
+
+local function bench(size)
+   local b = Heap:new()
+   local t0 = os.clock()
+   for n = 1, size do
+      b:put(n, math.random())
+   end
+   for n = 1, size, 2 do
+      b:remove(n)
+   end
+   while b:get() do end
+   local elapsed = os.clock() - t0
+   print(("heap: %d entries: %.2f us per entry"):format(size, elapsed * 1e6 / size))
+end
+bench(1000)
+bench(100000)
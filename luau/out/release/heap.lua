@@ -0,0 +1,109 @@
+local Object = require "object"
+
+-- Heap: a priority queue of objects, ordered by value.  Objects with equal
+-- values are returned in the order they were put.
+--
+-- Entries live in an array-backed binary heap (in self[1...#self]), and
+-- `pos` maps each object to the index of its entry, so put(), get() and
+-- remove() take O(log n) time, and first() takes O(1).  An object may be
+-- in a heap only once at a time.
+
+local Heap = Object:new()
+
+
+function Heap:initialize()
+   self.pos = {}     -- obj -> index of its entry
+   self.seq = 0      -- order of insertion, for equal values
+end
+
+
+local function less(a, b)
+   return a.value < b.value or (a.value == b.value and a.seq < b.seq)
+end
+
+
+local function place(self, n, e)
+   self[n] = e
+   self.pos[e.obj] = n
+end
+
+
+local function siftUp(self, n)
+   local e = self[n]
+   while n > 1 do
+      local parent = n // 2
+      if not less(e, self[parent]) then
+         break
+      end
+      place(self, n, self[parent])
+      n = parent
+   end
+   place(self, n, e)
+end
+
+
+local function siftDown(self, n)
+   local e = self[n]
+   local size = #self
+   while true do
+      local child = n * 2
+      if child > size then
+         break
+      end
+      if child < size and less(self[child+1], self[child]) then
+         child = child + 1
+      end
+      if not less(self[child], e) then
+         break
+      end
+      place(self, n, self[child])
+      n = child
+   end
+   place(self, n, e)
+end
+
+
+local function removeAt(self, n)
+   local e = self[n]
+   local size = #self
+   local last = self[size]
+   self[size] = nil
+   self.pos[e.obj] = nil
+   if n < size then
+      place(self, n, last)
+      siftDown(self, n)
+      siftUp(self, self.pos[last.obj])
+   end
+   return e.obj
+end
+
+
+function Heap:put(obj, value)
+   assert(not self.pos[obj], "heap: object already present")
+   self.seq = self.seq + 1
+   self[#self+1] = {obj=obj, value=value, seq=self.seq}
+   siftUp(self, #self)
+end
+
+-- Return the object with the least value.
+--
+function Heap:first()
+   local e = self[1]
+   return e and e.obj
+end
+
+function Heap:get()
+   if self[1] then
+      return removeAt(self, 1)
+   end
+end
+
+function Heap:remove(obj)
+   local n = self.pos[obj]
+   if n then
+      return removeAt(self, n)
+   end
+end
+
+
+return Heap
@@ -0,0 +1,313 @@
+----------------------------------------------------------------
+-- serialize.lua
+--
+-- Exports:
+--
+--  orderedPairs : deterministically ordered version of pairs()
+--
+--  serialize : convert Lua value to string in Lua syntax
+--
+----------------------------------------------------------------
+
+
+-- orderedPairs: iterate over table elements in deterministic order.  First,
+-- array elements are returned, then remaining elements sorted by the key's
+-- type and value.
+
+-- compare any two Lua values, establishing a complete ordering
+local function ltAny(a,b)
+   local ta, tb = type(a), type(b)
+   if ta ~= tb then
+      return ta < tb
+   end
+   if ta == "string" or ta == "number" then
+      return a < b
+   end
+   return tostring(a) < tostring(b)
+end
+
+local inext = ipairs{}
+
+local function orderedPairs(t)
+   local keys = {}
+   local keyIndex = 1
+   local counting = true
+
+   local function _next(seen, s)
+      local v
+
+      if counting then
+         -- return next array index
+         s, v = inext(t, s)
+         if s ~= nil then
+            seen[s] = true
+            return s,v
+         end
+         counting = false
+
+         -- construct sorted unseen keys
+         for k,v in pairs(t) do
+            if not seen[k] then
+               table.insert(keys, k)
+            end
+         end
+         table.sort(keys, ltAny)
+      end
+
+      -- return next unseen table element
+      s = keys[keyIndex]
+      if s ~= nil then
+         keyIndex = keyIndex + 1
+         v = t[s]
+      end
+      return s, v
+   end
+
+   return _next, {}, 0
+end
+
+
+-- avoid 'nan', 'inf', and '-inf'
+local numtostring = {
+   [tostring(-1/0)] = "-1/0",
+   [tostring(1/0)] = "1/0",
+   [tostring(0/0)] = "0/0"
+}
+
+setmetatable(numtostring, { __index = function (t, k) return k end })
+
+-- serialize:  Serialize a Lua data structure
+--
+--   x    = value to serialize
+--   out  = function to be called repeatedly with strings, or
+--          table into which strings should be inserted, or
+--          nil => return a string
+--   iter = function to iterate over table elements, or
+--          "s" to sort elements by key, or
+--          nil for default (fastest)
+--
+-- Notes:
+--   * Does not support self-referential data structures.
+--   * Does not optimize for repeated sub-expressions.
+--   * Does not preserve topology; only values.
+--   * Does not handle types other than nil, number, boolean, string, table
+--
+local function serialize(x, out, iter)
+   local visited = {}
+   local iter = iter=="s" and orderedPairs or iter or pairs
+   assert(type(iter) == "function")
+
+   local function _serialize(x)
+      if type(x) == "string" then
+
+         out(string.format("%q", x))
+
+      elseif type(x) == "number" then
+
+         out(numtostring[tostring(x)])
+
+      elseif type(x) == "boolean" or
+             type(x) == "nil" then
+
+         out(tostring(x))
+
+      elseif type(x) == "table" then
+
+         if visited[x] then
+            error("serialize: recursive structure")
+         end
+         visited[x] = true
+         local first, nextIndex = true, 1
+
+         out "{"
+
+         for k,v in iter(x) do
+            if first then
+               first = false
+            else
+               out ","
+            end
+            if k == nextIndex then
+               nextIndex = nextIndex + 1
+            else
+               if type(k) == "string" and k:match("^[%a_][%w_]*$") then
+                  out(k.."=")
+               else
+                  out "["
+                  _serialize(k)
+                  out "]="
+               end
+            end
+            _serialize(v)
+         end
+
+         out "}"
+         visited[x] = false
+      else
+         error("serialize: unsupported type")
+      end
+   end
+
+   local result
+   if not out then
+      result = {}
+      out = result
+   end
+
+   if type(out) == "table" then
+      local t = out
+      function out(s)
+         table.insert(t,s)
+      end
+   end
+
+   _serialize(x)
+
+   if result then
+      return table.concat(result)
+   end
+end
+
+
+-- deserialize:  Read a value written by serialize
+--
+--   s = string holding one serialized value
+--
+-- Returns the value, or nil and an error message.  Unlike load(), this
+-- accepts only data -- no code runs -- so `s` may come from an untrusted
+-- source.
+--
+
+local escapes = {
+   a = "\a", b = "\b", f = "\f", n = "\n", r = "\r", t = "\t", v = "\v",
+   ["\\"] = "\\", ['"'] = '"', ["'"] = "'", ["\n"] = "\n",
+}
+
+local specialNumbers = { ["1/0"] = 1/0, ["-1/0"] = -1/0, ["0/0"] = 0/0 }
+
+local function deserialize(s)
+   local pos = 1
+
+   local function fail(msg)
+      error({ "deserialize: " .. msg .. " at offset " .. pos }, 0)
+   end
+
+   local function skip()
+      pos = s:match("^%s*()", pos)
+   end
+
+   local function readString()
+      local parts = {}
+      pos = pos + 1
+      while true do
+         local text, c, nextPos = s:match('^([^"\\\n]*)(.?)()', pos)
+         table.insert(parts, text)
+         pos = nextPos
+         if c == '"' then
+            return table.concat(parts)
+         elseif c ~= "\\" then
+            fail("unfinished string")
+         end
+         local digits = s:match("^%d%d?%d?", pos)
+         local e = digits and tonumber(digits) < 256 and string.char(tonumber(digits))
+                   or not digits and escapes[s:sub(pos, pos)]
+         if not e then
+            fail("invalid escape")
+         end
+         table.insert(parts, e)
+         pos = pos + (digits and #digits or 1)
+      end
+   end
+
+   local readValue
+
+   local function readTable()
+      local t, n = {}, 1
+      pos = pos + 1
+      skip()
+      while s:sub(pos, pos) ~= "}" do
+         local k
+         local name, afterName = s:match("^([%a_][%w_]*)%s*=()", pos)
+         if s:sub(pos, pos) == "[" then
+            pos = pos + 1
+            k = readValue()
+            if k == nil or k ~= k then
+               fail("invalid key")
+            end
+            local afterKey = s:match("^%s*%]%s*=()", pos)
+            if not afterKey then
+               fail("expected ']='")
+            end
+            pos = afterKey
+         elseif name then
+            k, pos = name, afterName
+         else
+            k, n = n, n + 1
+         end
+         t[k] = readValue()
+         skip()
+         local c = s:sub(pos, pos)
+         if c == "," or c == ";" then
+            pos = pos + 1
+            skip()
+         elseif c ~= "}" then
+            fail("expected '}'")
+         end
+      end
+      pos = pos + 1
+      return t
+   end
+
+   function readValue()
+      skip()
+      local c = s:sub(pos, pos)
+      if c == '"' then
+         return readString()
+      elseif c == "{" then
+         return readTable()
+      end
+      local word, afterWord = s:match("^([%a_][%w_]*)()", pos)
+      if word == "true" or word == "false" then
+         pos = afterWord
+         return word == "true"
+      elseif word == "nil" then
+         pos = afterWord
+         return nil
+      end
+      local num, afterNum = s:match("^(%-?%d[%w%.]*[eE][%+%-]?%d+)()", pos)
+      if not num then
+         num, afterNum = s:match("^(%-?%d[%w%.]*)()", pos)
+      end
+      if num then
+         local special = s:match("^/0()", afterNum)
+         if special and specialNumbers[num .. "/0"] then
+            pos = special
+            return specialNumbers[num .. "/0"]
+         end
+         pos = afterNum
+         return tonumber(num) or fail("invalid number")
+      end
+      fail("unexpected " .. (c == "" and "end of data" or "'" .. c .. "'"))
+   end
+
+   local ok, value = pcall(function()
+      local v = readValue()
+      skip()
+      if pos <= #s then
+         fail("unexpected data after value")
+      end
+      return v
+   end)
+   if ok then
+      return value
+   elseif type(value) == "table" then
+      return nil, value[1]
+   end
+   return nil, "deserialize: " .. tostring(value)
+end
+
+return {
+   deserialize = deserialize,
+   orderedPairs = orderedPairs,
+   serialize = serialize
+}
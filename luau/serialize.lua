@@ -168,7 +168,146 @@ local function serialize(x, out, iter)
    end
 end
 
+
+-- deserialize:  Read a value written by serialize
+--
+--   s = string holding one serialized value
+--
+-- Returns the value, or nil and an error message.  Unlike load(), this
+-- accepts only data -- no code runs -- so `s` may come from an untrusted
+-- source.
+--
+
+local escapes = {
+   a = "\a", b = "\b", f = "\f", n = "\n", r = "\r", t = "\t", v = "\v",
+   ["\\"] = "\\", ['"'] = '"', ["'"] = "'", ["\n"] = "\n",
+}
+
+local specialNumbers = { ["1/0"] = 1/0, ["-1/0"] = -1/0, ["0/0"] = 0/0 }
+
+local function deserialize(s)
+   local pos = 1
+
+   local function fail(msg)
+      error({ "deserialize: " .. msg .. " at offset " .. pos }, 0)
+   end
+
+   local function skip()
+      pos = s:match("^%s*()", pos)
+   end
+
+   local function readString()
+      local parts = {}
+      pos = pos + 1
+      while true do
+         local text, c, nextPos = s:match('^([^"\\\n]*)(.?)()', pos)
+         table.insert(parts, text)
+         pos = nextPos
+         if c == '"' then
+            return table.concat(parts)
+         elseif c ~= "\\" then
+            fail("unfinished string")
+         end
+         local digits = s:match("^%d%d?%d?", pos)
+         local e = digits and tonumber(digits) < 256 and string.char(tonumber(digits))
+                   or not digits and escapes[s:sub(pos, pos)]
+         if not e then
+            fail("invalid escape")
+         end
+         table.insert(parts, e)
+         pos = pos + (digits and #digits or 1)
+      end
+   end
+
+   local readValue
+
+   local function readTable()
+      local t, n = {}, 1
+      pos = pos + 1
+      skip()
+      while s:sub(pos, pos) ~= "}" do
+         local k
+         local name, afterName = s:match("^([%a_][%w_]*)%s*=()", pos)
+         if s:sub(pos, pos) == "[" then
+            pos = pos + 1
+            k = readValue()
+            if k == nil or k ~= k then
+               fail("invalid key")
+            end
+            local afterKey = s:match("^%s*%]%s*=()", pos)
+            if not afterKey then
+               fail("expected ']='")
+            end
+            pos = afterKey
+         elseif name then
+            k, pos = name, afterName
+         else
+            k, n = n, n + 1
+         end
+         t[k] = readValue()
+         skip()
+         local c = s:sub(pos, pos)
+         if c == "," or c == ";" then
+            pos = pos + 1
+            skip()
+         elseif c ~= "}" then
+            fail("expected '}'")
+         end
+      end
+      pos = pos + 1
+      return t
+   end
+
+   function readValue()
+      skip()
+      local c = s:sub(pos, pos)
+      if c == '"' then
+         return readString()
+      elseif c == "{" then
+         return readTable()
+      end
+      local word, afterWord = s:match("^([%a_][%w_]*)()", pos)
+      if word == "true" or word == "false" then
+         pos = afterWord
+         return word == "true"
+      elseif word == "nil" then
+         pos = afterWord
+         return nil
+      end
+      local num, afterNum = s:match("^(%-?%d[%w%.]*[eE][%+%-]?%d+)()", pos)
+      if not num then
+         num, afterNum = s:match("^(%-?%d[%w%.]*)()", pos)
+      end
+      if num then
+         local special = s:match("^/0()", afterNum)
+         if special and specialNumbers[num .. "/0"] then
+            pos = special
+            return specialNumbers[num .. "/0"]
+         end
+         pos = afterNum
+         return tonumber(num) or fail("invalid number")
+      end
+      fail("unexpected " .. (c == "" and "end of data" or "'" .. c .. "'"))
+   end
+
+   local ok, value = pcall(function()
+      local v = readValue()
+      skip()
+      if pos <= #s then
+         fail("unexpected data after value")
+      end
+      return v
+   end)
+   if ok then
+      return value
+   elseif type(value) == "table" then
+      return nil, value[1]
+   end
+   return nil, "deserialize: " .. tostring(value)
+end
+
 return {
+   deserialize = deserialize,
    orderedPairs = orderedPairs,
    serialize = serialize
 }
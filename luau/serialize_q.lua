@@ -38,11 +38,16 @@ local function serTest(x)
    local t3 = {}
    local r = serialize(x, t3)
    qt._eq(str, table.concat(t3), 2)
+
+   -- deserialize reads it back
+   qt._eq(x, S.deserialize(str), 2)
 end
 
 serTest(1)
 serTest("a")
 serTest{"a",7,x="2",[9]={},["a-b"]=false}
+serTest{1.5, -2, 1e300, -0.25, 2^63, math.mininteger}
+serTest{"\0\1\r\n\t\"\\\200\0009", {{}}, [{}]={x={y=true}}}
 
 -- inf, -inf, nan
 serTest(1/0)
@@ -55,3 +60,28 @@ qt.eq( '{9,[false]=true,[true]=false,[5]="b",x="a",y="A"}',
        serialize({y="A", x="a", [5]="b", [false] = true, [true] = false, 9}, nil, "s") )
 
 
+
+---- deserialize
+
+local deserialize = S.deserialize
+
+qt.eq({a=1, 2, [3]="x"}, deserialize(' { a = 1 ; 2, [ 3 ] = "x", } '))
+qt.eq(nil, deserialize("nil"))
+qt.eq(false, deserialize("false"))
+
+-- Only data is accepted.
+local function bad(s)
+   local v, err = deserialize(s)
+   qt._eq(nil, v, 2)
+   qt._eq("string", type(err), 2)
+end
+bad("")
+bad("while true do end")
+bad("return {}")
+bad("{f()}")
+bad("{x=1}{}")
+bad('"abc')
+bad('"a\\q"')
+bad("{[nil]=1}")
+bad("{1 2}")
+bad("os.exit()")
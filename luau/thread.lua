@@ -80,7 +80,7 @@ end
 -- Task class
 thread.Task = {}
 
--- Create a new task
+-- Create a new task.  It inherits the priority of the current task.
 --
 -- Other task members not assigned herein:
 --   me._dequeue
@@ -101,6 +101,7 @@ local function taskNew(dispatch, fn, ...)
    end
 
    me.coroutine = coroutine.create(preamble)
+   me.priority = currentTask and currentTask.priority or 0
    me.dispatch = dispatch
    me.atExits = {}
    me._queue = dispatch._queue
@@ -117,6 +118,16 @@ function thread.new(fn, ...)
 end
 
 
+function thread.getPriority()
+   return currentTask.priority
+end
+
+
+function thread.setPriority(priority)
+   currentTask.priority = priority
+end
+
+
 function thread.yield()
    currentTask:makeReady()
    coroutine.yield()
@@ -298,6 +309,54 @@ function thread.dispatch(func, ...)
 end
 
 
+-- Semaphore class
+thread.Semaphore = {}
+thread.Semaphore.__index = thread.Semaphore
+
+
+-- Create a counting semaphore with `count` available units.
+--
+function thread.semaphore(count)
+   return setmetatable({count = count, waiters = Heap:new()}, thread.Semaphore)
+end
+
+
+local function semDequeue(task)
+   task._dequeuedata:remove(task)
+   task._dequeuedata = nil
+   task._dequeue = nil
+end
+
+
+-- Take one unit, waiting until one is available.  Waiters are served in
+-- order of priority, highest first, and then in FIFO order.
+--
+function thread.Semaphore:acquire()
+   if self.count > 0 then
+      self.count = self.count - 1
+      return
+   end
+   currentTask._dequeue = semDequeue
+   currentTask._dequeuedata = self.waiters
+   self.waiters:put(currentTask, -currentTask.priority)
+   coroutine.yield()
+end
+
+
+-- Return one unit.  It is handed directly to the first waiter, if any, so
+-- that it cannot be taken by a task that has not waited.
+--
+function thread.Semaphore:release()
+   local task = self.waiters:first()
+   if task then
+      task:_dequeue()
+      task:makeReady()
+   else
+      self.count = self.count + 1
+   end
+end
+
+
 function thread.sleepUntil(t)
    currentTask.dispatch.wakeAt(currentTask, t)
    coroutine.yield()
@@ -190,6 +190,55 @@ local function ce3()
 end
 ce3()
 
+-- >> A semaphore admits `count` threads, and resumes waiters in order.
+-- >> Killing a waiter removes it from the semaphore.
+
+local function sem1()
+   local sem = thread.semaphore(2)
+   local function worker(n)
+      sem:acquire()
+      log(n)
+      thread.yield()
+      thread.yield()
+      log(-n)
+      sem:release()
+   end
+   for n = 1, 3 do
+      thread.new(worker, n)
+   end
+   local t4 = thread.new(worker, 4)
+   local t5 = thread.new(worker, 5)
+   thread.yield()
+   thread.kill(t4)
+end
+
+run( {1, 2, -1, -2, 3, 5, -3, -5}, sem1 )
+
+
+-- >> Semaphore waiters are resumed by priority, then in order.
+-- >> Threads inherit the priority of their creator.
+
+local function sem2()
+   local sem = thread.semaphore(0)
+   local function worker(n)
+      sem:acquire()
+      log(n)
+   end
+   for n, priority in ipairs{1, 5, 1, 9} do
+      thread.setPriority(priority)
+      thread.new(worker, n)
+   end
+   thread.setPriority(0)
+   assert(thread.getPriority() == 0)
+   thread.yield()
+   for _ = 1, 4 do
+      sem:release()
+   end
+end
+
+run( {4, 2, 1, 3}, sem2 )
+
+
 local t = xpio.gettime()
 run( {1, 3, 5}, ts1 )
 assert(xpio.gettime() >= t + 0.05)
@@ -11,7 +11,7 @@
 // On Windows, support long paths using utf-8
 
 
-#define _POSIX_C_SOURCE 200112L
+#define _POSIX_C_SOURCE 200809L
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -48,6 +48,11 @@
 #  include <unistd.h>
 #  include <sys/errno.h>
 #  include <dirent.h>
+#  include <fcntl.h>
+#  ifdef __linux__
+#     include <sys/ioctl.h>
+#     include <linux/fs.h>   // FICLONE
+#  endif
 
 #endif
 
@@ -132,6 +137,21 @@ static int xpfs_chmod(lua_State *L)
 
 #define DTIME(st, nm)  ((double) (st).st_##nm##time)
 
+// <st>.st_<nm>time in nanoseconds as an integer
+//
+// POSIX.1-2008 provides st_<nm>tim; MacOS names it st_<nm>timespec.
+// Elsewhere fall back to whole seconds.
+
+#if defined(__APPLE__)
+#  define NSTIME(st, nm)  ((lua_Integer) (st).st_##nm##timespec.tv_sec * 1000000000 + \
+                           (st).st_##nm##timespec.tv_nsec)
+#elif defined(_WIN32)
+#  define NSTIME(st, nm)  ((lua_Integer) (st).st_##nm##time * 1000000000)
+#else
+#  define NSTIME(st, nm)  ((lua_Integer) (st).st_##nm##tim.tv_sec * 1000000000 + \
+                           (st).st_##nm##tim.tv_nsec)
+#endif
+
 // store a time field into a Lua table at the top of the stack
 #define STORETIME(st, nm, field)                                     \
    { lua_pushnumber(L, DTIME(st, nm)); lua_setfield(L, -2, field); }
@@ -213,8 +233,15 @@ static int do_stat(lua_State *L, const char *filename, const char *mask)
          STORETIME(info, c, "ctime");
       }
 
+      if (ch == '*' || ch == 'n') {
+         lua_pushinteger(L, NSTIME(info, m));
+         lua_setfield(L, -2, "mtime_ns");
+         lua_pushinteger(L, NSTIME(info, c));
+         lua_setfield(L, -2, "ctime_ns");
+      }
+
       if (ch == '*' || ch == 'i') {
-         lua_pushnumber(L, (lua_Number) info.st_ino);
+         lua_pushinteger(L, (lua_Integer) info.st_ino);
          lua_setfield(L, -2, "inode");
       }
 
@@ -299,6 +326,33 @@ static int xpfs_mkdir(lua_State *L)
 }
 
 
+//----------------------------------------------------------------
+// mkfifo(filename)
+//----------------------------------------------------------------
+
+static int xpfs_mkfifo(lua_State *L)
+{
+   const char *filename = luaL_checkstring(L, 1);
+
+#ifdef _WIN32
+   (void) filename;
+   lua_pushnil(L);
+   lua_pushstring(L, "mkfifo: not supported");
+   return 2;
+#else
+   if (mkfifo(filename, 0600)) {
+      lua_pushnil(L);
+      lua_pushstring(L, strerror(errno));
+      return 2;
+   }
+
+   // success
+   lua_pushboolean(L, 1);
+   return 1;
+#endif
+}
+
+
 //----------------------------------------------------------------
 // rmdir(dirname)
 //----------------------------------------------------------------
@@ -381,6 +435,101 @@ static int xpfs_rename(lua_State *L)
 }
 
 
+//----------------------------------------------------------------
+// copy(from, to)
+//----------------------------------------------------------------
+
+// Copy file contents and permissions.  Where the file system supports it
+// (e.g. btrfs, XFS), the copy is a reflink that shares storage with the
+// original until either is modified.
+
+#ifdef _WIN32
+
+static int xpfs_copy(lua_State *L)
+{
+   const char *from = luaL_checkstring(L, 1);
+   const char *to = luaL_checkstring(L, 2);
+
+   if (!CopyFileA(from, to, FALSE)) {
+      lua_pushnil(L);
+      lua_pushstring(L, "copy failed");
+      return 2;
+   }
+   lua_pushboolean(L, 1);
+   return 1;
+}
+
+#else
+
+static int xpfs_copy(lua_State *L)
+{
+   const char *from = luaL_checkstring(L, 1);
+   const char *to = luaL_checkstring(L, 2);
+   struct stat info;
+   char buf[65536];
+   ssize_t n = 0;
+   int err = 0;
+   int fdTo;
+   int fdFrom = open(from, O_RDONLY);
+
+   if (fdFrom == -1 || fstat(fdFrom, &info) != 0) {
+      err = errno;
+      goto done;
+   }
+
+   fdTo = open(to, O_WRONLY | O_CREAT | O_TRUNC, info.st_mode & 0777);
+   if (fdTo == -1) {
+      err = errno;
+      goto done;
+   }
+
+#ifdef FICLONE
+   if (ioctl(fdTo, FICLONE, fdFrom) == 0) {
+      n = 0;
+   } else
+#endif
+   while ((n = read(fdFrom, buf, sizeof buf)) > 0) {
+      char *p = buf;
+      while (n > 0) {
+         ssize_t w = write(fdTo, p, n);
+         if (w < 0) {
+            break;
+         }
+         p += w;
+         n -= w;
+      }
+      if (n > 0) {
+         break;
+      }
+   }
+   if (n != 0) {
+      err = errno;
+   }
+   if (fchmod(fdTo, info.st_mode & 0777) != 0 && !err) {
+      err = errno;
+   }
+   if (close(fdTo) != 0 && !err) {
+      err = errno;
+   }
+
+ done:
+   if (fdFrom != -1) {
+      close(fdFrom);
+   }
+   if (err) {
+      lua_pushnil(L);
+      lua_pushstring(L, strerror(err));
+      return 2;
+   }
+
+   // success
+   lua_pushboolean(L, 1);
+   return 1;
+}
+
+#endif
+
+
 //----------------------------------------------------------------
 // dir(dirname)
 //----------------------------------------------------------------
@@ -487,10 +636,12 @@ static const luaL_Reg xpfs_regs[] = {
    {"stat", xpfs_stat},
    {"remove", xpfs_remove},
    {"mkdir", xpfs_mkdir},
+   {"mkfifo", xpfs_mkfifo},
    {"chdir", xpfs_chdir},
    {"rmdir", xpfs_rmdir},
    {"getcwd", xpfs_getcwd},
    {"rename", xpfs_rename},
+   {"copy", xpfs_copy},
    {"dir", xpfs_dir},
    {0,0}
 };
@@ -24,6 +24,8 @@ local fields = {
    {"gid", "number"},
    {"uid", "number"},
    {"inode", "number"},
+   {"mtime_ns", "number"},
+   {"ctime_ns", "number"},
    {"size", "number"},
    {"perm", "string", "^r[-w][-x][-r][-w]%-[-r][-w]%-$"},
    {"kind", "string", "^f$"},
@@ -34,7 +36,7 @@ local rAll = xpfs.stat(statFile, "*")
 for _, f in ipairs(fields) do
    local field, ty, pat = table.unpack(f)
 
-   local r, err = xpfs.stat(statFile, field:sub(1,1))
+   local r, err = xpfs.stat(statFile, field:match("_ns$") and "n" or field:sub(1,1))
    qt.eq(nil, err)
    qt.eq(ty, type(r[field]))
    if pat then
@@ -45,6 +47,8 @@ for _, f in ipairs(fields) do
    qt.eq(r[field], rAll[field])
 end
 
+qt.eq("integer", math.type(rAll.mtime_ns))
+qt.eq(rAll.mtime, rAll.mtime_ns // 1000000000)
 qt.eq(true, rAll.time >= rAll.ctime)
 qt.eq(true, rAll.time >= rAll.mtime)
 
@@ -53,6 +53,84 @@ function Socket:read(amt)
 end
 
 
+-- Send `data` with descriptors attached.  The descriptors travel with
+-- the first bytes sent; the rest of `data` is written as usual.
+--
+function Socket:sendfds(data, ...)
+   repeat
+      local num, err = self:try_sendfds(data, ...)
+      if num then
+         if num < #data then
+            return self:write(data:sub(num+1))
+         end
+         return num
+      elseif err ~= "retry" then
+         return nil, err
+      end
+      yield( self:when_write(currentTask) )
+   until false
+end
+
+
+-- Receive data, followed by a socket object for each descriptor attached
+-- to it.
+--
+function Socket:recvfds(amt)
+   repeat
+      local results = table.pack(self:try_recvfds(amt))
+      if results[1] then
+         return table.unpack(results, 1, results.n)
+      elseif results[2] ~= "retry" then
+         return nil, results[2]
+      end
+      yield( self:when_read(currentTask) )
+   until false
+end
+
+
+-- inotify event bits
+local IN_DELETE_SELF = 0x400
+local IN_MOVE_SELF   = 0x800
+local IN_Q_OVERFLOW  = 0x4000
+local IN_IGNORED     = 0x8000
+
+local function parseEvents(data)
+   local events, pos = {}, 1
+   while pos + 15 <= #data do
+      local wd, mask, _, len = string.unpack("=i4I4I4I4", data, pos)
+      pos = pos + 16
+      table.insert(events, {
+         wd = wd,
+         name = data:sub(pos, pos + len - 1):match("^[^%z]*"),
+         self = mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED) ~= 0,
+         overflow = mask & IN_Q_OVERFLOW ~= 0,
+      })
+      pos = pos + len
+   end
+   return events
+end
+
+
+-- Read events from a socket returned by `xpio.inotify()`.
+--
+function Socket:try_readwatch()
+   local data, err = self:try_read(65536)
+   if not data then
+      return nil, err
+   end
+   return parseEvents(data)
+end
+
+
+function Socket:readwatch()
+   local data, err = self:read(65536)
+   if not data then
+      return nil, err
+   end
+   return parseEvents(data)
+end
+
+
 function Socket:connect(...)
    repeat
       local succ, err = self:try_connect(...)
@@ -271,7 +349,7 @@ function xpio.spawn(args, env, files, attrs)
       envStrings[#envStrings+1] = k .. "=" .. v
    end
 
-   local proc = xpio._spawn(file, args, envStrings, fdActions)
+   local proc, err = xpio._spawn(file, args, envStrings, fdActions, attrs and attrs.cwd)
 
    -- close granted file objects
    for _, socket in pairs(files) do
@@ -280,7 +358,7 @@ function xpio.spawn(args, env, files, attrs)
       end
    end
 
-   return proc
+   return proc, err
 end
 
 
@@ -18,6 +18,7 @@
 #include <sys/wait.h>
 #include <sys/errno.h>
 #include <sys/socket.h>
+#include <sys/un.h>
 #include <sys/resource.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>  // TCP_NODELAY
@@ -25,6 +26,17 @@
 #include <poll.h>
 
 #include <signal.h>
+#include <spawn.h>
+
+#ifdef __linux__
+#  include <sys/inotify.h>
+#  include <sys/epoll.h>
+#  include <sys/syscall.h>
+#  define XPIO_EPOLL
+#  ifdef SYS_pidfd_open
+#     define XPIO_PIDFD
+#  endif
+#endif
 
 #ifdef _WIN32
 /* ? */
@@ -32,6 +44,11 @@
 #  include <unistd.h>
 #endif
 
+// posix_spawn_file_actions_addchdir_np() appeared in glibc 2.29
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+#  define XPIO_SPAWN_CHDIR
+#endif
+
 #include "lualib.h"
 #include "lauxlib.h"
 #include "xlua.h"
@@ -260,6 +277,35 @@ static int addrFromString(struct sockaddr_in *psin, const char *psz)
 }
 
 
+// Initialize a socket address for socket `s` from a string: a path for
+// UNIX-domain sockets, or "a.b.c.d:port" otherwise.
+//
+static int sockaddrFromString(int s, const char *psz,
+                              struct sockaddr_storage *pss, socklen_t *plen)
+{
+   struct sockaddr_storage cur;
+   socklen_t len = sizeof cur;
+
+   ZERO_REC(cur);
+   if (getsockname(s, (struct sockaddr *) &cur, &len) == 0 &&
+       cur.ss_family == AF_UNIX) {
+      struct sockaddr_un *psun = (struct sockaddr_un *) pss;
+      size_t size = strlen(psz);
+      if (size == 0 || size >= sizeof psun->sun_path) {
+         return -1;
+      }
+      ZERO_REC(*psun);
+      psun->sun_family = AF_UNIX;
+      memcpy(psun->sun_path, psz, size);
+      *plen = sizeof *psun;
+      return 0;
+   }
+
+   *plen = sizeof(struct sockaddr_in);
+   return addrFromString((struct sockaddr_in *) pss, psz);
+}
+
+
 //--------------------------------
 // socket options
 //--------------------------------
@@ -342,6 +388,7 @@ static void *xpio_newObject(lua_State *L, size_t size, const char *mtName)
 static int xpproc_isExited(lua_State *L, int ndxProc);
 static int xpproc_reap(void);
 static int xpproc_getSigPipe(void);
+static int xpproc_hasOrphans(void);
 
 static int xpproc_dtor(lua_State *L);
 static int xpproc_kill(lua_State *L);
@@ -367,14 +414,32 @@ static const luaL_Reg XPProc_regs[] = {
 //      uservalue[1] = readers: fd -> task
 //      uservalue[2] = writers: fd -> task
 //      uservalue[3] = child waiters: pid -> task
+//
+// On Linux, a queue also keeps an epoll set.  A file descriptor is armed
+// in it (with EPOLLONESHOT) when a task starts waiting on it, and re-armed
+// after an event only if a task is still waiting, so wait() does work in
+// proportion to the number of ready descriptors, not waiting ones.  Tasks
+// that are dequeued leave their descriptor armed; the event that may
+// follow finds no task and is ignored.  When a descriptor cannot be added
+// (e.g. a regular file), the queue falls back to poll(), which rebuilds
+// its array from the readers and writers tables on every wait().
 
 #define XPQUEUE_READ  1
 #define XPQUEUE_WRITE 2
 #define XPQUEUE_CHILD 3
 
+// Maximum number of epoll events handled by one wait().  Others are
+// returned by the next one.
+#define XPQUEUE_MAXEVENTS 256
+
 typedef struct {
    struct pollfd* pfds;
    int            nfds;
+#ifdef XPIO_EPOLL
+   int            epfd;    // epoll set, or -1 to use poll()
+   char          *added;   // fd -> whether fd has been added to epfd
+   int            nadded;
+#endif
 } XPQueue;
 
 static int xpqueue_dtor(lua_State *L);
@@ -434,6 +499,77 @@ static int xpqueue_dequeueC(lua_State *L)
 }
 
 
+#ifdef XPIO_EPOLL
+
+// Stop using epoll for this queue.
+//
+static void XPQueue_usePoll(XPQueue *me)
+{
+   if (me->epfd >= 0) {
+      close(me->epfd);
+      me->epfd = -1;
+   }
+}
+
+
+// Arm `fd` in the epoll set for `events` (EPOLLIN/EPOLLOUT), until the
+// next event is reported.
+//
+static void XPQueue_arm(XPQueue *me, int fd, int events)
+{
+   struct epoll_event ev;
+   int op;
+
+   if (me->epfd < 0) {
+      return;
+   }
+   me->added = growArray(me->added, &me->nadded, sizeof(char), fd+1);
+   if (fd >= me->nadded) {
+      XPQueue_usePoll(me);
+      return;
+   }
+
+   ZERO_REC(ev);
+   ev.events = events | EPOLLONESHOT;
+   ev.data.fd = fd;
+
+   op = (me->added[fd] ? EPOLL_CTL_MOD : EPOLL_CTL_ADD);
+   if (epoll_ctl(me->epfd, op, fd, &ev) == -1) {
+      // ENOENT: `fd` was closed and re-used since it was added.
+      // EEXIST: `fd` was added before `added` was grown over it.
+      op = (errno == ENOENT ? EPOLL_CTL_ADD :
+            errno == EEXIST ? EPOLL_CTL_MOD : -1);
+      if (op == -1 || epoll_ctl(me->epfd, op, fd, &ev) == -1) {
+         XPQueue_usePoll(me);
+         return;
+      }
+   }
+   me->added[fd] = 1;
+}
+
+
+// Return the events that tasks in `readers` and `writers` wait for on `fd`.
+//
+static int XPQueue_interest(lua_State *L, int ndxReaders, int ndxWriters, int fd)
+{
+   int events = 0;
+
+   ndxReaders = lua_absindex(L, ndxReaders);
+   ndxWriters = lua_absindex(L, ndxWriters);
+
+   if (lua_rawgeti(L, ndxReaders, fd) != LUA_TNIL) {
+      events |= EPOLLIN;
+   }
+   if (lua_rawgeti(L, ndxWriters, fd) != LUA_TNIL) {
+      events |= EPOLLOUT;
+   }
+   lua_pop(L, 2);
+   return events;
+}
+
+#endif // XPIO_EPOLL
+
+
 // Register a waiting task
 //   ndxKey = index of fd (READ/WRITE) or xpproc (CHILD)
 //   mode = XPQUEUE_READ, XPQUEUE_WRITE, XPQUEUE_CHILD
@@ -468,6 +604,18 @@ static int xpqueue_enqueue(lua_State *L, int ndxTask, int ndxKey, int mode)
    lua_pushvalue(L, ndxKey);
    lua_setfield(L, ndxTask, "_dequeuedata");
 
+#ifdef XPIO_EPOLL
+   if (mode != XPQUEUE_CHILD) {
+      // stack: queue(-3) uservalue(-2) readers/writers(-1)
+      XPQueue *me = XLUA_CAST(L, -3, XPQueue);
+      lua_rawgeti(L, -2, XPQUEUE_READ);
+      lua_rawgeti(L, -3, XPQUEUE_WRITE);
+      int fd = (int) lua_tointeger(L, ndxKey);
+      XPQueue_arm(me, fd, XPQueue_interest(L, -2, -1, fd));
+      lua_pop(L, 2);
+   }
+#endif
+
    // leave 4 items on the stack
    return 0;
 }
@@ -481,6 +629,12 @@ static int xpqueue_dtor(lua_State *L)
       me->pfds = NULL;
       me->nfds = 0;
    }
+#ifdef XPIO_EPOLL
+   XPQueue_usePoll(me);
+   FREE_IF(me->added);
+   me->added = NULL;
+   me->nadded = 0;
+#endif
    return 0;
 }
 
@@ -616,33 +770,17 @@ static int xpqueue_isEmpty(lua_State *L)
 }
 
 
-// tqueue:wait(timeout)
+// Fill me->pfds[] from readers and writers, and return the number of
+// entries used.
 //
-static int xpqueue_wait(lua_State *L)
+static int XPQueue_pollFDs(XPQueue *me, lua_State *L, int ndxReaders, int ndxWriters)
 {
-   XPQueue *me = XLUA_CAST(L, 1, XPQueue);
-   int ndxUser, ndxSlots;
-   int numOut;
+   int ndxSlots;
    int nfdsUsed = 0;
-   int timeout;
    int mode;
 
-   if (lua_toboolean(L, 2)) {
-      double num = luaL_checknumber(L, 2) * 1000.0;
-      if (num < 0) {
-         timeout = 0;
-      } else if (num > INT_MAX) {
-         timeout = INT_MAX;
-      } else {
-         timeout = (int) num;
-      }
-   } else {
-      timeout = -1;
-   }
-
-   // get user value
-   lua_getuservalue(L, 1);
-   ndxUser = lua_gettop(L);
+   ndxReaders = lua_absindex(L, ndxReaders);
+   ndxWriters = lua_absindex(L, ndxWriters);
 
    // create "slots" table:  fd -> index into pfd[]
    // not a long-lived table, so over-allocation is not a problem
@@ -656,10 +794,9 @@ static int xpqueue_wait(lua_State *L)
 
    for (mode = XPQUEUE_READ; mode <= XPQUEUE_WRITE; ++mode) {
 
-      // get readers or writers
-      lua_rawgeti(L, ndxUser, mode);
+      int ndxTable = (mode == XPQUEUE_READ ? ndxReaders : ndxWriters);
 
-      for (lua_pushnil(L); lua_next(L, -2) != 0; lua_pop(L, 1)) {
+      for (lua_pushnil(L); lua_next(L, ndxTable) != 0; lua_pop(L, 1)) {
          // key is at -2;  value is at -1
          int fd = lua_tointeger(L, -2);
          int ndxFD = 0;
@@ -691,7 +828,135 @@ static int xpqueue_wait(lua_State *L)
       }
    }
 
-   lua_rawgeti(L, ndxUser, 3);  // childWaiters
+   lua_pop(L, 1);  // slots
+   return nfdsUsed;
+}
+
+
+#ifdef XPIO_EPOLL
+
+static int isEmptyTable(lua_State *L, int ndx)
+{
+   int isEmpty;
+
+   lua_pushnil(L);
+   isEmpty = !lua_next(L, ndx);
+   if (!isEmpty) {
+      lua_pop(L, 2);
+   }
+   return isEmpty;
+}
+
+
+// Move the task in `table[fd]`, if any, to `ready`.
+//
+static void XPQueue_wakeFD(lua_State *L, int ndxReady, int ndxTable, int fd)
+{
+   if (lua_rawgeti(L, ndxTable, fd) == LUA_TNIL) {
+      lua_pop(L, 1);
+      return;
+   }
+   lua_pushnil(L);
+   lua_setfield(L, -2, "_dequeue");
+   lua_rawseti(L, ndxReady, lengthOf(L, ndxReady) + 1);
+   lua_pushnil(L);
+   lua_rawseti(L, ndxTable, fd);
+}
+
+
+// The epoll half of xpqueue_wait().
+//
+// stack: readers(-4) writers(-3) childWaiters(-2) ready(-1)
+//
+static int XPQueue_waitEpoll(XPQueue *me, lua_State *L, int timeout, int numChildWaiters)
+{
+   struct epoll_event evs[XPQUEUE_MAXEVENTS];
+   int ndxReaders = lua_absindex(L, -4);
+   int ndxWriters = lua_absindex(L, -3);
+   int ndxReady = lua_absindex(L, -1);
+   int sigfd = xpproc_getSigPipe();
+   int bSigPipe = numChildWaiters || xpproc_hasOrphans();
+   int bReap = 0;
+   int numOut;
+   int n;
+
+   if (timeout == -1 && numChildWaiters == 0 &&
+       isEmptyTable(L, ndxReaders) && isEmptyTable(L, ndxWriters)) {
+      // nothing to wait on
+      lua_pushnil(L);
+      return 1;
+   }
+
+   do {
+      numOut = epoll_wait(me->epfd, evs, XPQUEUE_MAXEVENTS, timeout);
+   } while (numOut < 0 && errno == EINTR);
+   if (numOut < 0) {
+      return luaL_error(L, "xpio: epoll error (%s)", strerror(errno));
+   }
+
+   for (n = 0; n < numOut; ++n) {
+      int fd = evs[n].data.fd;
+      int revents = evs[n].events;
+      int events;
+
+      if (bSigPipe && fd == sigfd) {
+         bReap = 1;
+         continue;
+      }
+      if (revents & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+         XPQueue_wakeFD(L, ndxReady, ndxReaders, fd);
+      }
+      if (revents & (EPOLLOUT | EPOLLERR | EPOLLHUP)) {
+         XPQueue_wakeFD(L, ndxReady, ndxWriters, fd);
+      }
+
+      // re-arm for tasks still waiting
+      events = XPQueue_interest(L, ndxReaders, ndxWriters, fd);
+      if (events) {
+         XPQueue_arm(me, fd, events);
+      }
+   }
+
+   if (bReap && xpproc_reap()) {
+      (void) XPQueue_wakeChildWaiters(me, L, -1, -2);
+   }
+
+   return 1;
+}
+
+#endif // XPIO_EPOLL
+
+
+// tqueue:wait(timeout)
+//
+static int xpqueue_wait(lua_State *L)
+{
+   XPQueue *me = XLUA_CAST(L, 1, XPQueue);
+   int ndxUser;
+   int numOut;
+   int nfdsUsed = 0;
+   int timeout;
+
+   if (lua_toboolean(L, 2)) {
+      double num = luaL_checknumber(L, 2) * 1000.0;
+      if (num < 0) {
+         timeout = 0;
+      } else if (num > INT_MAX) {
+         timeout = INT_MAX;
+      } else {
+         timeout = (int) num;
+      }
+   } else {
+      timeout = -1;
+   }
+
+   // get user value
+   lua_getuservalue(L, 1);
+   ndxUser = lua_gettop(L);
+
+   lua_rawgeti(L, ndxUser, XPQUEUE_READ);
+   lua_rawgeti(L, ndxUser, XPQUEUE_WRITE);
+   lua_rawgeti(L, ndxUser, XPQUEUE_CHILD);
 
    lua_newtable(L);  // result = array of ready tasks
 
@@ -703,7 +968,22 @@ static int xpqueue_wait(lua_State *L)
       timeout = 0;
    }
 
-   if (numChildWaiters) {
+   // The signal pipe is watched while child waiters are pending, and also
+   // while orphans (see xpproc_dtor) are left to reap.
+   int bSigPipe = numChildWaiters || xpproc_hasOrphans();
+
+#ifdef XPIO_EPOLL
+   if (bSigPipe) {
+      XPQueue_arm(me, xpproc_getSigPipe(), EPOLLIN);
+   }
+   if (me->epfd >= 0) {
+      return XPQueue_waitEpoll(me, L, timeout, numChildWaiters);
+   }
+#endif
+
+   nfdsUsed = XPQueue_pollFDs(me, L, -4, -3);
+
+   if (bSigPipe) {
       // wait on sigchldPipe
       // printf("... adding sigchldPipe to read set\n");
       XPQueue_ensureFDs(me, L, nfdsUsed);
@@ -728,9 +1008,9 @@ static int xpqueue_wait(lua_State *L)
    }
 
    XPQueue_wakeSockets(me, L, -1, -4, -3,
-                       me->pfds, nfdsUsed - (numChildWaiters ? 1 : 0));
+                       me->pfds, nfdsUsed - (bSigPipe ? 1 : 0));
 
-   if (numChildWaiters &&
+   if (bSigPipe &&
        (me->pfds[nfdsUsed-1].revents & (POLLIN | POLLERR | POLLHUP | POLLNVAL)) &&
        xpproc_reap()) {
       (void) XPQueue_wakeChildWaiters(me, L, -1, -2);
@@ -740,12 +1020,30 @@ static int xpqueue_wait(lua_State *L)
 }
 
 
+// xpio.tqueue([opts])
+//
 static int xpio_tqueue(lua_State *L)
 {
+   int bPoll = 0;
+
+   // tqueue{poll=true} uses poll() even where epoll is available.
+   if (lua_istable(L, 1)) {
+      lua_getfield(L, 1, "poll");
+      bPoll = lua_toboolean(L, -1);
+      lua_pop(L, 1);
+   }
+
    XPQueue *me = XPIO_NEWOBJECT(L, XPQueue);
 
    me->pfds = 0;
    me->nfds = 0;
+#ifdef XPIO_EPOLL
+   me->epfd = (bPoll ? -1 : epoll_create1(EPOLL_CLOEXEC));
+   me->added = NULL;
+   me->nadded = 0;
+#else
+   (void) bPoll;
+#endif
 
    lua_createtable(L, 2, 0);             // uservalue
    lua_newtable(L);
@@ -770,11 +1068,18 @@ typedef struct XPProc {
    struct XPProc *next;
    int pid;               // PID until reaped; 0 after reaping
    int status;            // status after reaping
+   int pidfd;             // process descriptor, or -1
 } XPProc;
 
 // list of all XPProc instances
 static XPProc *gpHeadProc = 0;
 
+// Processes whose XPProc was collected before they were reaped.  They have
+// been killed, and are reaped when they exit, so that none stays a zombie.
+static pid_t *gpOrphans = 0;
+static int gnOrphans = 0;
+static int gnOrphansMax = 0;
+
 static XPProc *xpproc_new(lua_State *L);
 
 
@@ -798,7 +1103,8 @@ static int xpproc_getSigPipe(void)
 // * Install a SIGCHLD handler that writes to `sigchldPipe`.
 //
 // * Add `sigchldPipe` to the readable set of poll/select when the
-//   xpqueue has pending child waiters.
+//   xpqueue has pending child waiters, or when processes collected before
+//   they exited are left to reap (see xpproc_dtor).
 //
 // * When `sigchldPipe` is indicated as readable by poll/select, consume the
 //   pipe and reap all processes.  (This can happen only when there is a
@@ -810,6 +1116,12 @@ static int xpproc_getSigPipe(void)
 // xpproc's that are waited for on other XPQueues. As a result, each
 // xpqueue_wait() must poll all of its child waiters before poll/select, and
 // then again after reaping.
+//
+// On Linux, we avoid all that where we can: each process gets a pidfd,
+// which becomes readable when the process exits.  when_wait() queues the
+// task as a reader of the pidfd, so an exit wakes just that task, and
+// try_wait() reaps just that process.  The signal pipe is used only for
+// processes without a pidfd (when pidfd_open() is not supported).
 
 
 static int xpproc_isExited(lua_State *L, int ndxProc)
@@ -819,6 +1131,66 @@ static int xpproc_isExited(lua_State *L, int ndxProc)
 }
 
 
+static int xpproc_hasOrphans(void)
+{
+   return gnOrphans > 0;
+}
+
+
+// Add `pid` to the orphans.  Returns 0 if there is no memory for it.
+//
+static int xpproc_addOrphan(pid_t pid)
+{
+   if (gnOrphans == gnOrphansMax) {
+      int nMax = gnOrphansMax ? gnOrphansMax * 2 : 8;
+      pid_t *p = (pid_t *) realloc(gpOrphans, nMax * sizeof(pid_t));
+      if (!p) {
+         return 0;
+      }
+      gpOrphans = p;
+      gnOrphansMax = nMax;
+   }
+   gpOrphans[gnOrphans++] = pid;
+   return 1;
+}
+
+
+// Forget the orphan `pid`, once reaped, before the PID can be reused.
+//
+static void xpproc_forgetOrphan(pid_t pid)
+{
+   int i;
+
+   for (i = 0; i < gnOrphans; ++i) {
+      if (gpOrphans[i] == pid) {
+         gpOrphans[i] = gpOrphans[--gnOrphans];
+         return;
+      }
+   }
+}
+
+
+// Reap the orphans that have exited, and forget those that are gone.
+//
+static void xpproc_reapOrphans(void)
+{
+   int status;
+   pid_t pid;
+   int i = 0;
+
+   while (i < gnOrphans) {
+      do {
+         pid = waitpid(gpOrphans[i], &status, WNOHANG);
+      } while (pid == -1 && errno == EINTR);
+      if (pid == 0) {
+         ++i;
+      } else {
+         gpOrphans[i] = gpOrphans[--gnOrphans];
+      }
+   }
+}
+
+
 // Consume the signal pipe, reap all exited processes, and return
 // the number of xpproc objects that have been updated.
 //
@@ -858,6 +1230,9 @@ static int xpproc_reap(void)
                break;
             }
          }
+         if (!p) {
+            xpproc_forgetOrphan(pid);
+         }
       }
       // POSIX doesn't seem to explicitly disallow EINTER even with WNOHANG
    } while (pid > 0 || (pid == -1 && errno == EINTR));
@@ -867,6 +1242,50 @@ static int xpproc_reap(void)
 }
 
 
+#ifdef XPIO_PIDFD
+
+static int xpproc_openPidfd(pid_t pid)
+{
+   return (int) syscall(SYS_pidfd_open, pid, 0);
+}
+
+#endif
+
+
+// Reap `me` if it has exited.  Processes without a pidfd are reaped by
+// xpproc_reap() instead.
+//
+static void xpproc_reapOne(XPProc *me)
+{
+   int status;
+   pid_t pid;
+
+   xpproc_reapOrphans();
+
+   if (me->pid <= 0 || me->pidfd < 0) {
+      return;
+   }
+
+   do {
+      pid = waitpid(me->pid, &status, WNOHANG);
+   } while (pid == -1 && errno == EINTR);
+
+   if (pid == me->pid) {
+      me->pid = 0;
+      me->status = status;
+   }
+}
+
+
+static void xpproc_closePidfd(XPProc *me)
+{
+   if (me->pidfd >= 0) {
+      close(me->pidfd);
+      me->pidfd = -1;
+   }
+}
+
+
 static int xpproc_kill(lua_State *L)
 {
    XPProc *me = XLUA_CAST(L, 1, XPProc);
@@ -889,14 +1308,29 @@ static int xpproc_kill(lua_State *L)
 static int xpproc_dtor(lua_State *L)
 {
    XPProc *me = XLUA_CAST(L, 1, XPProc);
+   int status;
+   pid_t pid;
 
    // dequeue from global list
    SLL_DEQUEUE(me, gpHeadProc, XPProc, next);
 
-   if (me->pid) {
+   if (me->pid > 0) {
+      // Nothing will wait for it after this, so it is killed, and reaped
+      // here if it has already exited.  Otherwise it becomes an orphan,
+      // reaped when its SIGCHLD arrives, since blocking here would stall
+      // every task.  Only if that cannot be recorded do we wait for it.
       (void) kill(me->pid, SIGKILL);
+      do {
+         pid = waitpid(me->pid, &status, WNOHANG);
+      } while (pid == -1 && errno == EINTR);
+      if (pid == 0 && !xpproc_addOrphan(me->pid)) {
+         do {
+            pid = waitpid(me->pid, &status, 0);
+         } while (pid == -1 && errno == EINTR);
+      }
       me->pid = 0;
    }
+   xpproc_closePidfd(me);
    return 0;
 }
 
@@ -905,6 +1339,8 @@ static int xpproc_try_wait(lua_State *L)
 {
    XPProc *me = XLUA_CAST(L, 1, XPProc);
 
+   xpproc_reapOne(me);
+
    if (me->pid > 0) {
       lua_pushnil(L);
       lua_pushstring(L, "retry");
@@ -912,6 +1348,9 @@ static int xpproc_try_wait(lua_State *L)
       return 2;
    }
 
+   // the process is gone, and so are its pidfd's events
+   xpproc_closePidfd(me);
+
    //printf("... try_wait() --> %x\n", me->status);
    if (WIFEXITED(me->status)) {
       lua_pushstring(L, "exit");
@@ -961,7 +1400,10 @@ static void xpproc_init(void)
          return;
       }
 
-      if (setNonBlocking(sigchldPipe[0], 1) == -1) {
+      // The write side is non-blocking, too, because the pipe is not
+      // drained while all waited-for processes have pidfds.
+      if (setNonBlocking(sigchldPipe[0], 1) == -1 ||
+          setNonBlocking(sigchldPipe[1], 1) == -1) {
          fprintf(stderr, "ERROR: failed to set pipe non-blocking\n");
          return;
       }
@@ -976,8 +1418,12 @@ static void xpproc_init(void)
 
 static int xpproc_when_wait(lua_State *L)
 {
-   (void) XLUA_CAST(L, 1, XPProc);
+   XPProc *me = XLUA_CAST(L, 1, XPProc);
    // printf("... when_wait\n");
+   if (me->pid > 0 && me->pidfd >= 0) {
+      lua_pushinteger(L, me->pidfd);
+      return xpqueue_enqueue(L, 2, -1, XPQUEUE_READ);
+   }
    return xpqueue_enqueue(L, 2, 1, XPQUEUE_CHILD);
 }
 
@@ -987,6 +1433,7 @@ static XPProc *xpproc_new(lua_State *L)
    XPProc *me = XPIO_NEWOBJECT(L, XPProc);
    me->pid = 0;
    me->status = 0;
+   me->pidfd = -1;
 
    me->next = gpHeadProc;
    gpHeadProc = me;
@@ -1019,6 +1466,10 @@ static int xpsocket_getpeername(lua_State *L);
 static int xpsocket_getsockopt(lua_State *L);
 static int xpsocket_setsockopt(lua_State *L);
 static int xpsocket_shutdown(lua_State *L);
+static int xpsocket_try_sendfds(lua_State *L);
+static int xpsocket_try_recvfds(lua_State *L);
+static int xpsocket_addwatch(lua_State *L);
+static int xpsocket_rmwatch(lua_State *L);
 static int xpsocket_close(lua_State *L);
 static int xpsocket_fileno(lua_State *L);
 
@@ -1037,6 +1488,10 @@ static const luaL_Reg XPSocket_regs[] = {
    {"getsockopt", xpsocket_getsockopt},
    {"setsockopt", xpsocket_setsockopt},
    {"shutdown", xpsocket_shutdown},
+   {"try_sendfds", xpsocket_try_sendfds},
+   {"try_recvfds", xpsocket_try_recvfds},
+   {"addwatch", xpsocket_addwatch},
+   {"rmwatch", xpsocket_rmwatch},
    {"close", xpsocket_close},
    {"fileno", xpsocket_fileno},
    {0, 0}
@@ -1058,13 +1513,21 @@ static int xpsocket_dtor(lua_State *L)
 }
 
 
-static int xpsocket_getXname(lua_State *L, struct sockaddr_in* psin)
+static int xpsocket_getXname(lua_State *L, struct sockaddr_storage* pss)
 {
+   struct sockaddr_in *psin = (struct sockaddr_in *) pss;
    unsigned char *pby = (unsigned char *) &psin->sin_addr;
 
+   if (pss->ss_family == AF_UNIX) {
+      struct sockaddr_un *psun = (struct sockaddr_un *) pss;
+      lua_pushlstring(L, psun->sun_path,
+                      strnlen(psun->sun_path, sizeof psun->sun_path));
+      return 1;
+   }
+
    if (psin->sin_family != AF_INET) {
       lua_pushnil(L);
-      lua_pushfstring(L, "xpio: unknown address family %d", &psin->sin_family);
+      lua_pushfstring(L, "xpio: unknown address family %d", (int) psin->sin_family);
       return 2;
    }
 
@@ -1081,22 +1544,24 @@ static int xpsocket_getXname(lua_State *L, struct sockaddr_in* psin)
 static int xpsocket_getsockname(lua_State *L)
 {
    XPSocket *me = XLUA_CAST(L, 1, XPSocket);
-   struct sockaddr_in sin;
-   socklen_t len = sizeof(sin);
-   if (getsockname(me->s, (struct sockaddr*) &sin, &len))
+   struct sockaddr_storage ss;
+   socklen_t len = sizeof(ss);
+   ZERO_REC(ss);
+   if (getsockname(me->s, (struct sockaddr*) &ss, &len))
       return pushError(L, NULL);
-   return xpsocket_getXname(L, &sin);
+   return xpsocket_getXname(L, &ss);
 }
 
 
 static int xpsocket_getpeername(lua_State *L)
 {
    XPSocket *me = XLUA_CAST(L, 1, XPSocket);
-   struct sockaddr_in sin;
-   socklen_t len = sizeof(sin);
-   if (getpeername(me->s, (struct sockaddr *) &sin, &len))
+   struct sockaddr_storage ss;
+   socklen_t len = sizeof(ss);
+   ZERO_REC(ss);
+   if (getpeername(me->s, (struct sockaddr *) &ss, &len))
       return pushError(L, NULL);
-   return xpsocket_getXname(L, &sin);
+   return xpsocket_getXname(L, &ss);
 }
 
 
@@ -1247,6 +1712,161 @@ static int xpsocket_try_write(lua_State *L)
 }
 
 
+// Most descriptors passed in one message
+#define MAX_PASSED_FDS 8
+
+
+// try_sendfds(data, fd...) : send data with descriptors attached.  Each
+// `fd` is a socket object or a descriptor number.
+//
+static int xpsocket_try_sendfds(lua_State *L)
+{
+   XPSocket *me = XLUA_CAST(L, 1, XPSocket);
+   size_t size;
+   const char *data = luaL_checklstring(L, 2, &size);
+   int nfds = lua_gettop(L) - 2;
+   int fds[MAX_PASSED_FDS];
+   char buf[CMSG_SPACE(sizeof fds)];
+   struct iovec iov;
+   struct msghdr msg;
+   struct cmsghdr *pcm;
+   int n;
+
+   luaL_argcheck(L, size > 0, 2, "empty data");
+   luaL_argcheck(L, nfds <= MAX_PASSED_FDS, 3, "too many descriptors");
+   for (n = 0; n < nfds; ++n) {
+      if (lua_isinteger(L, n + 3)) {
+         fds[n] = (int) lua_tointeger(L, n + 3);
+      } else {
+         fds[n] = XLUA_CAST(L, n + 3, XPSocket)->s;
+      }
+   }
+
+   ZERO_REC(msg);
+   ZERO_REC(buf);
+   iov.iov_base = (void *) data;
+   iov.iov_len = size;
+   msg.msg_iov = &iov;
+   msg.msg_iovlen = 1;
+   if (nfds > 0) {
+      msg.msg_control = buf;
+      msg.msg_controllen = CMSG_SPACE(nfds * sizeof(int));
+      pcm = CMSG_FIRSTHDR(&msg);
+      pcm->cmsg_level = SOL_SOCKET;
+      pcm->cmsg_type = SCM_RIGHTS;
+      pcm->cmsg_len = CMSG_LEN(nfds * sizeof(int));
+      memcpy(CMSG_DATA(pcm), fds, nfds * sizeof(int));
+   }
+
+   n = sendmsg(me->s, &msg, 0);
+   if (n < 0) {
+      return pushError(L, isRetry(errno) ? "retry" : NULL);
+   }
+   lua_pushinteger(L, n);
+   return 1;
+}
+
+
+// try_recvfds(size) : receive data and any descriptors attached to it.
+// Returns the data followed by a socket object for each descriptor, or
+// nil at end of stream.
+//
+static int xpsocket_try_recvfds(lua_State *L)
+{
+   XPSocket *me = XLUA_CAST(L, 1, XPSocket);
+   size_t size = checkUInt(L, 2);
+   char buf[CMSG_SPACE(MAX_PASSED_FDS * sizeof(int))];
+   struct iovec iov;
+   struct msghdr msg;
+   struct cmsghdr *pcm;
+   luaL_Buffer b;
+   int n, nfds = 0, i;
+   int *pfds = NULL;
+
+   luaL_argcheck(L, size > 0, 2, "size must be positive");
+
+   ZERO_REC(msg);
+   iov.iov_base = luaL_buffinitsize(L, &b, size);
+   iov.iov_len = size;
+   msg.msg_iov = &iov;
+   msg.msg_iovlen = 1;
+   msg.msg_control = buf;
+   msg.msg_controllen = sizeof buf;
+
+   n = recvmsg(me->s, &msg, MSG_CMSG_CLOEXEC);
+   if (n < 0) {
+      return pushError(L, isRetry(errno) ? "retry" : NULL);
+   }
+
+   for (pcm = CMSG_FIRSTHDR(&msg); pcm; pcm = CMSG_NXTHDR(&msg, pcm)) {
+      if (pcm->cmsg_level == SOL_SOCKET && pcm->cmsg_type == SCM_RIGHTS) {
+         pfds = (int *) CMSG_DATA(pcm);
+         nfds = (pcm->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+         break;
+      }
+   }
+
+   if (n == 0 && nfds == 0) {
+      lua_pushnil(L);
+      return 1;
+   }
+   luaL_pushresultsize(&b, n);
+
+   // Descriptors are left in blocking mode: they are usually shared with
+   // another process.
+   luaL_checkstack(L, nfds, NULL);
+   for (i = 0; i < nfds; ++i) {
+      XPSocket *ps = xpsocket_new(L);
+      ps->s = pfds[i];
+   }
+   return 1 + nfds;
+}
+
+
+// addwatch(path) : watch a file or directory for changes, on a socket
+// returned by xpio.inotify().  Returns a watch descriptor.
+//
+static int xpsocket_addwatch(lua_State *L)
+{
+#ifdef __linux__
+   XPSocket *me = XLUA_CAST(L, 1, XPSocket);
+   const char *path = luaL_checkstring(L, 2);
+   int wd = inotify_add_watch(me->s, path,
+                              IN_ATTRIB | IN_CLOSE_WRITE | IN_CREATE |
+                              IN_DELETE | IN_DELETE_SELF | IN_MODIFY |
+                              IN_MOVE_SELF | IN_MOVED_FROM | IN_MOVED_TO);
+   if (wd == -1) {
+      return pushError(L, NULL);
+   }
+   lua_pushinteger(L, wd);
+   return 1;
+#else
+   lua_pushnil(L);
+   lua_pushstring(L, "xpio: inotify is not supported");
+   return 2;
+#endif
+}
+
+
+// rmwatch(wd) : stop watching, given a descriptor returned by addwatch.
+//
+static int xpsocket_rmwatch(lua_State *L)
+{
+#ifdef __linux__
+   XPSocket *me = XLUA_CAST(L, 1, XPSocket);
+   if (inotify_rm_watch(me->s, (int) luaL_checkinteger(L, 2))) {
+      return pushError(L, NULL);
+   }
+   lua_pushboolean(L, 1);
+   return 1;
+#else
+   lua_pushnil(L);
+   lua_pushstring(L, "xpio: inotify is not supported");
+   return 2;
+#endif
+}
+
+
 static int xpsocket_shutdown(lua_State *L)
 {
    XPSocket *me = XLUA_CAST(L, 1, XPSocket);
@@ -1296,12 +1916,13 @@ static int xpsocket_bind(lua_State *L)
 {
    XPSocket *me = XLUA_CAST(L, 1, XPSocket);
    const char *addr = luaL_checkstring(L, 2);
-   struct sockaddr_in sin;
+   struct sockaddr_storage ss;
+   socklen_t len;
 
-   if (addrFromString(&sin, addr)) {
+   if (sockaddrFromString(me->s, addr, &ss, &len)) {
       return pushError(L, "xpio: mal-formed address argument");
    }
-   if (bind(me->s, (struct sockaddr *) &sin, sizeof(sin))) {
+   if (bind(me->s, (struct sockaddr *) &ss, len)) {
       return pushError(L, NULL);
    }
 
@@ -1314,13 +1935,14 @@ static int xpsocket_try_connect(lua_State *L)
 {
    XPSocket *me = XLUA_CAST(L, 1, XPSocket);
    const char *addr = luaL_checkstring(L, 2);
-   struct sockaddr_in sin;
+   struct sockaddr_storage ss;
+   socklen_t len;
    int e;
 
-   if (addrFromString(&sin, addr)) {
+   if (sockaddrFromString(me->s, addr, &ss, &len)) {
       return pushError(L, "xpio: mal-formed address");
    }
-   e = connect(me->s, (struct sockaddr *)&sin, sizeof sin);
+   e = connect(me->s, (struct sockaddr *)&ss, len);
 
    // POSIX fail: Asynchronous connect oddness.  Instead of EAGAIN or
    // EWOULDBLOCK, we may get either EINPROGRESS or EALREADY to indicate
@@ -1397,19 +2019,23 @@ static int xpio_socket(lua_State *L)
 {
    XPSocket *me = xpsocket_new(L);
    const char *typeName = luaL_checkstring(L, 1);
+   int family = AF_INET;
    int type;
 
    if (0 == strcmp(typeName, "TCP")) {
       type = SOCK_STREAM;
    } else if (0 == strcmp(typeName, "UDP")) {
       type = SOCK_DGRAM;
+   } else if (0 == strcmp(typeName, "UNIX")) {
+      family = AF_UNIX;
+      type = SOCK_STREAM;
    } else {
       lua_pushnil(L);
       lua_pushstring(L, "xpio: unsupported socket type");
       return 2;
    }
 
-   me->s = socket(AF_INET, type, 0);
+   me->s = socket(family, type, 0);
    if (me->s == -1) {
       return pushError(L, NULL);
    }
@@ -1484,6 +2110,71 @@ static int xpio_fdopen(lua_State *L)
 }
 
 
+// dup(fd, [newfd]) : duplicate a descriptor, given as a number or a
+// socket object, onto the lowest free descriptor or onto `newfd`.
+// Returns the new descriptor number.
+//
+static int xpio_dup(lua_State *L)
+{
+   int fd = lua_isinteger(L, 1) ? (int) lua_tointeger(L, 1)
+                                : XLUA_CAST(L, 1, XPSocket)->s;
+   int n;
+
+   if (lua_isnoneornil(L, 2)) {
+      n = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+   } else {
+      n = dup2(fd, (int) checkUInt(L, 2));
+   }
+   if (n == -1) {
+      return pushError(L, NULL);
+   }
+   lua_pushinteger(L, n);
+   return 1;
+}
+
+
+// inotify() : return a non-blocking socket object that reads file system
+// events.  See socket:addwatch().
+//
+static int xpio_inotify(lua_State *L)
+{
+#ifdef __linux__
+   XPSocket *ps = xpsocket_new(L);
+   ps->s = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+   if (ps->s == -1) {
+      return pushError(L, NULL);
+   }
+   return 1;
+#else
+   lua_pushnil(L);
+   lua_pushstring(L, "xpio: inotify is not supported");
+   return 2;
+#endif
+}
+
+
+// open(path, mode) : open a file (typically a FIFO) as a non-blocking
+// socket object.  `mode` contains "r", "w", or both.
+//
+static int xpio_open(lua_State *L)
+{
+   const char *path = luaL_checkstring(L, 1);
+   const char *mode = luaL_optstring(L, 2, "r");
+   int r = strchr(mode, 'r') != NULL;
+   int w = strchr(mode, 'w') != NULL;
+   XPSocket *ps;
+
+   luaL_argcheck(L, r || w, 2, "expected 'r' and/or 'w'");
+
+   ps = xpsocket_new(L);
+   ps->s = open(path, (r && w ? O_RDWR : r ? O_RDONLY : O_WRONLY) | O_NONBLOCK);
+   if (ps->s == -1) {
+      return pushError(L, NULL);
+   }
+   return 1;
+}
+
+
 static int xpio_gettime(lua_State *L)
 {
    struct timeval tv;
@@ -1495,6 +2186,15 @@ static int xpio_gettime(lua_State *L)
 }
 
 
+static int xpio_nprocs(lua_State *L)
+{
+   long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+   lua_pushinteger(L, n < 1 ? 1 : n);
+   return 1;
+}
+
+
 // Return a NULL-terminated array of pointers to strings, or NULL.
 // The array and all strings referenced by it are newly allocated.
 //
@@ -1610,7 +2310,146 @@ xpio_getAction(lua_State *L,
 }
 
 
-// xpio._spawn(path, args, envStrings, fdActions) -> process | nil, error
+// Free an array returned by readStringArray().
+//
+static void freeStringArray(char **ptrs)
+{
+   char **pp;
+
+   if (ptrs) {
+      for (pp = ptrs; *pp; ++pp) {
+         free(*pp);
+      }
+      free(ptrs);
+   }
+}
+
+
+// Return the descriptor in the parent whose file will be at `fd` in the
+// child after the first `numActions` actions ({fdTo, fdFrom} pairs in
+// `actions`) have been performed, or -1 if `fd` will be closed.
+//
+static int xpio_actionSource(const int *actions, int numActions, int fd)
+{
+   int n;
+
+   for (n = numActions - 1; n >= 0 && fd >= 0; --n) {
+      if (actions[2*n] == fd) {
+         fd = actions[2*n+1];
+      }
+   }
+   return fd;
+}
+
+
+#ifndef XPIO_SPAWN_CHDIR
+
+// Create the child process with fork().  The child calls only
+// async-signal-safe functions, and nothing that touches the Lua state.
+//
+static pid_t
+xpio_forkExec(const char *path, char **argv, char **envp,
+              const int *actions, int numActions, const char *cwd)
+{
+   sigset_t sigmask;
+   int n;
+
+   pid_t pid = fork();
+   if (pid) {
+      return pid;
+   }
+
+   // reset signals
+
+   // TODO: what about reversing SIG_IGN for SIGPIPE?
+   sigemptyset(&sigmask);
+   BAIL_IF(sigprocmask(SIG_SETMASK, &sigmask, NULL));
+
+   // perform file actions
+
+   for (n = 0; n < numActions; ++n) {
+      int fdTo = actions[2*n];
+      int fdFrom = actions[2*n+1];
+      if (fdFrom < 0) {
+         close(fdTo);
+      } else if (fdFrom != fdTo) {
+         dup2(fdFrom, fdTo);
+      }
+   }
+
+   if (cwd) {
+      BAIL_IF(chdir(cwd));
+   }
+
+   execve(path, argv, envp);
+
+ bail:
+   _exit(127);
+}
+
+#endif
+
+
+// Create the child process with posix_spawn(), which on Linux shares the
+// parent's memory until exec (clone with CLONE_VM|CLONE_VFORK), so its cost
+// does not grow with the size of the parent.  Returns 0 on success, or an
+// error number.
+//
+static int
+xpio_posixSpawn(pid_t *pid, const char *path, char **argv, char **envp,
+                const int *actions, int numActions, const char *cwd)
+{
+   posix_spawn_file_actions_t fa;
+   posix_spawnattr_t attr;
+   sigset_t sigmask;
+   int err;
+   int n;
+
+   err = posix_spawn_file_actions_init(&fa);
+   if (err) {
+      return err;
+   }
+   err = posix_spawnattr_init(&attr);
+   if (err) {
+      posix_spawn_file_actions_destroy(&fa);
+      return err;
+   }
+
+   sigemptyset(&sigmask);
+   err = posix_spawnattr_setsigmask(&attr, &sigmask);
+   if (!err) {
+      err = posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK);
+   }
+
+   for (n = 0; n < numActions && !err; ++n) {
+      int fdTo = actions[2*n];
+      int fdFrom = actions[2*n+1];
+      if (fdFrom < 0) {
+         err = posix_spawn_file_actions_addclose(&fa, fdTo);
+      } else if (fdFrom != fdTo) {
+         err = posix_spawn_file_actions_adddup2(&fa, fdFrom, fdTo);
+      }
+   }
+
+#ifdef XPIO_SPAWN_CHDIR
+   if (cwd && !err) {
+      err = posix_spawn_file_actions_addchdir_np(&fa, cwd);
+   }
+#else
+   (void) cwd;
+#endif
+
+   if (!err) {
+      err = posix_spawn(pid, path, &fa, &attr, argv, envp);
+   }
+
+   posix_spawnattr_destroy(&attr);
+   posix_spawn_file_actions_destroy(&fa);
+   return err;
+}
+
+
+// xpio._spawn(path, args, envStrings, fdActions, [cwd]) -> process | nil, error
 //
 //   path = path to executable file
 //   args = array of strings; Lua args[1] == C argv[0]
@@ -1619,6 +2458,11 @@ xpio_getAction(lua_State *L,
 //      {A, A}   => do nothing  + set A to non-blocking
 //      {A, B}   => dup2(B, A)  + set A to non-blocking
 //      {A, nil} => close(A)
+//   cwd = working directory for the child
+//
+// Everything the child needs is read from the Lua state before it is
+// created.  Without posix_spawn_file_actions_addchdir_np(), a child with
+// a working directory is created with fork().
 //
 static int xpio__spawn(lua_State *L)
 {
@@ -1626,45 +2470,64 @@ static int xpio__spawn(lua_State *L)
    luaL_checktype(L, 2, LUA_TTABLE);
    luaL_checktype(L, 3, LUA_TTABLE);
    luaL_checktype(L, 4, LUA_TTABLE);
+   const char *cwd = luaL_optstring(L, 5, NULL);
+   int numActions = lengthOf(L, 4);
+   int fdFrom, fdTo, n;
+   pid_t pid = -1;
+   int err = 0;
 
-   pid_t pid = fork();
-   if (pid) {
-      XPProc *pproc = xpproc_new(L);
-      pproc->pid = pid;
-      return 1;
-   }
-
-   // exec
-
-   // reset signals
+   char **argv = readStringArray(L, 2);
+   char **envp = readStringArray(L, 3);
+   int *actions = (int*) malloc((numActions + 1) * 2 * sizeof(int));
 
-   // TODO: what about reversing SIG_IGN for SIGPIPE?
-   sigset_t sigmask;
-   sigemptyset(&sigmask);
-   BAIL_IF(sigprocmask(SIG_SETMASK, &sigmask, NULL));
+   if (!argv || !envp || !actions) {
+      err = ENOMEM;
+      goto done;
+   }
 
-   // perform file actions
+   for (n = 0; n < numActions && xpio_getAction(L, 4, n+1, &fdFrom, &fdTo); ++n) {
+      actions[2*n] = fdTo;
+      actions[2*n+1] = fdFrom;
+   }
+   numActions = n;
 
-   int fdFrom, fdTo, ndx;
-   for (ndx = 1; xpio_getAction(L, 4, ndx, &fdFrom, &fdTo); ++ndx) {
-      if (fdFrom >= 0) {
-         if (fdFrom != fdTo) {
-            dup2(fdFrom, fdTo);
+   // Make granted FDs blocking.  Blocking mode is a property of the file,
+   // not the descriptor, so setting it in the parent is the same as
+   // setting it in the child after the dup2() calls.
+   for (n = 0; n < numActions; ++n) {
+      if (actions[2*n+1] >= 0) {
+         fdFrom = xpio_actionSource(actions, n, actions[2*n+1]);
+         if (fdFrom >= 0) {
+            (void) setNonBlocking(fdFrom, 0);
          }
-         // make granted FDs blocking
-         (void) setNonBlocking(fdTo, 0);
-      } else {
-         close(fdTo);
       }
    }
 
-   char **argv = readStringArray(L, 2);
-   char **envp = readStringArray(L, 3);
+#ifndef XPIO_SPAWN_CHDIR
+   if (cwd) {
+      pid = xpio_forkExec(path, argv, envp, actions, numActions, cwd);
+      err = (pid < 0 ? errno : 0);
+      goto done;
+   }
+#endif
+   err = xpio_posixSpawn(&pid, path, argv, envp, actions, numActions, cwd);
 
-   execve(path, argv, envp);
+ done:
+   freeStringArray(argv);
+   freeStringArray(envp);
+   FREE_IF(actions);
 
- bail:
-   exit(127);
+   if (err) {
+      errno = err;
+      return pushError(L, NULL);
+   }
+
+   XPProc *pproc = xpproc_new(L);
+   pproc->pid = pid;
+#ifdef XPIO_PIDFD
+   pproc->pidfd = xpproc_openPidfd(pid);
+#endif
+   return 1;
 }
 
 
@@ -1695,9 +2558,13 @@ static const luaL_Reg xpio_regs[] = {
    {"socket", xpio_socket},
    {"tqueue", xpio_tqueue},
    {"gettime", xpio_gettime},
+   {"nprocs", xpio_nprocs},
    {"socketpair", xpio_socketpair},
    {"pipe", xpio_pipe},
    {"fdopen", xpio_fdopen},
+   {"open", xpio_open},
+   {"dup", xpio_dup},
+   {"inotify", xpio_inotify},
    {"_spawn", xpio__spawn},
    {"_nextfd", xpio__nextfd},
    {0, 0}
@@ -1739,6 +2606,11 @@ int luaopen_xpio_c(lua_State *L)
    lua_pushcclosure(L, xpsocket_try_accept, 1);
    lua_setfield(L, -2, "try_accept");
 
+   // ... and so does `socket:try_recvfds`
+   lua_pushvalue(L, -2);
+   lua_pushcclosure(L, xpsocket_try_recvfds, 1);
+   lua_setfield(L, -2, "try_recvfds");
+
    lua_setfield(L, -2, "_XPSocket");
 
    // extract environment variables
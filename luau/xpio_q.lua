@@ -272,6 +272,66 @@ end
 pipeTest()
 
 
+-- task queues, with epoll (where available) and with poll()
+
+local function tqueueTest(opts)
+   local r, w = xpio.pipe()
+   local tq = xpio.tqueue(opts)
+   eq(tq:wait(), nil)
+
+   -- a dequeued task is not returned
+   local gone = { _queue = tq, name = "gone" }
+   r:when_read(gone)
+   gone._dequeue(gone)
+   eq(tq:isEmpty(), true)
+   eq(w:try_write("x"), 1)
+   eq(tq:wait(0), {})
+
+   -- only ready tasks are returned; others keep waiting
+   eq(r:try_read(10), "x")
+   r:when_read{ _queue = tq, name = "r" }
+   w:when_write{ _queue = tq, name = "w" }
+   local ready = tq:wait(1)
+   eq(#ready, 1)
+   eq(ready[1].name, "w")
+   eq(w:try_write("y"), 1)
+   ready = tq:wait(1)
+   eq(#ready, 1)
+   eq(ready[1].name, "r")
+   eq(tq:isEmpty(), true)
+
+   r:close()
+   w:close()
+
+   -- child processes
+   local proc = xpio.spawn({"true"}, {}, {}, {})
+   proc:when_wait{ _queue = tq, name = "proc" }
+   ready = tq:wait(2)
+   eq(#ready, 1)
+   eq(ready[1].name, "proc")
+   eq({proc:try_wait()}, {"exit", 0})
+
+   -- each exit wakes its own waiter
+   local procs = {}
+   for n = 1, 20 do
+      procs[n] = xpio.spawn({"sh", "-c", "exit " .. n}, {}, {}, {})
+      procs[n]:when_wait{ _queue = tq, n = n }
+   end
+   local numDone = 0
+   while numDone < 20 do
+      ready = tq:wait(2)
+      assert(#ready > 0)
+      for _, task in ipairs(ready) do
+         eq({procs[task.n]:try_wait()}, {"exit", task.n})
+         numDone = numDone + 1
+      end
+   end
+   eq(tq:isEmpty(), true)
+end
+tqueueTest()
+tqueueTest{ poll = true }
+
+
 ----------------------------------------------------------------
 -- Minimal dispatcher
 ----------------------------------------------------------------
@@ -356,9 +416,153 @@ end
 dispatch(testProcs)
 
 
+-- working directory
+
+local function testCwd()
+   local r1, w1 = xpio.pipe()
+
+   local proc = xpio.spawn({"pwd"}, {}, {[1]=w1}, {cwd = "/"})
+   assert(proc:wait())
+   eq(r1:read(100), "/\n")
+   r1:close()
+end
+dispatch(testCwd)
+
+
+-- A process that is collected without being waited for is killed and
+-- reaped, not left a zombie.
+
+local function testCollect()
+   local r1, w1 = xpio.pipe()
+   local proc = xpio.spawn({"sh", "-c", "echo $$; exec sleep 10"}, {}, {[1]=w1}, {})
+   w1:close()
+   local pid = r1:read(100):match("%d+")
+   r1:close()
+   proc = nil
+   collectgarbage()
+   collectgarbage()
+   -- Give an unreaped process time to become a zombie.
+   sleep(0.05)
+   local f = io.open("/proc/" .. pid .. "/stat")
+   if f then
+      -- Only a reused pid may be there, and it is not a zombie.
+      eq(f:read("a"):match("^%d+ %b() (%a)") == "Z", false)
+      f:close()
+   end
+end
+dispatch(testCollect)
+
+
+-- spawn latency
+
+local function benchSpawn()
+   -- A large Lua heap slows fork(), but should not slow posix_spawn().
+   local ballast = {}
+   for n = 1, 200000 do
+      ballast[n] = { n }
+   end
+
+   -- Time _spawn() alone; spawn() also scans for open descriptors.
+   local path = xpio._searchPath("true")
+   local count = 50
+   local procs = {}
+   local t0 = xpio.gettime()
+   for n = 1, count do
+      procs[n] = assert(xpio._spawn(path, {"true"}, {}, {}))
+   end
+   local elapsed = xpio.gettime() - t0
+   for _, proc in ipairs(procs) do
+      eq({proc:wait()}, {"exit", 0})
+   end
+   print(("spawn: %.3f ms per process"):format(elapsed * 1000 / count))
+end
+dispatch(benchSpawn)
+
+
+-- spawn failures
+
+local function testSpawnError()
+   local proc, err = xpio.spawn({"./xpio_q_nonexistent"}, {}, {}, {})
+   eq(proc, nil)
+   eq(type(err), "string")
+end
+dispatch(testSpawnError)
+
+
 local function testFDOpen()
    local f = xpio.fdopen(1)
    f:write("write via fdopen succeeded") -- TODO: automate this test
 end
 
 dispatch(testFDOpen)
+
+
+-- UNIX-domain sockets and descriptor passing
+
+local function testUnix()
+   local path = os.tmpname()
+   os.remove(path)
+
+   local a = assert(xpio.socket("UNIX"))
+   assert(a:bind(path))
+   assert(a:listen())
+   eq(a:getsockname(), path)
+
+   local c = assert(xpio.socket("UNIX"))
+   assert(c:connect(path))
+   local s = assert(a:accept())
+
+   local r, w = xpio.pipe()
+   eq(c:sendfds("fds", w), 3)
+   w:close()
+   local data, w2, extra = s:recvfds(100)
+   eq(data, "fds")
+   eq(extra, nil)
+
+   -- The received descriptor writes to the same pipe.
+   local n = xpio.dup(w2)
+   assert(n ~= w2:fileno())
+   w2:close()
+   local w3 = xpio.fdopen(n)
+   assert(w3:write("via dup"))
+   eq(r:read(100), "via dup")
+
+   c:close()
+   eq(s:recvfds(100), nil)
+   s:close()
+   a:close()
+   os.remove(path)
+end
+dispatch(testUnix)
+
+
+-- File system events
+
+local function testInotify()
+   local w, err = xpio.inotify()
+   if not w then
+      eq(err, "xpio: inotify is not supported")
+      return
+   end
+   local dir = os.tmpname()
+   os.remove(dir)
+   assert(os.execute("mkdir " .. dir))
+   local wd = assert(w:addwatch(dir))
+   eq(w:try_read(100), nil)
+
+   local f = io.open(dir .. "/a", "w")
+   f:write("x")
+   f:close()
+   local names = {}
+   for _, e in ipairs(assert(w:readwatch())) do
+      eq(e.wd, wd)
+      names[e.name] = true
+   end
+   eq(names, {a = true})
+
+   assert(w:rmwatch(wd))
+   w:close()
+   os.remove(dir .. "/a")
+   os.remove(dir)
+end
+dispatch(testInotify)
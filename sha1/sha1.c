@@ -76,7 +76,10 @@ A million repetitions of "a"
   34AA973C D4C4DAA4 F61EEB2B DBAD2731 6534016F
 */
 
-/* #define SHA1HANDSOFF  */
+/* Copy each block before transforming it.  Callers pass Lua strings,
+   which must not be modified, and the digest functions run on several
+   threads at once, so the copy is on the stack. */
+#define SHA1HANDSOFF
 
 #ifdef HAVE_CONFIG_H
 #include "config.h"
@@ -136,8 +139,8 @@ void SHA1_Transform(uint32_t state[5], const uint8_t buffer[64])
     CHAR64LONG16* block;
 
 #ifdef SHA1HANDSOFF
-    static uint8_t workspace[64];
-    block = (CHAR64LONG16*)workspace;
+    CHAR64LONG16 workspace;
+    block = &workspace;
     memcpy(block, buffer, 64);
 #else
     block = (CHAR64LONG16*)buffer;
@@ -252,10 +255,6 @@ void SHA1_Final(SHA1_CTX* context, uint8_t digest[SHA1_DIGEST_SIZE])
     memset(context->state, 0, 20);
     memset(context->count, 0, 8);
     memset(finalcount, 0, 8);	/* SWR */
-
-#ifdef SHA1HANDSOFF  /* make SHA1Transform overwrite its own static vars */
-    SHA1_Transform(context->state, context->buffer);
-#endif
 }
 
 /*************************************************************/